@@ -46,6 +46,23 @@
 
 //#define IFX_CFG_EXTEND_TRAP_HOOKS
 
+/*______________________________________________________________________________
+** Configuration for the lookup tables (Ifx_Lut.h). The precompiled tables shall
+** be regenerated with "make -C 1_ToolEnv/1_Host lut" after a change
+**____________________________________________________________________________*/
+
+//#define IFX_LUT_ANGLE_BITS            (14)
+//#define IFX_LUTSINCOSF32_BITS         (12)
+//#define IFX_LUTATAN2F32_BITS          (10)
+//#define IFX_LUTATAN2F32_INTERPOLATION (1)
+
+/*______________________________________________________________________________
+** Configuration for the shell (Ifx_Shell.h): size of the command index, the
+** smallest power of 2 not below the number of commands of the application
+**____________________________________________________________________________*/
+
+//#define IFX_CFG_SHELL_INDEX_SIZE      (64)
+
 /******************************************************************************/
 /*Disable the Core1*/
 #define IFX_CFG_CPU_CSTART_ENABLE_TRICORE1    (1)
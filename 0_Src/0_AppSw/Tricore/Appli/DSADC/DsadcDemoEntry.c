@@ -1,6 +1,7 @@
 #include <Appli/DSADC/DsadcDemoEntry.h>
 #include "Appli/Ifx_IntPrioDef.h"
 #include "Ifx_LutAtan2f32.h"
+#include "SysSe/Comm/Ifx_Capture.h"
 
 static uint32 dsadc_count = 0;
 
@@ -21,33 +22,47 @@ uint8 dsadcChannelAvailable[IFXDSADC_NUM_CHANNELS] = { 1, 1, 1, 1, 1, 1, 1, 1, 1
 IfxDsadc_Rdc Rdc;
 IfxStdIf_Pos dsadcRdc;
 
+#ifdef DSADC_RDC_DMA
+/* RDC results moved by DMA, processed by IfxDsadc_Rdc_update() */
+#define RDC_DMA_BUFFER_SIZE 64
+static sint16 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 2))) rdcDmaSin[RDC_DMA_BUFFER_SIZE];
+static sint16 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 2))) rdcDmaCos[RDC_DMA_BUFFER_SIZE];
+static uint32 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 4))) rdcDmaTimestamp[RDC_DMA_BUFFER_SIZE];
+#endif
+
 float result[];
 uint32 calibration[200];
 uint32 calibration_25V;
 uint8  Offset_calibration_flag =0;
 uint8  Offset_counter = 50;
-sint16 Offset_calibration[100];
 sint16 Offset_Value = 0;
 uint8  Gain_calibration_flag = 0;
 uint8  Gain_counter = 100;
-uint32 Gain_calibration[100];
 uint32 Gain_Value=0;
 float  Gain_Value_float;
 //typedef signed short   sint16;              /*      -32768 .. +32767          */
 //typedef unsigned short uint16;
 
-#define num_in_all 50
-
-uint16 array_deal(uint16 *a);
+/* Results of the DSADC channels 0 and 1, captured by dsadc0ISR() and exported by DSADC_DemoRun() */
+#define DSADC_CAPTURE_CHANNELS  2
+#define DSADC_CAPTURE_SIZE      1024
+static sint16        dsadcCaptureBuffer[DSADC_CAPTURE_CHANNELS][DSADC_CAPTURE_SIZE];
+static Ifx_TickTime  dsadcCaptureTimestamps[DSADC_CAPTURE_CHANNELS][DSADC_CAPTURE_SIZE / IFX_CAPTURE_FRAME_SIZE];
+Ifx_Capture          dsadcCapture[DSADC_CAPTURE_CHANNELS];
+static Ifx_Telemetry *dsadcTelemetry = NULL_PTR;
+static sint32        dsadcTelemetryChannel[DSADC_CAPTURE_CHANNELS];
 
-uint16 N[num_in_all];
-uint16 P[num_in_all];
-uint16 All[num_in_all];
+static void DSADC_CaptureInit(void)
+{
+	Ifx_Capture_Config config;
+	uint8 i;
 
-sint16 test_result[1000];
-sint16 test_result1[1000];
-uint16 result_pointer=0;
-float angle[1000];
+	for (i = 0; i < DSADC_CAPTURE_CHANNELS; i++)
+	{
+		Ifx_Capture_initConfig(&config, dsadcCaptureBuffer[i], dsadcCaptureTimestamps[i], DSADC_CAPTURE_SIZE);
+		Ifx_Capture_init(&dsadcCapture[i], &config);
+	}
+}
 
 #ifdef DSADC_INT
 IFX_INTERRUPT(dsadc0ISR, 0, IFX_INTPRIO_DSADC_CH0_PRIO)
@@ -63,20 +78,15 @@ IFX_INTERRUPT(dsadc0ISR, 0, IFX_INTPRIO_DSADC_CH0_PRIO)
 
 		if((Gain_calibration_flag == 1) && (Offset_calibration_flag == 1))
     	{
-    		test_result[result_pointer] = Gain_Value_float* temp;
-    		result_pointer++;
-    		if(result_pointer>999) result_pointer = 0;
+    		Ifx_Capture_add(&dsadcCapture[0], (sint16)(Gain_Value_float* temp));
     	}
     }
     else if (demo_idx == DSADC_RESOLVER_APP )
     {
     	if(DSADC_EVFLAG.B.RESEV0 == 1)	DSADC_EVFLAGCLR.B.RESEC0 = 1;
-    	test_result[result_pointer]  = (sint16)DSADC_RESM0.B.RESULT;
+    	Ifx_Capture_add(&dsadcCapture[0], (sint16)DSADC_RESM0.B.RESULT);
     	if(DSADC_EVFLAG.B.RESEV1 == 1)	DSADC_EVFLAGCLR.B.RESEC1 = 1;
-    	test_result1[result_pointer] = (sint16)DSADC_RESM1.B.RESULT;
-    	//angle[result_pointer]= Ifx_LutAtan2F32_fxpAngle(test_result[result_pointer], test_result1[result_pointer]);
-    	result_pointer++;
-    	if(result_pointer>999) result_pointer = 0;
+    	Ifx_Capture_add(&dsadcCapture[1], (sint16)DSADC_RESM1.B.RESULT);
     }
 }
 #endif
@@ -149,7 +159,7 @@ void DSADC_Normal_Conv_Init(uint32 module, uint32 idx)
 #else
 	uint16 endinitPw;
 	uint32 t1 = 0;
-	int i;
+	Ifx_Capture_Statistics statistics;
 
 	endinitPw = IfxScuWdt_getCpuWatchdogPassword();
 
@@ -229,21 +239,16 @@ void DSADC_Normal_Conv_Init(uint32 module, uint32 idx)
     uint16 number_count;
     IfxCpu_disableInterrupts();
 
-    //calibration for the offset
-    for(number_count = 0; number_count<50; number_count++)
+    //calibration for the offset: mean of the results 10 .. 39
+    Ifx_Capture_Statistics_reset(&statistics);
+    for(number_count = 0; number_count<40; number_count++)
     {
     	while(SRC_DSADCSRM0.B.SRR != 1){};
     	SRC_DSADCSRM0.B.CLRR = 1;
     	if(DSADC_EVFLAG.B.RESEV0 == 1)	DSADC_EVFLAGCLR.B.RESEC0 = 1;
-        Offset_calibration[number_count] = DSADC_RESM0.B.RESULT;;
+    	if(number_count >= 10) Ifx_Capture_Statistics_add(&statistics, (sint16)DSADC_RESM0.B.RESULT);
     }
-
-    Offset_Value = 0;
-	for(i= 10; i< 40; i ++)
-	{
-		Offset_Value += Offset_calibration[i];
-	}
-    Offset_Value = Offset_Value/30;
+    Offset_Value = (sint16)(statistics.sum / statistics.count);
 
 	DSADC_GLOBRC.U = 0x00000;				//stop CH0 conversion
 	DSADC_OFFM0.B.OFFSET=Offset_Value;
@@ -253,20 +258,16 @@ void DSADC_Normal_Conv_Init(uint32 module, uint32 idx)
 	DSADC_GLOBRC.U = 0x10001;				//restart CH0 conversion
 	Offset_calibration_flag = 1;
 
-	//calibration for the gain
-    for(number_count = 0; number_count<100; number_count++)
+	//calibration for the gain: mean of the results 20 .. 79
+    Ifx_Capture_Statistics_reset(&statistics);
+    for(number_count = 0; number_count<80; number_count++)
     {
     	while(SRC_DSADCSRM0.B.SRR != 1){};
     	SRC_DSADCSRM0.B.CLRR = 1;
     	if(DSADC_EVFLAG.B.RESEV0 == 1)	DSADC_EVFLAGCLR.B.RESEC0 = 1;
-    	Gain_calibration[number_count] = DSADC_RESM0.B.RESULT;;
-    }
-    Gain_Value = 0;
-    for(i =20; i<80; i++)
-    {
-    	Gain_Value += Gain_calibration[i];
+    	if(number_count >= 20) Ifx_Capture_Statistics_add(&statistics, (sint16)DSADC_RESM0.B.RESULT);
     }
-    Gain_Value      = Gain_Value/60;
+    Gain_Value      = (uint32)(statistics.sum / statistics.count);
     DSADC_GLOBRC.U  = 0x00000;				//stop CH0 conversion
     DSADC_MODCFG0.U = 0x86848000;           //INCFGP = Input pin, INCFGN = input pin
     IfxStm_waitTicks(&MODULE_STM0, 10000000);
@@ -382,6 +383,17 @@ void DSADC_RDC_ChannelInit(void)
     ConfigHw.servReqProvider                     = 0;
     ConfigHw.startScan                           = FALSE;
 
+#ifdef DSADC_RDC_DMA
+    ConfigHw.dma.useDma                          = TRUE;
+    ConfigHw.dma.sinDmaChannelId                 = IfxDma_ChannelId_12;                         /* APPLICATION SPECIFIC. COS: 11, timestamp: 10 */
+    ConfigHw.dma.sinBuffer                       = rdcDmaSin;
+    ConfigHw.dma.cosBuffer                       = rdcDmaCos;
+    ConfigHw.dma.timestampBuffer                 = rdcDmaTimestamp;
+    ConfigHw.dma.bufferSize                      = RDC_DMA_BUFFER_SIZE;
+#else
+    ConfigHw.dma.useDma                          = FALSE;
+#endif
+
     /** Configuration for DSADC resolver interface */
     /* set ALL gain to zero for using default values */
     config.kd                = 0;
@@ -682,16 +694,17 @@ void DSADC_RDC_Init(module, idx)
 
     //calibration for SDPOS and SDNEG
 	uint8 counter0,counter1;
+	sint16 sinResult, cosResult;
     while(SRC_DSADCSRM0.B.SRR != 1){};
     SRC_DSADCSRM0.B.CLRR = 1;
     if(DSADC_EVFLAG.B.RESEV0 == 1)	DSADC_EVFLAGCLR.B.RESEC0 = 1;
-    test_result[0]  = (sint16)DSADC_RESM0.B.RESULT;
+    sinResult = (sint16)DSADC_RESM0.B.RESULT;
     counter0 = DSADC_CGSYNC0.B.SDCAP;
     if(DSADC_EVFLAG.B.RESEV1 == 1)	DSADC_EVFLAGCLR.B.RESEC1 = 1;
-    test_result1[0] = (sint16)DSADC_RESM1.B.RESULT;
+    cosResult = (sint16)DSADC_RESM1.B.RESULT;
     counter1 = DSADC_CGSYNC1.B.SDCAP;
 
-    if((test_result[0]>= 0)&&(test_result1[0]>= 0))
+    if((sinResult>= 0)&&(cosResult>= 0))
     {
     	//SIN signal, resolver position is between 0 degrees and 90 degrees
     	DSADC_CGSYNC0.B.SDPOS = counter0;
@@ -701,7 +714,7 @@ void DSADC_RDC_Init(module, idx)
     	DSADC_CGSYNC1.B.SDPOS = counter1;
     	DSADC_CGSYNC1.B.SDNEG = (counter1 + (DSADC_IWCTR1.B.NVALINT + 1)/2)%(DSADC_IWCTR1.B.NVALINT + 1);
     }
-    else if((test_result[0]>= 0)&&(test_result1[0]<= 0))
+    else if((sinResult>= 0)&&(cosResult<= 0))
     {
     	//SIN signal, resolver position is between 90 degrees and 180 degrees
     	DSADC_CGSYNC0.B.SDPOS = counter0;
@@ -712,7 +725,7 @@ void DSADC_RDC_Init(module, idx)
     	DSADC_CGSYNC1.B.SDPOS = (counter1 + (DSADC_IWCTR1.B.NVALINT + 1)/2)%(DSADC_IWCTR1.B.NVALINT + 1);
 
     }
-    else if((test_result[0]<= 0)&&(test_result1[0]<= 0))
+    else if((sinResult<= 0)&&(cosResult<= 0))
     {
     	//SIN signal, resolver position is between 180 degrees and 270 degrees
     	DSADC_CGSYNC0.B.SDNEG = counter0;
@@ -751,6 +764,8 @@ void DSADC_RDC_Init(module, idx)
 }
 void DSADC_DemoInit(uint32 module, uint32 idx)
 {
+	DSADC_CaptureInit();
+
 	if(idx == DSADC_NORMAL_CONV)
 	{
 		DSADC_Normal_Conv_Init(module, idx);
@@ -780,8 +795,22 @@ void DSADC_DemoDeInit(uint32 module, uint32 idx)
 	DSADC_DeInit();
 }
 
+/* Stream the captured results with the telemetry, NULL_PTR to stop */
+void DSADC_DemoSetTelemetry(Ifx_Telemetry *telemetry)
+{
+	uint8 i;
+
+	dsadcTelemetry = telemetry;
+	for (i = 0; (telemetry != NULL_PTR) && (i < DSADC_CAPTURE_CHANNELS); i++)
+	{
+		dsadcTelemetryChannel[i] = Ifx_Capture_addChannel(&dsadcCapture[i], telemetry, (i == 0) ? "dsadc0" : "dsadc1");
+	}
+}
+
 void DSADC_DemoRun(uint32 module, uint32 idx)
 {
+	uint8 i;
+
 	dsadc_count++;
 
 	if(dsadc_count >= DSADC_PRE_DIVDER)
@@ -792,92 +821,9 @@ void DSADC_DemoRun(uint32 module, uint32 idx)
 		else if (idx == DSADC_RESOLVER_APP)
 			DSADC_Resolver_Cyclic();
 	}
-}
-
-
-uint16 uint16_neg_to_abs(uint16 a)
-{
-	sint16 b,c;
-	uint16 result;
-	//printf("%u\n",a);
-	b = (sint16) a;
-	//printf("%d\n",b);
-	c = 0 - b;
-	//printf("%d\n",c);
-	result = (uint16) c;
-	//printf("%u\n",result);
-	return result;
-}
-
-void num_deal(uint16 *a)
-{
-	uint16 *b;
-	uint16 temp;
-	int num=0;
-	int num_p=0;
-	int num_n=0;
-	//printf("Done");
-	for(b=a;num!=num_in_all;num++)
-	{
-		//printf("%u\n",b[num]);
-		if((b[num])<200)
-		{
-			P[num_p++]=b[num];
-			//printf("%u\n",b[num]);
-		}
-		else if(b[num]>0x7fff)	//confirm is a neg
-		{
-			temp = uint16_neg_to_abs(b[num]);
-			if(temp<2000)
-			{
-				N[num_n++]=temp;
-				//printf("%u\n",temp);
-			}
-		}
-	}
-	N[num_n]=0xffff;
-	P[num_p]=0xffff;
-	num=0;
-	for(num_p=0;P[num_p]!=0xffff;num_p++)
-	{
-		All[num++]=P[num_p];
-	}
-	for(num_n=0;N[num_n]!=0xffff;num_n++)
-	{
-		All[num++]=N[num_n];
-		//printf("%u",All[num]);
-	}
-	All[num]=0xffff;
-	/*
-	num=0;
-	while(All[num]!=0xffff)
-	{
-		printf("%u\n",All[num]);
-		num++;
-	}
-	*/
-}
 
-uint16 average(uint16 *a)
-{
-	uint16 result;
-	uint16 sum=0;
-	uint16 num=0;
-	uint16 *b;
-	for(b=a;b[num]!=0xffff;num++)
+	for (i = 0; (dsadcTelemetry != NULL_PTR) && (i < DSADC_CAPTURE_CHANNELS); i++)
 	{
-		sum += b[num];
-		//num++;
+		Ifx_Capture_export(&dsadcCapture[i], dsadcTelemetry, dsadcTelemetryChannel[i]);
 	}
-	result = sum / num;
-	return result;
-}
-
-uint16 array_deal(uint16 *a)
-{
-	uint16 result;
-	num_deal(a);
-	printf("Done");
-	result = average(All);
-	return result;
 }
@@ -2,6 +2,7 @@
 #define DEMO_DSADC
 
 #include "IfxDsadc_Rdc.h"
+#include "SysSe/Comm/Ifx_Telemetry.h"
 //#include "Appli/Back/demo_handler.h"
 
 #define DSADC_PRE_DIVDER	 	(1)
@@ -19,6 +20,7 @@
 //#define iLLD
 #define DERIVATIVE_TC27xC
 //#define DSADC_INT
+//#define DSADC_RDC_DMA
 #define LOGIC_BOARD
 //#define GAIN_CALIBRATION_1
 //#define GAIN_CALIBRATION_2
@@ -26,6 +28,7 @@
 void DSADC_DemoInit(uint32 module, uint32 idx);
 void DSADC_DemoDeInit(uint32 module, uint32 idx);
 void DSADC_DemoRun(uint32 module, uint32 idx);
+void DSADC_DemoSetTelemetry(Ifx_Telemetry *telemetry);
 #if 0
 CONST_CFG IfxDsadc_Dsadc_CarrierGenConfig cfg_PosIf_RdcDs_Carrier =
 {
@@ -332,6 +332,7 @@ void Appli_DispMenu(int menu, int demo)
 		Appli_ConsolePrint(&console, "[1] ADC Queued\r\n");
 		Appli_ConsolePrint(&console, "[2] ADC Scan\r\n");
 		Appli_ConsolePrint(&console, "[3] ADC Background\r\n");
+		Appli_ConsolePrint(&console, "[4] ADC DMA acquisition\r\n");
 		Appli_ConsolePrint(&console, "[X] EXIT\r\n");
 		Appli_ConsolePrint(&console, "\r\n");
 	}
@@ -132,6 +132,38 @@ void Appli_AdcBackgroundInit(void)
 
 }
 
+// DMA acquisition: the results are copied by the DMA into one ring buffer per channel
+#define ADC_ACQ_CHANNELS    3
+#define ADC_ACQ_BUFFER_SIZE 64
+static uint16 __attribute__ ((aligned(ADC_ACQ_BUFFER_SIZE * 2))) adcAcqBuffer[ADC_ACQ_CHANNELS][ADC_ACQ_BUFFER_SIZE];
+IfxVadc_Acq adcAcq;
+
+void Appli_AdcAcqInit(void)
+{
+	int chnIx;
+	IfxVadc_Acq_Config acqConfig;
+	IfxVadc_Acq_ChannelConfig acqChannelConfig[ADC_ACQ_CHANNELS];
+
+	for(chnIx = 0; chnIx < ADC_ACQ_CHANNELS; ++chnIx)
+	{
+		IfxVadc_Acq_initChannelConfig(&acqChannelConfig[chnIx], &adcGroup);
+		acqChannelConfig[chnIx].adc.channelId = (IfxVadc_ChannelId)(chnIx);
+		acqChannelConfig[chnIx].adc.resultRegister = (IfxVadc_ChannelResult)(chnIx);	// use dedicated result register
+		acqChannelConfig[chnIx].adc.resultSrcNr = (IfxVadc_SrcNr)(chnIx);			// and dedicated service request node
+		acqChannelConfig[chnIx].dmaChannelId = (IfxDma_ChannelId)(20 + chnIx);			// DMA channels 10..12 are used by the DSADC demo
+		acqChannelConfig[chnIx].buffer = adcAcqBuffer[chnIx];
+	}
+
+	// continuous autoscan, no GTM trigger in this demo
+	IfxVadc_Acq_initConfig(&acqConfig, &adcGroup);
+	acqConfig.channels = acqChannelConfig;
+	acqConfig.channelCount = ADC_ACQ_CHANNELS;
+	acqConfig.bufferSize = ADC_ACQ_BUFFER_SIZE;
+
+	IfxVadc_Acq_init(&adcAcq, &acqConfig);
+	IfxVadc_Acq_start(&adcAcq);
+}
+
 void Appli_AdcInit(void)
 {
 	Appli_AdcModule_Init();
@@ -144,6 +176,8 @@ void Appli_AdcInit(void)
 		Appli_AdcScanInit();
 	else if(demo_item == 3)
 		Appli_AdcBackgroundInit();
+	else if(demo_item == 4)
+		Appli_AdcAcqInit();
 }
 
 void Appli_AdcDemoInit(void)
@@ -288,6 +322,26 @@ void Appli_AdcDemo_Background(void)
 	ConsolePrint("\r\n");
 }
 
+void Appli_AdcDemo_Acq(void)
+{
+	int chnIx;
+	char str_adc[10];
+
+	// no polling: the DMA keeps the ring buffers up to date
+	for(chnIx = 0; chnIx < ADC_ACQ_CHANNELS; ++chnIx)
+	{
+		ConsolePrint(chnIx == 0 ? "CH0 :" : (chnIx == 1 ? "\tCH1 :" : "\tCH2 :"));
+		ShortToAscii(IfxVadc_Acq_getLatest(&adcAcq.channel[chnIx]), str_adc);
+		ConsolePrint(str_adc);
+
+		ConsolePrint(" avg:");
+		ShortToAscii((uint16)IfxVadc_Acq_getFiltered(&adcAcq.channel[chnIx]), str_adc);
+		ConsolePrint(str_adc);
+	}
+
+	ConsolePrint("\r\n");
+}
+
 void Appli_AdcCyclic(void)
 {
 	adc_count++;
@@ -302,6 +356,8 @@ void Appli_AdcCyclic(void)
 			Appli_AdcDemo_Scan();
 		else if(demo_item == 3)
 			Appli_AdcDemo_Background();
+		else if(demo_item == 4)
+			Appli_AdcDemo_Acq();
 	}
 }
 
@@ -3,6 +3,7 @@
 #include "Cpu\Std\Ifx_Types.h"
 #include "Port\Io\IfxPort_Io.h"
 #include "Vadc/Adc/IfxVadc_Adc.h"
+#include "Vadc/Acq/IfxVadc_Acq.h"
 
 void Appli_AdcInit(void);
 void Appli_AdcDemoInit(void);
@@ -17,6 +17,7 @@
 #include "Port\Std\IfxPort.h"
 #include "IfxAsclin_reg.h"
 #include <Asclin/Asc/IfxAsclin_Asc.h>
+#include <SysSe/Comm/Ifx_Log.h>
 #include <Stm/Std/IfxStm.h>
 
 /* Simple timing loop */
@@ -25,8 +26,7 @@ uint32 volatile DelayLoopCounter;
 /* Image of a port pin state */
 uint8 Port10_1_State;
 static IfxAsclin_Asc asc;
-
-IfxCpu_mutexLock g_Asc0_Lock;
+static IfxStdIf_DPipe ascStdIf;
 
 #define ASC_TX_BUFFER_SIZE 512
 static uint8 ascTxBuffer[ASC_TX_BUFFER_SIZE+ sizeof(Ifx_Fifo) + 8];
@@ -160,6 +160,10 @@ int core0_main (void)
 
 	IfxAsclin_Asc_initModule(&asc, &ascConfig);
 
+	/* log messages of all the cores are sent through the ASC by the main loop */
+	IfxAsclin_Asc_stdIfDPipeInit(&ascStdIf, &asc);
+	Ifx_Log_init(&ascStdIf);
+
 	schd_init();
 
     /*
@@ -218,10 +222,7 @@ int core0_main (void)
 
 =======
 >>>>>>> 009e84c3c9b906356ccbca14c06e5d96616a64ff
-    	boolean flag = IfxCpu_acquireMutex(&g_Asc0_Lock);
-    	if (flag)
-    	{
-    		printf("Cpu%d:%u Hz, Sys:%u Hz, Stm:%u Hz, Core:%04X,  %u\n",
+    	boolean flag = Ifx_Log_write("Cpu%d:%u Hz, Sys:%u Hz, Stm:%u Hz, Core:%04X,  %u\n", 6,
     				IfxCpu_getCoreId(),
 					SYSTEM_GetCpuClock(),
 					SYSTEM_GetSysClock(),
@@ -229,8 +230,8 @@ int core0_main (void)
 					__TRICORE_CORE__,
 					schd_GetTick()
     		);
-
-    		IfxCpu_releaseMutex(&g_Asc0_Lock);
+    	if (flag)
+    	{
 <<<<<<< HEAD
     		IfxPort_togglePin(&MODULE_P33, 0u);
     	}
@@ -249,6 +250,9 @@ int core0_main (void)
 >>>>>>> 009e84c3c9b906356ccbca14c06e5d96616a64ff
     	}
 
+    	/* format and send the messages of all the cores, without waiting */
+    	Ifx_Log_process();
+
     	/* test delay */
 
         /* Turn LED On */
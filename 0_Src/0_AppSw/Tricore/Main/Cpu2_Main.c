@@ -27,10 +27,9 @@
 #include "Scu/Std/IfxScuWdt.h"
 #include "Port\Std\IfxPort.h"
 #include "main.h"
+#include "SysSe/Comm/Ifx_Log.h"
 //#include "../Appli/BACK/demo_handler.h"
 
-extern IfxCpu_mutexLock g_Asc0_Lock;
-
 int core2_main (void)
 {
 	uint32_t tmpTick;
@@ -43,9 +42,8 @@ int core2_main (void)
     IfxScuWdt_disableCpuWatchdog (IfxScuWdt_getCpuWatchdogPassword ());
     while (1)
     {
-    	boolean flag = IfxCpu_acquireMutex(&g_Asc0_Lock);
-    	if (flag){
-    		printf("Cpu%d:%u Hz, Sys:%u Hz, Stm:%u Hz, Core:%04X,  %u\n",
+    	/* deferred: formatted and sent by CPU0, never waits for the other cores */
+    	boolean flag = Ifx_Log_write("Cpu%d:%u Hz, Sys:%u Hz, Stm:%u Hz, Core:%04X,  %u\n", 6,
     				IfxCpu_getCoreId(),
 					SYSTEM_GetCpuClock(),
 					SYSTEM_GetSysClock(),
@@ -53,8 +51,7 @@ int core2_main (void)
 					__TRICORE_CORE__,
 					schd_GetTick()
     		);
-
-    		IfxCpu_releaseMutex(&g_Asc0_Lock);
+    	if (flag){
     		IfxPort_togglePin(&MODULE_P33, 11);
     		//        	wait(100000);
     		tmpTick = schd_GetTick();
@@ -208,32 +208,54 @@ typedef void (*IfxStdIf_DPipe_OnError)(IfxStdIf_InterfaceDriver driver);
  */
 typedef void (*IfxStdIf_DPipe_ResetSendCount)(IfxStdIf_InterfaceDriver driver);
 
+/** \brief Interrupt load counters of the driver
+ *
+ * The average number of bytes moved per interrupt is rxBytes / rxInterrupts, resp. txBytes / txInterrupts.
+ */
+typedef struct
+{
+    uint32 rxInterrupts;     /**< \brief Number of receive interrupts handled */
+    uint32 rxBytes;          /**< \brief Number of bytes moved by the receive interrupts */
+    uint32 txInterrupts;     /**< \brief Number of transmit interrupts handled */
+    uint32 txBytes;          /**< \brief Number of bytes moved by the transmit interrupts */
+} IfxStdIf_DPipe_IsrStatistics;
+
+/** \brief Return the interrupt load counters
+ *
+ * \param driver Pointer to the interface driver object
+ * \param statistics Pointer to the object where the counters are copied to
+ *
+ * \return none
+ */
+typedef void (*IfxStdIf_DPipe_GetIsrStatistics)(IfxStdIf_InterfaceDriver driver, IfxStdIf_DPipe_IsrStatistics *statistics);
+
 /** \brief Standard interface object
  */
 struct IfxStdIf_DPipe_
 {
-    IfxStdIf_InterfaceDriver driver;              /**< \brief Pointer to the specific driver object */
-    boolean                  txDisabled;          /**< \brief If disabled is set to TRUE, the output is disabled, else enabled */
+    IfxStdIf_InterfaceDriver        driver;           /**< \brief Pointer to the specific driver object */
+    boolean                         txDisabled;       /**< \brief If disabled is set to TRUE, the output is disabled, else enabled */
 
     /* Standard interface APIs */
-    IfxStdIf_DPipe_Write          write;          /**< \brief \see IfxStdIf_DPipe_Write */
-    IfxStdIf_DPipe_Read           read;           /**< \brief \see IfxStdIf_DPipe_Read */
-    IfxStdIf_DPipe_GetReadCount   getReadCount;   /**< \brief \see IfxStdIf_DPipe_GetReadCount */
-    IfxStdIf_DPipe_GetReadEvent   getReadEvent;   /**< \brief \see IfxStdIf_DPipe_GetReadEvent */
-    IfxStdIf_DPipe_GetWriteCount  getWriteCount;  /**< \brief \see IfxStdIf_DPipe_GetWriteCount */
-    IfxStdIf_DPipe_GetWriteEvent  getWriteEvent;  /**< \brief \see IfxStdIf_DPipe_GetWriteEvent */
-    IfxStdIf_DPipe_CanReadCount   canReadCount;   /**< \brief \see IfxStdIf_DPipe_CanReadCount */
-    IfxStdIf_DPipe_CanWriteCount  canWriteCount;  /**< \brief \see IfxStdIf_DPipe_CanWriteCount */
-    IfxStdIf_DPipe_FlushTx        flushTx;        /**< \brief \see IfxStdIf_DPipe_FlushTx */
-    IfxStdIf_DPipe_ClearTx        clearTx;        /**< \brief \see IfxStdIf_DPipe_ClearTx */
-    IfxStdIf_DPipe_ClearRx        clearRx;        /**< \brief \see IfxStdIf_DPipe_ClearRx */
-    IfxStdIf_DPipe_OnReceive      onReceive;      /**< \brief \see IfxStdIf_DPipe_OnReceive  */
-    IfxStdIf_DPipe_OnTransmit     onTransmit;     /**< \brief \see IfxStdIf_DPipe_OnTransmit */
-    IfxStdIf_DPipe_OnError        onError;        /**< \brief \see IfxStdIf_DPipe_OnError    */
-
-    IfxStdIf_DPipe_GetSendCount   getSendCount;   /**< \brief \see IfxStdIf_DPipe_GetSendCount    */
-    IfxStdIf_DPipe_GetTxTimeStamp getTxTimeStamp; /**< \brief \see IfxStdIf_DPipe_GetTxTimeStamp    */
-    IfxStdIf_DPipe_ResetSendCount resetSendCount; /**< \brief \see IfxStdIf_DPipe_ResetSendCount    */
+    IfxStdIf_DPipe_Write            write;            /**< \brief \see IfxStdIf_DPipe_Write */
+    IfxStdIf_DPipe_Read             read;             /**< \brief \see IfxStdIf_DPipe_Read */
+    IfxStdIf_DPipe_GetReadCount     getReadCount;     /**< \brief \see IfxStdIf_DPipe_GetReadCount */
+    IfxStdIf_DPipe_GetReadEvent     getReadEvent;     /**< \brief \see IfxStdIf_DPipe_GetReadEvent */
+    IfxStdIf_DPipe_GetWriteCount    getWriteCount;    /**< \brief \see IfxStdIf_DPipe_GetWriteCount */
+    IfxStdIf_DPipe_GetWriteEvent    getWriteEvent;    /**< \brief \see IfxStdIf_DPipe_GetWriteEvent */
+    IfxStdIf_DPipe_CanReadCount     canReadCount;     /**< \brief \see IfxStdIf_DPipe_CanReadCount */
+    IfxStdIf_DPipe_CanWriteCount    canWriteCount;    /**< \brief \see IfxStdIf_DPipe_CanWriteCount */
+    IfxStdIf_DPipe_FlushTx          flushTx;          /**< \brief \see IfxStdIf_DPipe_FlushTx */
+    IfxStdIf_DPipe_ClearTx          clearTx;          /**< \brief \see IfxStdIf_DPipe_ClearTx */
+    IfxStdIf_DPipe_ClearRx          clearRx;          /**< \brief \see IfxStdIf_DPipe_ClearRx */
+    IfxStdIf_DPipe_OnReceive        onReceive;        /**< \brief \see IfxStdIf_DPipe_OnReceive  */
+    IfxStdIf_DPipe_OnTransmit       onTransmit;       /**< \brief \see IfxStdIf_DPipe_OnTransmit */
+    IfxStdIf_DPipe_OnError          onError;          /**< \brief \see IfxStdIf_DPipe_OnError    */
+
+    IfxStdIf_DPipe_GetSendCount     getSendCount;     /**< \brief \see IfxStdIf_DPipe_GetSendCount    */
+    IfxStdIf_DPipe_GetTxTimeStamp   getTxTimeStamp;   /**< \brief \see IfxStdIf_DPipe_GetTxTimeStamp    */
+    IfxStdIf_DPipe_ResetSendCount   resetSendCount;   /**< \brief \see IfxStdIf_DPipe_ResetSendCount    */
+    IfxStdIf_DPipe_GetIsrStatistics getIsrStatistics; /**< \brief \see IfxStdIf_DPipe_GetIsrStatistics, optional, may be NULL_PTR */
 };
 /** \addtogroup library_srvsw_stdif_dpipe
  * \{ */
@@ -373,6 +395,25 @@ IFX_INLINE void IfxStdIf_DPipe_resetSendCount(IfxStdIf_DPipe *stdif)
 }
 
 
+/** \copydoc IfxStdIf_DPipe_GetIsrStatistics
+ * All counters are 0 if the driver does not provide them.
+ */
+IFX_INLINE void IfxStdIf_DPipe_getIsrStatistics(IfxStdIf_DPipe *stdif, IfxStdIf_DPipe_IsrStatistics *statistics)
+{
+    if (stdif->getIsrStatistics != NULL_PTR)
+    {
+        stdif->getIsrStatistics(stdif->driver, statistics);
+    }
+    else
+    {
+        statistics->rxInterrupts = 0;
+        statistics->rxBytes      = 0;
+        statistics->txInterrupts = 0;
+        statistics->txBytes      = 0;
+    }
+}
+
+
 IFX_EXTERN void IfxStdIf_DPipe_print(IfxStdIf_DPipe *stdif, pchar format, ...);
 
 /** \} */
@@ -0,0 +1,607 @@
+/**
+ * \file Ifx_BatchProtocol.c
+ * \brief Binary batch command protocol for the shell
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <stddef.h>
+
+#include "Ifx_BatchProtocol.h"
+#include "Ifx_Telemetry.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/General/Ifx_GlobalResources.h"
+
+/** \brief Size of the packet header: type, sequence number, status */
+#define IFX_BATCHPROTOCOL_HEADER_SIZE   (3)
+
+/** \brief Size of the CRC */
+#define IFX_BATCHPROTOCOL_CRC_SIZE      (2)
+
+/** \brief Size of the stream packet header: type, timestamp */
+#define IFX_BATCHPROTOCOL_STREAM_HEADER (5)
+
+/** \brief Number of bytes read from the pipe at once */
+#define IFX_BATCHPROTOCOL_READ_SIZE     (32)
+
+/** \brief CRC-16/CCITT (polynomial 0x1021) of each nibble */
+static const uint16 Ifx_BatchProtocol_crcTable[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/** \brief Read a little endian 16 bit value */
+IFX_INLINE uint16 Ifx_BatchProtocol_getUInt16(const uint8 *data)
+{
+    return (uint16)(data[0] | ((uint16)data[1] << 8));
+}
+
+
+/** \brief Read a little endian 32 bit value */
+IFX_INLINE uint32 Ifx_BatchProtocol_getUInt32(const uint8 *data)
+{
+    return (uint32)data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24);
+}
+
+
+/** \brief Write a little endian 32 bit value */
+IFX_INLINE void Ifx_BatchProtocol_putUInt32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)value;
+    data[1] = (uint8)(value >> 8);
+    data[2] = (uint8)(value >> 16);
+    data[3] = (uint8)(value >> 24);
+}
+
+
+/** \brief Address of a request, relative to the address base */
+IFX_INLINE Ifx_AddressValue Ifx_BatchProtocol_getAddress(const Ifx_BatchProtocol *protocol, const uint8 *data)
+{
+    return (Ifx_AddressValue)((uint8 *)protocol->addressBase + Ifx_BatchProtocol_getUInt32(data));
+}
+
+
+/**
+ * \brief Copy size bytes from the target memory, little endian
+ * \param data Destination, any alignment
+ * \param address Source. 1, 2 or 4 bytes at an aligned address are read with one load of that width
+ * \param size Number of bytes
+ */
+static void Ifx_BatchProtocol_peek(uint8 *data, Ifx_AddressValue address, uint8 size)
+{
+    uint32 value;
+    uint8  i;
+
+    if ((size == 4) && (((uint32)(size_t)address & 3U) == 0))
+    {
+        value = *(volatile uint32 *)address;
+    }
+    else if ((size == 2) && (((uint32)(size_t)address & 1U) == 0))
+    {
+        value = *(volatile uint16 *)address;
+    }
+    else
+    {
+        for (i = 0; i < size; i++)
+        {
+            data[i] = ((volatile uint8 *)address)[i];
+        }
+
+        return;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        data[i] = (uint8)(value >> (i * 8));
+    }
+}
+
+
+/**
+ * \brief Copy size bytes to the target memory, little endian
+ * \param address Destination. 1, 2 or 4 bytes at an aligned address are written with one store of that width
+ * \param data Source, any alignment
+ * \param size Number of bytes
+ */
+static void Ifx_BatchProtocol_poke(Ifx_AddressValue address, const uint8 *data, uint8 size)
+{
+    uint8 i;
+
+    if ((size == 4) && (((uint32)(size_t)address & 3U) == 0))
+    {
+        *(volatile uint32 *)address = Ifx_BatchProtocol_getUInt32(data);
+    }
+    else if ((size == 2) && (((uint32)(size_t)address & 1U) == 0))
+    {
+        *(volatile uint16 *)address = Ifx_BatchProtocol_getUInt16(data);
+    }
+    else
+    {
+        for (i = 0; i < size; i++)
+        {
+            ((volatile uint8 *)address)[i] = data[i];
+        }
+    }
+}
+
+
+/** \brief Size of a stream packet with all the subscriptions, CRC included */
+static uint16 Ifx_BatchProtocol_getStreamSize(const Ifx_BatchProtocol *protocol)
+{
+    uint16 size = IFX_BATCHPROTOCOL_STREAM_HEADER + IFX_BATCHPROTOCOL_CRC_SIZE;
+    uint8  slot;
+
+    for (slot = 0; slot < IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS; slot++)
+    {
+        if (protocol->subscription[slot].size != 0)
+        {
+            size += (uint16)(1 + protocol->subscription[slot].size);
+        }
+    }
+
+    return size;
+}
+
+
+/**
+ * \brief Execute a subscribe request
+ * \param protocol Batch protocol object
+ * \param operands Slot, address, size and period
+ * \return Status of the request
+ */
+static Ifx_BatchProtocol_Status Ifx_BatchProtocol_subscribe(Ifx_BatchProtocol *protocol, const uint8 *operands)
+{
+    uint8                           slot = operands[0];
+    uint8                           size = operands[5];
+    Ifx_BatchProtocol_Subscription *subscription;
+    uint8                           previousSize;
+
+    if ((slot >= IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS) || (size == 0))
+    {
+        return Ifx_BatchProtocol_Status_invalidArgument;
+    }
+
+    subscription       = &protocol->subscription[slot];
+    previousSize       = subscription->size;
+    subscription->size = size;
+
+    if (Ifx_BatchProtocol_getStreamSize(protocol) > IFX_CFG_BATCHPROTOCOL_PACKET_SIZE)
+    {
+        /* All the subscriptions could not be streamed at once */
+        subscription->size = previousSize;
+        return Ifx_BatchProtocol_Status_invalidArgument;
+    }
+
+    subscription->address  = Ifx_BatchProtocol_getAddress(protocol, &operands[1]);
+    subscription->period   = Ifx_BatchProtocol_getUInt16(&operands[6]) * TimeConst_1ms;
+    subscription->deadline = now();
+    protocol->streamSize   = Ifx_BatchProtocol_getStreamSize(protocol);
+
+    return Ifx_BatchProtocol_Status_ok;
+}
+
+
+/** \brief Cancel all the subscriptions */
+static void Ifx_BatchProtocol_unsubscribeAll(Ifx_BatchProtocol *protocol)
+{
+    uint8 slot;
+
+    for (slot = 0; slot < IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS; slot++)
+    {
+        protocol->subscription[slot].size = 0;
+    }
+
+    protocol->streamSize = Ifx_BatchProtocol_getStreamSize(protocol);
+}
+
+
+/**
+ * \brief Encode a packet and write it to the pipe
+ * \param protocol Batch protocol object
+ * \param packet Packet, CRC included
+ * \param length Packet length in bytes
+ * \param timeout TIME_NULL: discard the packet if the pipe is full
+ * \return TRUE if the packet has been written
+ */
+static boolean Ifx_BatchProtocol_send(Ifx_BatchProtocol *protocol, const uint8 *packet, Ifx_SizeT length, Ifx_TickTime timeout)
+{
+    Ifx_SizeT count = Ifx_Telemetry_encodeCobs(protocol->txFrame, packet, length);
+
+    if ((timeout == TIME_NULL) && (IfxStdIf_DPipe_getWriteCount(protocol->io) < count))
+    {
+        return FALSE;
+    }
+
+    return IfxStdIf_DPipe_write(protocol->io, protocol->txFrame, &count, timeout);
+}
+
+
+/** \brief Send one stream packet with the due subscriptions */
+static void Ifx_BatchProtocol_stream(Ifx_BatchProtocol *protocol)
+{
+    Ifx_TickTime time     = now();
+    uint8       *packet   = protocol->packet;
+    uint8       *position = &packet[IFX_BATCHPROTOCOL_STREAM_HEADER];
+    uint16       crc;
+    uint8        slot;
+
+    for (slot = 0; slot < IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS; slot++)
+    {
+        Ifx_BatchProtocol_Subscription *subscription = &protocol->subscription[slot];
+
+        if ((subscription->size != 0) && (time >= subscription->deadline))
+        {
+            *position++ = slot;
+            Ifx_BatchProtocol_peek(position, subscription->address, subscription->size);
+            position   += subscription->size;
+
+            /* Keep the period, unless late by more than one period */
+            subscription->deadline += subscription->period;
+
+            if (subscription->deadline < time)
+            {
+                subscription->deadline = time + subscription->period;
+            }
+        }
+    }
+
+    if (position != &packet[IFX_BATCHPROTOCOL_STREAM_HEADER])
+    {
+        packet[0]   = IFX_BATCHPROTOCOL_PACKET_STREAM;
+        Ifx_BatchProtocol_putUInt32(&packet[1], (uint32)(time / TimeConst_1us));
+        crc         = Ifx_BatchProtocol_crc16(packet, (Ifx_SizeT)(position - packet));
+        *position++ = (uint8)crc;
+        *position++ = (uint8)(crc >> 8);
+
+        if (Ifx_BatchProtocol_send(protocol, packet, (Ifx_SizeT)(position - packet), TIME_NULL) == FALSE)
+        {
+            protocol->discarded++;
+        }
+    }
+}
+
+
+/** \brief Process the received frame: decode it in place, execute the requests and send the response */
+static void Ifx_BatchProtocol_receive(Ifx_BatchProtocol *protocol)
+{
+    Ifx_SizeT length = Ifx_Telemetry_decodeCobs(protocol->rxFrame, protocol->rxFrame, protocol->rxLength);
+
+    if (protocol->rxOverflow != FALSE)
+    {
+        length = -1;
+    }
+
+    length = Ifx_BatchProtocol_processPacket(protocol, protocol->rxFrame, length, protocol->packet);
+    Ifx_BatchProtocol_send(protocol, protocol->packet, length, TIME_INFINITE);
+
+    if (protocol->packet[2] != Ifx_BatchProtocol_Status_ok)
+    {
+        protocol->errors++;
+    }
+}
+
+
+/**
+ * \brief Initialize the configuration: absolute addresses.
+ * \param config Batch protocol configuration
+ * \param shell Shell running the protocol
+ * \return None
+ */
+void Ifx_BatchProtocol_initConfig(Ifx_BatchProtocol_Config *config, Ifx_Shell *shell)
+{
+    config->shell       = shell;
+    config->addressBase = NULL_PTR;
+}
+
+
+/**
+ * \brief Initialize the batch protocol object, without subscriptions.
+ * \param protocol Batch protocol object
+ * \param config Batch protocol configuration
+ * \return TRUE
+ */
+boolean Ifx_BatchProtocol_init(Ifx_BatchProtocol *protocol, const Ifx_BatchProtocol_Config *config)
+{
+    protocol->shell       = config->shell;
+    protocol->io          = NULL_PTR;
+    protocol->addressBase = config->addressBase;
+    protocol->rxLength    = 0;
+    protocol->rxOverflow  = FALSE;
+    protocol->errors      = 0;
+    protocol->discarded   = 0;
+    Ifx_BatchProtocol_unsubscribeAll(protocol);
+
+    return TRUE;
+}
+
+
+/**
+ * \brief Set the protocol of the shell configuration to the batch protocol.
+ * \param protocol Batch protocol object
+ * \param shellConfig Shell configuration, passed afterwards to Ifx_Shell_init()
+ * \return None
+ */
+void Ifx_BatchProtocol_initShellConfig(Ifx_BatchProtocol *protocol, Ifx_Shell_Config *shellConfig)
+{
+    shellConfig->protocol.start   = &Ifx_BatchProtocol_start;
+    shellConfig->protocol.execute = &Ifx_BatchProtocol_execute;
+    shellConfig->protocol.object  = protocol;
+}
+
+
+/**
+ * \brief Start the protocol, called by the shell on "protocol start".
+ *
+ * The bytes received until the first 0 byte are discarded.
+ * \param protocol Batch protocol object
+ * \param io Pipe of the shell
+ * \return TRUE
+ */
+boolean Ifx_BatchProtocol_start(void *protocol, IfxStdIf_DPipe *io)
+{
+    Ifx_BatchProtocol *batch = protocol;
+
+    batch->io           = io;
+    batch->rxLength     = 0;
+    batch->rxOverflow   = FALSE;
+    batch->synchronized = FALSE;
+    Ifx_BatchProtocol_unsubscribeAll(batch);
+
+    return TRUE;
+}
+
+
+/**
+ * \brief Receive and execute the request packets, then stream the due subscriptions.
+ *
+ * Called by Ifx_Shell_process() while the protocol is started. After a stop request, the pipe is not read any
+ * further: the bytes which follow the stop frame in the same read (at most IFX_BATCHPROTOCOL_READ_SIZE - 1) are
+ * dropped, the next ones are left to the text shell.
+ * \param protocol Batch protocol object
+ * \return None
+ */
+void Ifx_BatchProtocol_execute(void *protocol)
+{
+    Ifx_BatchProtocol *batch = protocol;
+    uint8              input[IFX_BATCHPROTOCOL_READ_SIZE];
+    Ifx_SizeT          count;
+    Ifx_SizeT          i;
+
+    do
+    {
+        count = IFX_BATCHPROTOCOL_READ_SIZE;
+        IfxStdIf_DPipe_read(batch->io, input, &count, TIME_NULL);
+
+        for (i = 0; i < count; i++)
+        {
+            if (input[i] == 0)
+            {
+                if ((batch->rxLength != 0) && (batch->synchronized != FALSE))
+                {
+                    Ifx_BatchProtocol_receive(batch);
+                }
+
+                batch->rxLength     = 0;
+                batch->rxOverflow   = FALSE;
+                batch->synchronized = TRUE;
+
+                if ((batch->shell != NULL_PTR) && (batch->shell->protocol.started == FALSE))
+                {
+                    /* stopped: back to the text shell */
+                    return;
+                }
+            }
+            else if (batch->rxLength < IFX_BATCHPROTOCOL_MAX_FRAME_SIZE)
+            {
+                batch->rxFrame[batch->rxLength++] = input[i];
+            }
+            else
+            {
+                batch->rxOverflow = TRUE;
+            }
+        }
+    } while (count == IFX_BATCHPROTOCOL_READ_SIZE);
+
+    if (batch->streamSize > (IFX_BATCHPROTOCOL_STREAM_HEADER + IFX_BATCHPROTOCOL_CRC_SIZE))
+    {
+        Ifx_BatchProtocol_stream(batch);
+    }
+}
+
+
+/**
+ * \brief Execute the requests of a request packet and build the response packet.
+ *
+ * Independent of the transport: used by Ifx_BatchProtocol_execute() with the decoded frames.
+ * The stop request switches the shell back to text mode, after the response is built.
+ * \param protocol Batch protocol object
+ * \param request Request packet, CRC included
+ * \param length Request packet length in bytes, negative if the frame could not be decoded
+ * \param response Response packet, IFX_CFG_BATCHPROTOCOL_PACKET_SIZE bytes
+ * \return Response packet length in bytes, CRC included
+ */
+Ifx_SizeT Ifx_BatchProtocol_processPacket(Ifx_BatchProtocol *protocol, const uint8 *request, Ifx_SizeT length, uint8 *response)
+{
+    const uint8             *end;
+    uint8                   *position = &response[IFX_BATCHPROTOCOL_HEADER_SIZE];
+    uint8                   *limit    = &response[IFX_CFG_BATCHPROTOCOL_PACKET_SIZE - IFX_BATCHPROTOCOL_CRC_SIZE - 1];
+    Ifx_BatchProtocol_Status status   = Ifx_BatchProtocol_Status_ok;
+    boolean                  stop     = FALSE;
+    uint16                   crc;
+
+    response[0] = IFX_BATCHPROTOCOL_PACKET_RESPONSE;
+    response[1] = (length >= 2) ? request[1] : 0;
+
+    if ((length < (2 + IFX_BATCHPROTOCOL_CRC_SIZE)) || (request[0] != IFX_BATCHPROTOCOL_PACKET_REQUEST))
+    {
+        response[2] = Ifx_BatchProtocol_Status_malformed;
+    }
+    else if (Ifx_BatchProtocol_crc16(request, length - IFX_BATCHPROTOCOL_CRC_SIZE) != Ifx_BatchProtocol_getUInt16(&request[length - IFX_BATCHPROTOCOL_CRC_SIZE]))
+    {
+        response[2] = Ifx_BatchProtocol_Status_crcError;
+    }
+    else
+    {
+        response[2] = Ifx_BatchProtocol_Status_ok;
+        end         = &request[length - IFX_BATCHPROTOCOL_CRC_SIZE];
+        request     = &request[2];
+
+        /* The last byte before the CRC is kept for the overflow status */
+        while ((request < end) && (status != Ifx_BatchProtocol_Status_malformed) && (status != Ifx_BatchProtocol_Status_unknownOpcode) && (status != Ifx_BatchProtocol_Status_overflow))
+        {
+            uint8        opcode    = request[0];
+            const uint8 *operands  = &request[1];
+            Ifx_SizeT    available = (Ifx_SizeT)(end - operands);
+            uint8        dataSize  = 0;
+            void        *resource;
+
+            status = Ifx_BatchProtocol_Status_ok;
+
+            switch (opcode)
+            {
+            case Ifx_BatchProtocol_Opcode_read:
+            case Ifx_BatchProtocol_Opcode_readResource:
+                request = &operands[5];
+
+                if (available < 5)
+                {
+                    status = Ifx_BatchProtocol_Status_malformed;
+                    break;
+                }
+
+                dataSize = operands[4];
+
+                if (opcode == Ifx_BatchProtocol_Opcode_read)
+                {
+                    resource = Ifx_BatchProtocol_getAddress(protocol, operands);
+                }
+                else
+                {
+                    resource = Ifx_GlobalResources_get(Ifx_BatchProtocol_getUInt16(operands));
+                    resource = (resource != NULL_PTR) ? ((uint8 *)resource + Ifx_BatchProtocol_getUInt16(&operands[2])) : NULL_PTR;
+                }
+
+                if ((resource == NULL_PTR) || (dataSize == 0))
+                {
+                    status = Ifx_BatchProtocol_Status_invalidArgument;
+                }
+                else if ((position + 1 + dataSize) > limit)
+                {
+                    status = Ifx_BatchProtocol_Status_overflow;
+                }
+                else
+                {
+                    Ifx_BatchProtocol_peek(&position[1], resource, dataSize);
+                }
+
+                break;
+            case Ifx_BatchProtocol_Opcode_write:
+                if ((available < 5) || (available < (5 + operands[4])))
+                {
+                    request = end;
+                    status  = Ifx_BatchProtocol_Status_malformed;
+                }
+                else
+                {
+                    request = &operands[5 + operands[4]];
+                    Ifx_BatchProtocol_poke(Ifx_BatchProtocol_getAddress(protocol, operands), &operands[5], operands[4]);
+                }
+
+                break;
+            case Ifx_BatchProtocol_Opcode_subscribe:
+                request = &operands[8];
+                status  = (available < 8) ? Ifx_BatchProtocol_Status_malformed : Ifx_BatchProtocol_subscribe(protocol, operands);
+                break;
+            case Ifx_BatchProtocol_Opcode_unsubscribe:
+                request = &operands[1];
+
+                if (available < 1)
+                {
+                    status = Ifx_BatchProtocol_Status_malformed;
+                }
+                else if (operands[0] >= IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS)
+                {
+                    status = Ifx_BatchProtocol_Status_invalidArgument;
+                }
+                else
+                {
+                    protocol->subscription[operands[0]].size = 0;
+                    protocol->streamSize                     = Ifx_BatchProtocol_getStreamSize(protocol);
+                }
+
+                break;
+            case Ifx_BatchProtocol_Opcode_stop:
+                request = operands;
+                stop    = TRUE;
+                break;
+            default:
+                status = Ifx_BatchProtocol_Status_unknownOpcode;
+                break;
+            }
+
+            *position = (uint8)status;
+            position  = &position[1 + ((status == Ifx_BatchProtocol_Status_ok) ? dataSize : 0)];
+
+            if ((position == limit) && (request < end))
+            {
+                /* No room for the result of the next request */
+                status      = Ifx_BatchProtocol_Status_overflow;
+                *position++ = (uint8)status;
+            }
+        }
+    }
+
+    crc         = Ifx_BatchProtocol_crc16(response, (Ifx_SizeT)(position - response));
+    *position++ = (uint8)crc;
+    *position++ = (uint8)(crc >> 8);
+
+    if (stop != FALSE)
+    {
+        Ifx_BatchProtocol_unsubscribeAll(protocol);
+
+        if (protocol->shell != NULL_PTR)
+        {
+            protocol->shell->protocol.started = FALSE;
+        }
+    }
+
+    return (Ifx_SizeT)(position - response);
+}
+
+
+/**
+ * \brief CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no final XOR.
+ * \param data Data
+ * \param length Data length in bytes
+ * \return CRC
+ */
+uint16 Ifx_BatchProtocol_crc16(const uint8 *data, Ifx_SizeT length)
+{
+    uint16    crc = 0xFFFFU;
+    Ifx_SizeT i;
+
+    for (i = 0; i < length; i++)
+    {
+        crc = (uint16)((crc << 4) ^ Ifx_BatchProtocol_crcTable[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16)((crc << 4) ^ Ifx_BatchProtocol_crcTable[(crc >> 12) ^ (data[i] & 0x0FU)]);
+    }
+
+    return crc;
+}
@@ -0,0 +1,172 @@
+/**
+ * \file Ifx_BatchProtocol.h
+ * \brief Binary batch command protocol for the shell
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_batchprotocol Batch protocol
+ * This module implements a binary protocol for the automation of the shell: test rigs read and write
+ * variables in batches, read the global resources (\ref library_srvsw_sysse_general_globalresources) and
+ * subscribe to variables streamed periodically, without text formatting and parsing on the target.
+ *
+ * The protocol is an \ref Ifx_Shell_Protocol: it is entered from the text shell with the command
+ * "protocol start" (\ref Ifx_Shell_protocolStart), and left with the request \ref Ifx_BatchProtocol_Opcode_stop.
+ * The bytes received in the same read of the pipe as the stop frame, after it, are dropped: the host waits for the
+ * response of the stop request before sending text commands.
+ *
+ * \code
+ *     Ifx_Shell                shell;
+ *     Ifx_Shell_Config         shellConfig;
+ *     Ifx_BatchProtocol        batch;
+ *     Ifx_BatchProtocol_Config batchConfig;
+ *
+ *     Ifx_BatchProtocol_initConfig(&batchConfig, &shell);
+ *     Ifx_BatchProtocol_init(&batch, &batchConfig);
+ *
+ *     Ifx_Shell_initConfig(&shellConfig);
+ *     Ifx_BatchProtocol_initShellConfig(&batch, &shellConfig);
+ *     shellConfig.standardIo     = &ascStdIf;
+ *     shellConfig.commandList[0] = commands;    // with {"protocol", "...", &shell, &Ifx_Shell_protocolStart}
+ *     Ifx_Shell_init(&shell, &shellConfig);
+ *
+ *     // background task, runs the text shell or the batch protocol
+ *     Ifx_Shell_process(&shell);
+ * \endcode
+ *
+ * \section library_srvsw_sysse_comm_batchprotocol_format Frame format
+ * Each packet is followed by its CRC (\ref Ifx_BatchProtocol_crc16, little endian), then COBS encoded and
+ * terminated by a 0 byte (\ref Ifx_Telemetry_encodeCobs). The bytes received before the first 0 byte, e.g. the
+ * prompt of the text shell, are discarded. All the values are little endian.
+ *
+ * Request packet: \ref IFX_BATCHPROTOCOL_PACKET_REQUEST, sequence number (uint8), then the requests, each one
+ * as its \ref Ifx_BatchProtocol_Opcode followed by its operands:
+ * - read: address (uint32), size (uint8)
+ * - write: address (uint32), size (uint8), size data bytes
+ * - readResource: resource ID (uint16), offset (uint16), size (uint8)
+ * - subscribe: slot (uint8), address (uint32), size (uint8), period in ms (uint16, 0: each call of Ifx_BatchProtocol_execute())
+ * - unsubscribe: slot (uint8)
+ * - stop: no operand
+ *
+ * Response packet, one per request packet: \ref IFX_BATCHPROTOCOL_PACKET_RESPONSE, sequence number of the request,
+ * \ref Ifx_BatchProtocol_Status of the packet, then, if the packet is valid, one result per request, in order:
+ * the \ref Ifx_BatchProtocol_Status of the request, followed by the data for the successful reads.
+ * The requests are executed in order until the first one which is not valid (malformed, unknown opcode) or
+ * whose result does not fit in the response (overflow).
+ *
+ * Stream packet, sent by Ifx_BatchProtocol_execute() when subscriptions are due: \ref IFX_BATCHPROTOCOL_PACKET_STREAM,
+ * timestamp in us (uint32), then, for each due subscription, its slot (uint8) followed by its data.
+ *
+ * Accesses of 1, 2 or 4 bytes to aligned addresses are done with one load or store of that width, so that
+ * peripheral registers can be read and written; the other accesses are done byte by byte.
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_BATCHPROTOCOL_H
+#define IFX_BATCHPROTOCOL_H 1
+
+#include "Ifx_Shell.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_BATCHPROTOCOL_PACKET_SIZE)
+#define IFX_CFG_BATCHPROTOCOL_PACKET_SIZE   (256)  /**<\brief Maximum size of a packet, CRC included */
+#endif
+
+#if !defined(IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS)
+#define IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS (8)    /**<\brief Number of subscription slots */
+#endif
+
+#define IFX_BATCHPROTOCOL_PACKET_REQUEST    (0x01U) /**<\brief Packet type: requests from the host */
+#define IFX_BATCHPROTOCOL_PACKET_RESPONSE   (0x81U) /**<\brief Packet type: results of a request packet */
+#define IFX_BATCHPROTOCOL_PACKET_STREAM     (0x82U) /**<\brief Packet type: data of the due subscriptions */
+
+/** \brief Maximum size of a COBS encoded packet, 0 terminator included */
+#define IFX_BATCHPROTOCOL_MAX_FRAME_SIZE    (IFX_CFG_BATCHPROTOCOL_PACKET_SIZE + (IFX_CFG_BATCHPROTOCOL_PACKET_SIZE / 254) + 2)
+
+/** \brief Request opcodes */
+typedef enum
+{
+    Ifx_BatchProtocol_Opcode_read         = 1,  /**<\brief Read bytes at an address */
+    Ifx_BatchProtocol_Opcode_write        = 2,  /**<\brief Write bytes at an address */
+    Ifx_BatchProtocol_Opcode_readResource = 3,  /**<\brief Read bytes of a global resource */
+    Ifx_BatchProtocol_Opcode_subscribe    = 4,  /**<\brief Stream bytes at an address periodically */
+    Ifx_BatchProtocol_Opcode_unsubscribe  = 5,  /**<\brief Stop the stream of a subscription slot */
+    Ifx_BatchProtocol_Opcode_stop         = 6   /**<\brief Cancel the subscriptions and return to the text shell */
+} Ifx_BatchProtocol_Opcode;
+
+/** \brief Status of a packet or of a request */
+typedef enum
+{
+    Ifx_BatchProtocol_Status_ok              = 0,   /**<\brief Success */
+    Ifx_BatchProtocol_Status_crcError        = 1,   /**<\brief Packet: wrong CRC */
+    Ifx_BatchProtocol_Status_malformed       = 2,   /**<\brief Packet: invalid framing or type. Request: operands missing */
+    Ifx_BatchProtocol_Status_unknownOpcode   = 3,   /**<\brief Request: unknown opcode */
+    Ifx_BatchProtocol_Status_invalidArgument = 4,   /**<\brief Request: size, slot or resource ID out of range */
+    Ifx_BatchProtocol_Status_overflow        = 5    /**<\brief Request: the result does not fit in the response */
+} Ifx_BatchProtocol_Status;
+
+/** \brief Subscription */
+typedef struct
+{
+    Ifx_AddressValue address;   /**<\brief Address of the data */
+    uint8            size;      /**<\brief Number of bytes, 0 if the slot is free */
+    Ifx_TickTime     period;    /**<\brief Period */
+    Ifx_TickTime     deadline;  /**<\brief Time of the next packet */
+} Ifx_BatchProtocol_Subscription;
+
+/** \brief Batch protocol configuration */
+typedef struct
+{
+    Ifx_Shell       *shell;         /**<\brief Shell running the protocol, switched back to text mode by the stop request */
+    Ifx_AddressValue addressBase;   /**<\brief Added to the addresses of the requests. NULL_PTR: absolute addresses */
+} Ifx_BatchProtocol_Config;
+
+/** \brief Batch protocol object */
+typedef struct
+{
+    Ifx_Shell                     *shell;                                              /**<\brief Shell running the protocol */
+    IfxStdIf_DPipe                *io;                                                 /**<\brief Pointer to IfxStdIf_DPipe object, set on start */
+    Ifx_AddressValue               addressBase;                                        /**<\brief Added to the addresses of the requests */
+    Ifx_SizeT                      rxLength;                                           /**<\brief Number of bytes in rxFrame */
+    boolean                        rxOverflow;                                         /**<\brief The frame being received is too long */
+    boolean                        synchronized;                                       /**<\brief A 0 byte has been received since the start */
+    uint16                         streamSize;                                         /**<\brief Size of a stream packet with all the subscriptions */
+    uint32                         errors;                                             /**<\brief Number of request packets rejected */
+    uint32                         discarded;                                          /**<\brief Number of stream packets discarded because the pipe was full */
+    Ifx_BatchProtocol_Subscription subscription[IFX_CFG_BATCHPROTOCOL_SUBSCRIPTIONS]; /**<\brief Subscription slots */
+    uint8                          rxFrame[IFX_BATCHPROTOCOL_MAX_FRAME_SIZE];          /**<\brief Frame being received, decoded in place */
+    uint8                          packet[IFX_CFG_BATCHPROTOCOL_PACKET_SIZE];          /**<\brief Packet being sent */
+    uint8                          txFrame[IFX_BATCHPROTOCOL_MAX_FRAME_SIZE];          /**<\brief Frame being sent */
+} Ifx_BatchProtocol;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_batchprotocol
+ * \{ */
+
+IFX_EXTERN void      Ifx_BatchProtocol_initConfig(Ifx_BatchProtocol_Config *config, Ifx_Shell *shell);
+IFX_EXTERN boolean   Ifx_BatchProtocol_init(Ifx_BatchProtocol *protocol, const Ifx_BatchProtocol_Config *config);
+IFX_EXTERN void      Ifx_BatchProtocol_initShellConfig(Ifx_BatchProtocol *protocol, Ifx_Shell_Config *shellConfig);
+IFX_EXTERN boolean   Ifx_BatchProtocol_start(void *protocol, IfxStdIf_DPipe *io);
+IFX_EXTERN void      Ifx_BatchProtocol_execute(void *protocol);
+IFX_EXTERN Ifx_SizeT Ifx_BatchProtocol_processPacket(Ifx_BatchProtocol *protocol, const uint8 *request, Ifx_SizeT length, uint8 *response);
+IFX_EXTERN uint16    Ifx_BatchProtocol_crc16(const uint8 *data, Ifx_SizeT length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
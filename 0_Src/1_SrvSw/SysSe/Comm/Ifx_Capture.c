@@ -0,0 +1,378 @@
+/**
+ * \file Ifx_Capture.c
+ * \brief Streaming capture of ADC results
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+
+#include <math.h>
+
+#include "Ifx_Capture.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Store a sample into the ring buffer, timestamp the frame when complete */
+IFX_INLINE void Ifx_Capture_store(Ifx_Capture *capture, sint16 sample)
+{
+    uint32 writeCount = capture->writeCount;
+
+    if ((writeCount - capture->readCount) < capture->size)
+    {
+        __dsync();          /* the space released by the reader is not read anymore */
+        capture->buffer[writeCount & capture->mask] = sample;
+        writeCount++;
+
+        if ((capture->timestamps != NULL_PTR) && ((writeCount % IFX_CAPTURE_FRAME_SIZE) == 0))
+        {
+            capture->timestamps[((writeCount - 1) & capture->mask) / IFX_CAPTURE_FRAME_SIZE] = now();
+        }
+
+        __dsync();          /* the sample is written before it is published to the reader */
+        capture->writeCount = writeCount;
+    }
+    else
+    {
+        capture->overflows++;
+    }
+}
+
+
+/** \brief Start an update of the statistics, see Ifx_Capture_getStatistics() */
+IFX_INLINE void Ifx_Capture_beginUpdate(Ifx_Capture *capture)
+{
+    capture->sequence = capture->sequence + 1;
+    __dsync();              /* the update is started before the statistics are written */
+}
+
+
+/** \brief Complete an update of the statistics, see Ifx_Capture_getStatistics() */
+IFX_INLINE void Ifx_Capture_endUpdate(Ifx_Capture *capture)
+{
+    __dsync();              /* the statistics are written before the update is completed */
+    capture->sequence = capture->sequence + 1;
+}
+
+
+/** \brief Process one result: limit check, statistics and decimation */
+IFX_INLINE void Ifx_Capture_process(Ifx_Capture *capture, sint16 result)
+{
+    if ((result >= capture->lowerLimit) && (result <= capture->upperLimit))
+    {
+        Ifx_Capture_Statistics_add(&capture->statistics, result);
+
+        capture->accumulator += result;
+        capture->accumulated++;
+
+        if (capture->accumulated >= capture->decimation)
+        {
+            Ifx_Capture_store(capture, (sint16)(capture->accumulator / (sint32)capture->decimation));
+            capture->accumulator = 0;
+            capture->accumulated = 0;
+        }
+    }
+    else
+    {
+        capture->rejected++;
+    }
+}
+
+
+/**
+ * \brief Initialize the configuration: no decimation, all the results accepted.
+ * \param config Capture configuration
+ * \param buffer Ring buffer of bufferSize samples
+ * \param timestamps Timestamps of bufferSize / IFX_CAPTURE_FRAME_SIZE frames, or NULL_PTR
+ * \param bufferSize Number of samples of the buffer: power of 2, at least IFX_CAPTURE_FRAME_SIZE
+ * \return None
+ */
+void Ifx_Capture_initConfig(Ifx_Capture_Config *config, sint16 *buffer, Ifx_TickTime *timestamps, uint16 bufferSize)
+{
+    config->buffer     = buffer;
+    config->timestamps = timestamps;
+    config->bufferSize = bufferSize;
+    config->decimation = 1;
+    config->lowerLimit = -32768;
+    config->upperLimit = 32767;
+}
+
+
+/**
+ * \brief Initialize the capture object, with empty ring buffer and statistics.
+ * \param capture Capture object
+ * \param config Capture configuration
+ * \return FALSE if the buffer size or the decimation is out of range. The ring buffer has then no capacity:
+ * every sample is counted in overflows, and nothing is read or exported
+ */
+boolean Ifx_Capture_init(Ifx_Capture *capture, const Ifx_Capture_Config *config)
+{
+    uint32  size   = config->bufferSize;
+    boolean result = (size >= IFX_CAPTURE_FRAME_SIZE) && ((size & (size - 1)) == 0)
+                     && (config->decimation >= 1) && (config->decimation <= IFX_CAPTURE_MAX_DECIMATION);
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result);
+
+    capture->buffer      = config->buffer;
+    capture->timestamps  = config->timestamps;
+    capture->size        = result ? size : 0;
+    capture->mask        = result ? (size - 1) : 0;
+    capture->decimation  = result ? config->decimation : 1;
+    capture->accumulated = 0;
+    capture->accumulator = 0;
+    capture->lowerLimit  = config->lowerLimit;
+    capture->upperLimit  = config->upperLimit;
+    capture->writeCount  = 0;
+    capture->readCount   = 0;
+    capture->overflows   = 0;
+    capture->rejected    = 0;
+    capture->sequence    = 0;
+    Ifx_Capture_Statistics_reset(&capture->statistics);
+
+    return result;
+}
+
+
+/**
+ * \brief Process a result. To be called from the result interrupt.
+ * \param capture Capture object
+ * \param result ADC result
+ * \return None
+ */
+void Ifx_Capture_add(Ifx_Capture *capture, sint16 result)
+{
+    Ifx_Capture_beginUpdate(capture);
+    Ifx_Capture_process(capture, result);
+    Ifx_Capture_endUpdate(capture);
+}
+
+
+/**
+ * \brief Process a block of results, e.g. moved by DMA. Same as Ifx_Capture_add() for each result.
+ * \param capture Capture object
+ * \param results count ADC results
+ * \param count Number of results
+ * \return None
+ */
+void Ifx_Capture_addBlock(Ifx_Capture *capture, const sint16 *results, uint32 count)
+{
+    uint32 i;
+
+    /* The statistics are published once for the whole block */
+    Ifx_Capture_beginUpdate(capture);
+
+    for (i = 0; i < count; i++)
+    {
+        Ifx_Capture_process(capture, results[i]);
+    }
+
+    Ifx_Capture_endUpdate(capture);
+}
+
+
+/**
+ * \brief Return the number of samples in the ring buffer.
+ * \param capture Capture object
+ * \return Number of samples available to Ifx_Capture_read()
+ */
+uint32 Ifx_Capture_getCount(const Ifx_Capture *capture)
+{
+    return capture->writeCount - capture->readCount;
+}
+
+
+/**
+ * \brief Read the oldest samples from the ring buffer.
+ * \param capture Capture object
+ * \param samples Buffer for count samples
+ * \param count Maximal number of samples read
+ * \return Number of samples read
+ */
+uint32 Ifx_Capture_read(Ifx_Capture *capture, sint16 *samples, uint32 count)
+{
+    uint32 readCount = capture->readCount;
+    uint32 available = capture->writeCount - readCount;
+    uint32 i;
+
+    count = __minu(count, available);
+    __dsync();              /* the samples published by the writer are visible */
+
+    for (i = 0; i < count; i++)
+    {
+        samples[i] = capture->buffer[(readCount + i) & capture->mask];
+    }
+
+    __dsync();              /* the samples are read before the space is released to the writer */
+    capture->readCount = readCount + count;
+
+    return count;
+}
+
+
+/**
+ * \brief Discard the samples of the ring buffer. Called by the reader.
+ * \param capture Capture object
+ * \return None
+ */
+void Ifx_Capture_clear(Ifx_Capture *capture)
+{
+    capture->readCount = capture->writeCount;
+}
+
+
+/**
+ * \brief Return a consistent copy of the statistics, while Ifx_Capture_add() may update them.
+ * Must not be called from a context which interrupts Ifx_Capture_add().
+ * \param capture Capture object
+ * \param statistics Copy of the statistics
+ * \return None
+ */
+void Ifx_Capture_getStatistics(const Ifx_Capture *capture, Ifx_Capture_Statistics *statistics)
+{
+    uint32 sequence;
+
+    do
+    {
+        sequence = capture->sequence;
+        __dsync();          /* the statistics are read after the sequence */
+        *statistics = capture->statistics;
+        __dsync();          /* the statistics are read before the sequence is checked */
+    } while (((sequence & 1) != 0) || (sequence != capture->sequence));
+}
+
+
+/**
+ * \brief Add the telemetry channel of the capture.
+ * \param capture Capture object
+ * \param telemetry Telemetry object
+ * \param name Channel name. Must stay valid as long as the telemetry object is used
+ * \return Channel index used by Ifx_Capture_export(), or -1 if no channel is available
+ */
+sint32 Ifx_Capture_addChannel(Ifx_Capture *capture, Ifx_Telemetry *telemetry, pchar name)
+{
+    Ifx_Telemetry_ChannelConfig config;
+
+    (void)capture;
+    config.name          = name;
+    config.type          = Ifx_Telemetry_Type_sint16;
+    config.count         = IFX_CAPTURE_FRAME_SIZE;
+    config.deltaEncoding = TRUE;
+
+    return Ifx_Telemetry_addChannel(telemetry, &config);
+}
+
+
+/**
+ * \brief Send the complete frames of the ring buffer, as long as the standard interface can take them.
+ * To be called periodically from the background. Incomplete frames are kept for the next call.
+ * \param capture Capture object
+ * \param telemetry Telemetry object
+ * \param channel Channel index returned by Ifx_Capture_addChannel()
+ * \return Number of samples sent
+ */
+uint32 Ifx_Capture_export(Ifx_Capture *capture, Ifx_Telemetry *telemetry, sint32 channel)
+{
+    uint32 readCount = capture->readCount;
+    uint32 frames    = (capture->writeCount - readCount) / IFX_CAPTURE_FRAME_SIZE;
+    uint32 sent      = 0;
+
+    __dsync();              /* the frames published by the writer are visible */
+
+    while (sent < frames)
+    {
+        uint32       index = readCount & capture->mask;
+        Ifx_TickTime timestamp;
+
+        if (capture->timestamps != NULL_PTR)
+        {
+            timestamp = capture->timestamps[index / IFX_CAPTURE_FRAME_SIZE];
+        }
+        else
+        {
+            timestamp = now();
+        }
+
+        /* The frames do not wrap, the buffer size is a multiple of the frame size */
+        if (Ifx_Telemetry_writeAt(telemetry, channel, timestamp, &capture->buffer[index]) == FALSE)
+        {
+            break;
+        }
+
+        readCount          += IFX_CAPTURE_FRAME_SIZE;
+        __dsync();          /* the frame is read before the space is released to the writer */
+        capture->readCount  = readCount;
+        sent++;
+    }
+
+    return sent * IFX_CAPTURE_FRAME_SIZE;
+}
+
+
+/**
+ * \brief Clear the statistics.
+ * \param statistics Statistics
+ * \return None
+ */
+void Ifx_Capture_Statistics_reset(Ifx_Capture_Statistics *statistics)
+{
+    statistics->count        = 0;
+    statistics->min          = 32767;
+    statistics->max          = -32768;
+    statistics->sum          = 0;
+    statistics->sumOfSquares = 0;
+}
+
+
+/**
+ * \brief Update the statistics with a result.
+ * \param statistics Statistics
+ * \param result Result
+ * \return None
+ */
+void Ifx_Capture_Statistics_add(Ifx_Capture_Statistics *statistics, sint16 result)
+{
+    statistics->count++;
+    statistics->min           = (sint16)__min(statistics->min, result);
+    statistics->max           = (sint16)__max(statistics->max, result);
+    statistics->sum          += result;
+    statistics->sumOfSquares += (uint64)((sint32)result * (sint32)result);
+}
+
+
+/**
+ * \brief Return the mean of the results.
+ * \param statistics Statistics
+ * \return Mean, 0 if there is no result
+ */
+float32 Ifx_Capture_Statistics_getMean(const Ifx_Capture_Statistics *statistics)
+{
+    return (statistics->count != 0) ? ((float32)statistics->sum / (float32)statistics->count) : 0.0f;
+}
+
+
+/**
+ * \brief Return the root mean square of the results.
+ * \param statistics Statistics
+ * \return RMS, 0 if there is no result
+ */
+float32 Ifx_Capture_Statistics_getRms(const Ifx_Capture_Statistics *statistics)
+{
+    return (statistics->count != 0) ? sqrtf((float32)statistics->sumOfSquares / (float32)statistics->count) : 0.0f;
+}
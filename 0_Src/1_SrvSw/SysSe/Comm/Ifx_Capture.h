@@ -0,0 +1,144 @@
+/**
+ * \file Ifx_Capture.h
+ * \brief Streaming capture of ADC results
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_capture Capture
+ * This module captures the results of one ADC channel, typically from the result interrupt,
+ * and streams them to the host with \ref library_srvsw_sysse_comm_telemetry.
+ *
+ * Each result is processed as it arrives, in constant time:
+ * - results outside of the window lowerLimit .. upperLimit are counted and discarded
+ * - the statistics (count, min, max, mean, RMS) are updated with the accepted results
+ * - decimation accepted results are averaged into one sample, stored into a ring buffer
+ *
+ * The ring buffer is written by Ifx_Capture_add() and read by Ifx_Capture_read() or Ifx_Capture_export(),
+ * which may run in another context without locking (one writer, one reader). When the ring buffer is full,
+ * the new samples are discarded and counted in overflows.
+ *
+ * The statistics are updated by Ifx_Capture_add() under a sequence counter: the other contexts read them
+ * with Ifx_Capture_getStatistics(), which retries until it gets a consistent copy.
+ *
+ * Ifx_Capture_export() sends the samples in packets of \ref IFX_CAPTURE_FRAME_SIZE samples on a telemetry
+ * channel of type sint16 with \ref IFX_CAPTURE_FRAME_SIZE values, timestamped when the last sample of the
+ * packet was stored. The stream is decoded on the host by 1_ToolEnv/1_Host/Tools/Ifx_TelemetryDecode.c,
+ * each CSV line holds \ref IFX_CAPTURE_FRAME_SIZE consecutive samples.
+ *
+ * \code
+ *     Ifx_Capture            capture;
+ *     Ifx_Capture_Config     config;
+ *     Ifx_Capture_Statistics statistics;
+ *     sint16                 buffer[256];
+ *     Ifx_TickTime           timestamps[256 / IFX_CAPTURE_FRAME_SIZE];
+ *     sint32                 channel;
+ *
+ *     Ifx_Capture_initConfig(&config, buffer, timestamps, 256);
+ *     config.decimation = 4;
+ *     Ifx_Capture_init(&capture, &config);
+ *     channel = Ifx_Capture_addChannel(&capture, &telemetry, "dsadc0");
+ *
+ *     // result interrupt
+ *     Ifx_Capture_add(&capture, (sint16)DSADC_RESM0.B.RESULT);
+ *
+ *     // background task
+ *     Ifx_Capture_export(&capture, &telemetry, channel);
+ *     Ifx_Capture_getStatistics(&capture, &statistics);
+ *     mean = Ifx_Capture_Statistics_getMean(&statistics);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_CAPTURE_H
+#define IFX_CAPTURE_H 1
+
+#include "Ifx_Telemetry.h"
+
+//----------------------------------------------------------------------------------------
+/** \brief Number of samples sent in one telemetry packet */
+#define IFX_CAPTURE_FRAME_SIZE     (IFX_CFG_TELEMETRY_MAX_VALUES)
+
+/** \brief Maximal number of results averaged into one sample */
+#define IFX_CAPTURE_MAX_DECIMATION (0x8000U)
+
+/** \brief Statistics of the accepted results, updated in constant time by each result */
+typedef struct
+{
+    uint32 count;           /**<\brief Number of results */
+    sint16 min;             /**<\brief Lowest result, valid if count != 0 */
+    sint16 max;             /**<\brief Highest result, valid if count != 0 */
+    sint64 sum;             /**<\brief Sum of the results */
+    uint64 sumOfSquares;    /**<\brief Sum of the squares of the results */
+} Ifx_Capture_Statistics;
+
+/** \brief Capture configuration */
+typedef struct
+{
+    sint16       *buffer;       /**<\brief Ring buffer of bufferSize samples */
+    Ifx_TickTime *timestamps;   /**<\brief Timestamp of each frame of the ring buffer, bufferSize / IFX_CAPTURE_FRAME_SIZE items. NULL_PTR: timestamped on export */
+    uint16        bufferSize;   /**<\brief Number of samples of the buffer: power of 2, at least IFX_CAPTURE_FRAME_SIZE */
+    uint16        decimation;   /**<\brief Number of results averaged into one sample, 1 .. IFX_CAPTURE_MAX_DECIMATION */
+    sint16        lowerLimit;   /**<\brief Lowest accepted result */
+    sint16        upperLimit;   /**<\brief Highest accepted result */
+} Ifx_Capture_Config;
+
+/** \brief Capture object. Ifx_Capture_add() and the reading functions may run in different contexts */
+typedef struct
+{
+    sint16                *buffer;         /**<\brief Ring buffer */
+    Ifx_TickTime          *timestamps;     /**<\brief Timestamps of the frames of the ring buffer, or NULL_PTR */
+    uint32                 size;           /**<\brief bufferSize, 0 if the initialisation failed: every sample overflows */
+    uint32                 mask;           /**<\brief bufferSize - 1 */
+    uint16                 decimation;     /**<\brief Number of results averaged into one sample */
+    uint16                 accumulated;    /**<\brief Number of results in accumulator */
+    sint32                 accumulator;    /**<\brief Sum of the results of the current sample */
+    sint16                 lowerLimit;     /**<\brief Lowest accepted result */
+    sint16                 upperLimit;     /**<\brief Highest accepted result */
+    volatile uint32        writeCount;     /**<\brief Number of samples stored, written by Ifx_Capture_add() only */
+    volatile uint32        readCount;      /**<\brief Number of samples read, written by the reading functions only */
+    uint32                 overflows;      /**<\brief Number of samples discarded because the ring buffer was full */
+    uint32                 rejected;       /**<\brief Number of results discarded because out of the limits */
+    Ifx_Capture_Statistics statistics;     /**<\brief Statistics of the accepted results, see Ifx_Capture_getStatistics() */
+    volatile uint32        sequence;       /**<\brief Incremented before and after each update of statistics, odd during the update */
+} Ifx_Capture;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_capture
+ * \{ */
+
+IFX_EXTERN void    Ifx_Capture_initConfig(Ifx_Capture_Config *config, sint16 *buffer, Ifx_TickTime *timestamps, uint16 bufferSize);
+IFX_EXTERN boolean Ifx_Capture_init(Ifx_Capture *capture, const Ifx_Capture_Config *config);
+IFX_EXTERN void    Ifx_Capture_add(Ifx_Capture *capture, sint16 result);
+IFX_EXTERN void    Ifx_Capture_addBlock(Ifx_Capture *capture, const sint16 *results, uint32 count);
+IFX_EXTERN uint32  Ifx_Capture_getCount(const Ifx_Capture *capture);
+IFX_EXTERN uint32  Ifx_Capture_read(Ifx_Capture *capture, sint16 *samples, uint32 count);
+IFX_EXTERN void    Ifx_Capture_clear(Ifx_Capture *capture);
+IFX_EXTERN void    Ifx_Capture_getStatistics(const Ifx_Capture *capture, Ifx_Capture_Statistics *statistics);
+IFX_EXTERN sint32  Ifx_Capture_addChannel(Ifx_Capture *capture, Ifx_Telemetry *telemetry, pchar name);
+IFX_EXTERN uint32  Ifx_Capture_export(Ifx_Capture *capture, Ifx_Telemetry *telemetry, sint32 channel);
+
+IFX_EXTERN void    Ifx_Capture_Statistics_reset(Ifx_Capture_Statistics *statistics);
+IFX_EXTERN void    Ifx_Capture_Statistics_add(Ifx_Capture_Statistics *statistics, sint16 result);
+IFX_EXTERN float32 Ifx_Capture_Statistics_getMean(const Ifx_Capture_Statistics *statistics);
+IFX_EXTERN float32 Ifx_Capture_Statistics_getRms(const Ifx_Capture_Statistics *statistics);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
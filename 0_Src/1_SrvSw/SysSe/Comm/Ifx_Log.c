@@ -0,0 +1,253 @@
+/**
+ * \file Ifx_Log.c
+ * \brief Multi-core deferred logging
+ *
+ * \version iLLD_1_0_0_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+
+#include "Ifx_Log.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Size in bytes of a message without arguments */
+#define IFX_LOG_HEADER_SIZE ((Ifx_SizeT)offsetof(Ifx_Log_Message, args))
+
+Ifx_Log Ifx_g_log;
+
+/**
+ * \brief Write the pending message to the standard interface without waiting.
+ * Only the bytes accepted by the tx buffer are written, the rest is written by the next call.
+ * \retval TRUE if the pending message is completely written
+ * \retval FALSE if the standard interface has no space left
+ */
+static boolean Ifx_Log_flush(void)
+{
+    IfxStdIf_DPipe *io    = Ifx_g_log.standardIo;
+    Ifx_SizeT       count = Ifx_g_log.pendingLength - Ifx_g_log.pendingOffset;
+
+    if (io->txDisabled)
+    {
+        count = 0;
+        Ifx_g_log.pendingOffset = Ifx_g_log.pendingLength;
+    }
+    else
+    {
+        count = (Ifx_SizeT)__min(count, __max(IfxStdIf_DPipe_getWriteCount(io), 0));
+    }
+
+    if (count > 0)
+    {
+        IfxStdIf_DPipe_write(io, (void *)&Ifx_g_log.pending[Ifx_g_log.pendingOffset], &count, TIME_NULL);
+        Ifx_g_log.pendingOffset += count;
+    }
+
+    return Ifx_g_log.pendingOffset == Ifx_g_log.pendingLength;
+}
+
+
+/**
+ * \brief Format a message and write it to the standard interface without waiting.
+ * \param format printf-compatible formatted string.
+ * \param args the IFX_LOG_MAX_ARGS arguments, the unused ones are ignored by the format
+ * \retval TRUE if the message is completely written
+ * \retval FALSE if a part of the message is kept pending, see Ifx_Log_flush()
+ */
+static boolean Ifx_Log_output(pchar format, const uint32 *args)
+{
+    sint32 length = snprintf(Ifx_g_log.pending, sizeof(Ifx_g_log.pending), format, args[0], args[1], args[2], args[3], args[4], args[5]);
+
+    Ifx_g_log.pendingLength = (Ifx_SizeT)__min(__max(length, 0), STDIF_DPIPE_MAX_PRINT_SIZE);
+    Ifx_g_log.pendingOffset = 0;
+
+    return Ifx_Log_flush();
+}
+
+
+/**
+ * \brief Initialize the \ref Ifx_g_log object.
+ * Must be called before any other function of the module, while no other core logs.
+ * \param standardIo Pointer to the IfxStdIf_DPipe object used by Ifx_Log_process(). Any tx buffer size
+ * is supported: a message which does not fit is written in several parts.
+ */
+void Ifx_Log_init(IfxStdIf_DPipe *standardIo)
+{
+    uint32 i;
+
+    Ifx_g_log.standardIo    = standardIo;
+    Ifx_g_log.pendingOffset = 0;
+    Ifx_g_log.pendingLength = 0;
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        Ifx_Log_Ring *ring = &Ifx_g_log.ring[i];
+        ring->discarded         = 0;
+        ring->discardedReported = 0;
+        ring->fifo              = Ifx_Fifo_initMode(ring->buffer, IFX_CFG_LOG_BUFFER_SIZE, sizeof(uint32), Ifx_Fifo_Mode_spsc);
+    }
+}
+
+
+/**
+ * \brief Store a message into the ring buffer of the calling core.
+ * \param format printf-compatible formatted string, see \ref library_srvsw_sysse_comm_log for restrictions.
+ * \param argCount number of arguments, at most \ref IFX_LOG_MAX_ARGS
+ * \param ... 32 bit arguments
+ * \retval TRUE if the message is stored
+ * \retval FALSE if the ring buffer is full, the message is discarded.
+ */
+boolean Ifx_Log_write(pchar format, uint32 argCount, ...)
+{
+    uint32  args[IFX_LOG_MAX_ARGS];
+    uint32  i;
+    va_list list;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, argCount <= IFX_LOG_MAX_ARGS);
+    argCount = __minu(argCount, IFX_LOG_MAX_ARGS);
+
+    va_start(list, argCount);
+
+    for (i = 0; i < argCount; i++)
+    {
+        args[i] = va_arg(list, uint32);
+    }
+
+    va_end(list);
+
+    return Ifx_Log_writeArgs(format, argCount, args);
+}
+
+
+/**
+ * \brief Store a message into the ring buffer of the calling core.
+ * \param format printf-compatible formatted string, see \ref library_srvsw_sysse_comm_log for restrictions.
+ * \param argCount number of arguments, at most \ref IFX_LOG_MAX_ARGS
+ * \param args 32 bit arguments
+ * \retval TRUE if the message is stored
+ * \retval FALSE if the ring buffer is full, the message is discarded.
+ */
+boolean Ifx_Log_writeArgs(pchar format, uint32 argCount, const uint32 *args)
+{
+    Ifx_Log_Ring   *ring   = &Ifx_g_log.ring[IfxCpu_getCoreIndex()];
+    boolean         result = FALSE;
+    Ifx_Log_Message message;
+    Ifx_SizeT       size;
+    uint32          i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, argCount <= IFX_LOG_MAX_ARGS);
+    argCount         = __minu(argCount, IFX_LOG_MAX_ARGS);
+    message.format   = format;
+    message.argCount = argCount;
+
+    for (i = 0; i < argCount; i++)
+    {
+        message.args[i] = args[i];
+    }
+
+    size = (Ifx_SizeT)(IFX_LOG_HEADER_SIZE + (argCount * sizeof(uint32)));
+
+    if (ring->fifo != NULL_PTR)
+    {
+        /* The ring has a single writer: only the interrupts of this core are disabled, the message is published at once */
+        Ifx_Fifo_Span span[2];
+        boolean       interruptState = IfxCpu_disableInterrupts();
+
+        if (Ifx_Fifo_reserveWrite(ring->fifo, span, size) == size)
+        {
+            Ifx_SizeT first = __min(size, span[0].length);
+            memcpy(span[0].data, &message, first);
+
+            if (size > first)
+            {
+                memcpy(span[1].data, (uint8 *)&message + first, size - first);
+            }
+
+            Ifx_Fifo_commitWrite(ring->fifo, size);
+            result = TRUE;
+        }
+        else
+        {
+            ring->discarded++;
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    return result;
+}
+
+
+/**
+ * \brief Format the stored messages of all the cores and write them to the standard interface.
+ * Must be called periodically from a single task. The function does not wait: it stops when
+ * the tx buffer of the standard interface is full. The rest of the current message is written
+ * first by the next call.
+ * \return number of messages processed
+ */
+uint32 Ifx_Log_process(void)
+{
+    IfxStdIf_DPipe *io    = Ifx_g_log.standardIo;
+    uint32          count = 0;
+    boolean         ready = Ifx_Log_flush();
+    uint32          i;
+
+    for (i = 0; ready && (i < IFXCPU_NUM_MODULES); i++)
+    {
+        Ifx_Log_Ring *ring = &Ifx_g_log.ring[i];
+
+        if (ring->fifo != NULL_PTR)
+        {
+            uint32 discarded = ring->discarded;
+
+            if (discarded != ring->discardedReported)
+            {
+                uint32 args[IFX_LOG_MAX_ARGS] = {i, discarded - ring->discardedReported};
+
+                ready                   = Ifx_Log_output("Cpu%d: %u log messages discarded" ENDL, args);
+                ring->discardedReported = discarded;
+            }
+
+            while (ready && (Ifx_Fifo_readCount(ring->fifo) >= IFX_LOG_HEADER_SIZE))
+            {
+                /* Messages are published at once: the arguments are available with the header */
+                Ifx_Log_Message message = {NULL_PTR, 0, {0}};
+                Ifx_Fifo_read(ring->fifo, &message, IFX_LOG_HEADER_SIZE, TIME_NULL);
+
+                if (message.argCount != 0)
+                {
+                    Ifx_Fifo_read(ring->fifo, message.args, (Ifx_SizeT)(message.argCount * sizeof(uint32)), TIME_NULL);
+                }
+
+                if (!io->txDisabled)
+                {
+                    ready = Ifx_Log_output(message.format, message.args);
+                }
+
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,108 @@
+/**
+ * \file Ifx_Log.h
+ * \brief Multi-core deferred logging
+ *
+ * \version iLLD_1_0_0_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_log Log
+ * This module implements a logging service usable from all the cores.
+ *
+ * Ifx_Log_write() does not format the message: it stores the address of the format string
+ * and the 32 bit arguments in a ring buffer owned by the calling core, and returns. The
+ * execution time is bounded and independent of the other cores, no lock is shared between the cores.
+ * Ifx_Log_process() is called periodically by a single task, it formats the messages
+ * of all the cores and writes them to the standard interface without blocking.
+ *
+ * \code
+ *     // CPU0 initialisation, after the ASC standard interface is initialised
+ *     Ifx_Log_init(&ascStdIf);
+ *
+ *     // any core, task or interrupt
+ *     Ifx_Log_write("Cpu%d: tick %u\n", 2, IfxCpu_getCoreId(), schd_GetTick());
+ *
+ *     // CPU0 background loop
+ *     Ifx_Log_process();
+ * \endcode
+ *
+ * Restrictions:
+ * - The arguments are 32 bit integers. Only integer and character conversions are supported
+ *   (e.g. %d, %u, %x, %c). Pointers, and so %s and %p, are not supported.
+ * - The format string must stay valid until the message is processed.
+ * - \ref Ifx_g_log must be located in a memory accessed by all cores with the same, non cached, address.
+ * - When the ring buffer of a core is full, the message is discarded and counted. The number of
+ *   discarded messages is printed by Ifx_Log_process().
+ * - The messages of different cores are not ordered in time.
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_LOG_H
+#define IFX_LOG_H 1
+
+#include "StdIf/IfxStdIf_DPipe.h"
+#include "_Lib/DataHandling/Ifx_Fifo.h"
+#include "Cpu/Std/IfxCpu.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_LOG_BUFFER_SIZE)
+#define IFX_CFG_LOG_BUFFER_SIZE (1024) /**<\brief Size in bytes of the ring buffer of each core */
+#endif
+
+#define IFX_LOG_MAX_ARGS        (6)    /**<\brief Maximum number of arguments of a message */
+
+/** \brief Message as stored in the ring buffers. Only the used arguments are stored */
+typedef struct
+{
+    pchar  format;                     /**<\brief printf-compatible format string, also identifies the message */
+    uint32 argCount;                   /**<\brief Number of arguments */
+    uint32 args[IFX_LOG_MAX_ARGS];     /**<\brief Arguments */
+} Ifx_Log_Message;
+
+/** \brief Ring buffer of one core */
+typedef struct
+{
+    Ifx_Fifo       *fifo;                                                                /**<\brief Written by the core, read by Ifx_Log_process() */
+    volatile uint32 discarded;                                                           /**<\brief Number of messages discarded by the core */
+    uint32          discardedReported;                                                   /**<\brief Value of discarded already printed by Ifx_Log_process() */
+    uint64          buffer[(IFX_CFG_LOG_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8) / sizeof(uint64)]; /**<\brief Fifo object and data */
+} Ifx_Log_Ring;
+
+typedef struct
+{
+    IfxStdIf_DPipe *standardIo;                               /**<\brief Pointer to the \ref IfxStdIf_DPipe object the messages are written to */
+    Ifx_Log_Ring    ring[IFXCPU_NUM_MODULES];                 /**<\brief Ring buffer of each core */
+    char            pending[STDIF_DPIPE_MAX_PRINT_SIZE + 1];  /**<\brief Last formatted message */
+    Ifx_SizeT       pendingOffset;                            /**<\brief Number of bytes of pending already written to the standard interface */
+    Ifx_SizeT       pendingLength;                            /**<\brief Length of the message in pending */
+} Ifx_Log;
+
+IFX_EXTERN Ifx_Log Ifx_g_log;  /**< \brief Log global variable */
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_log
+ * \{ */
+
+IFX_EXTERN void    Ifx_Log_init(IfxStdIf_DPipe *standardIo);
+IFX_EXTERN boolean Ifx_Log_write(pchar format, uint32 argCount, ...);
+IFX_EXTERN boolean Ifx_Log_writeArgs(pchar format, uint32 argCount, const uint32 *args);
+IFX_EXTERN uint32  Ifx_Log_process(void);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -53,8 +53,6 @@
 #define IFX_SHELL_WRITE_BACKSPACES(X) \
     {int ii; for (ii = 0; ii < (X); ii++) {IfxStdIf_DPipe_print(shell->io, "\b"); }}
 
-//---------------------------------------------------------------------------
-char Ifx_Shell_cmdBuffer[IFX_SHELL_CMD_LINE_SIZE * IFX_SHELL_CMD_HISTORY_SIZE];
 //---------------------------------------------------------------------------
 void Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine);
 void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeChar2);
@@ -82,6 +80,62 @@ static boolean Ifx_Shell_writeResult(Ifx_Shell *shell, Ifx_SizeT Code)
 
 
 //---------------------------------------------------------------------------
+/**
+ * \brief Add a command to the history, dropping the oldest commands as needed
+ * \param history Pointer to the command history
+ * \param line Pointer to the command
+ * \param length Number of characters of the command, less than IFX_SHELL_CMD_LINE_SIZE
+ */
+static void Ifx_Shell_historyAdd(Ifx_Shell_History *history, pchar line, Ifx_SizeT length)
+{
+    uint16 size = (uint16)(length + 1);
+    uint16 first;
+    uint16 oldest;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, size <= IFX_CFG_SHELL_HISTORY_BUFFER_SIZE);
+
+    while ((history->count == IFX_SHELL_CMD_HISTORY_SIZE) || ((history->used + size) > IFX_CFG_SHELL_HISTORY_BUFFER_SIZE))
+    {
+        oldest         = (uint16)((history->newest + IFX_SHELL_CMD_HISTORY_SIZE + 1 - history->count) % IFX_SHELL_CMD_HISTORY_SIZE);
+        history->used -= (uint16)((uint8)history->buffer[history->start[oldest]] + 1);
+        history->count--;
+    }
+
+    history->newest                 = (uint8)((history->newest + 1) % IFX_SHELL_CMD_HISTORY_SIZE);
+    history->start[history->newest] = history->head;
+    history->used                  += size;
+    history->count++;
+
+    history->buffer[history->head] = (char)length;
+    history->head                  = (uint16)((history->head + 1) % IFX_CFG_SHELL_HISTORY_BUFFER_SIZE);
+
+    first                          = (uint16)__minu((uint32)length, (uint32)(IFX_CFG_SHELL_HISTORY_BUFFER_SIZE - history->head));
+    memcpy(&history->buffer[history->head], line, first);
+    memcpy(&history->buffer[0], &line[first], (size_t)(length - first));
+    history->head = (uint16)((history->head + length) % IFX_CFG_SHELL_HISTORY_BUFFER_SIZE);
+}
+
+
+/**
+ * \brief Copy a command of the history
+ * \param history Pointer to the command history
+ * \param item Index of the command, 0 for the most recent one, less than history->count
+ * \param line Returns the null-terminated command, IFX_SHELL_CMD_LINE_SIZE characters buffer
+ */
+static void Ifx_Shell_historyGet(const Ifx_Shell_History *history, Ifx_SizeT item, char *line)
+{
+    uint16 offset = history->start[(history->newest + IFX_SHELL_CMD_HISTORY_SIZE - item) % IFX_SHELL_CMD_HISTORY_SIZE];
+    uint16 length = (uint8)history->buffer[offset];
+    uint16 first;
+
+    offset = (uint16)((offset + 1) % IFX_CFG_SHELL_HISTORY_BUFFER_SIZE);
+    first  = (uint16)__minu(length, (uint32)(IFX_CFG_SHELL_HISTORY_BUFFER_SIZE - offset));
+    memcpy(line, &history->buffer[offset], first);
+    memcpy(&line[first], &history->buffer[0], (size_t)(length - first));
+    line[length] = IFX_SHELL_NULL_CHAR;
+}
+
+
 boolean Ifx_Shell_showHelpSingle(pchar prefix, const void *commandList, IfxStdIf_DPipe *io)
 {
     const Ifx_Shell_Command *command = commandList;
@@ -203,7 +257,6 @@ void Ifx_Shell_initConfig(Ifx_Shell_Config *config)
 boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
 {
     sint32 i;
-    char **CmdHistory = NULL_PTR;   /* Pointer to array of pointers for command history items */
 
     /* Ensure state variable is cleared */
     memset(shell, 0, sizeof(*shell));
@@ -224,28 +277,18 @@ boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
     /* Copy command line buffer pointer into state variable */
     shell->cmd.cmdStr = shell->locals.cmdStr;
 
-    /* Initialize command history space and cache pointer */
-    memset(Ifx_Shell_cmdBuffer, 0, sizeof(Ifx_Shell_cmdBuffer));
-    shell->cmdHistory[0] = &Ifx_Shell_cmdBuffer[0];
-
     for (i = 0; i < IFX_SHELL_COMMAND_LISTS; i++)
     {
         shell->commandList[i] = config->commandList[i];
     }
 
-    /* Initialize command history pointers */
-    CmdHistory = shell->cmdHistory;
-
-    for (i = 1; i < IFX_SHELL_CMD_HISTORY_SIZE; i++)
-    {
-        CmdHistory[i] = &CmdHistory[i - 1][IFX_SHELL_CMD_LINE_SIZE];    /* Items are just offsets into a large allocated area */
-    }
+    Ifx_Shell_buildIndex(shell);
 
     shell->cmd.historyItem = IFX_SHELL_CMD_HISTORY_NO_ITEM;
 
-    /* Pre-load useful commands into history buffer */
-    strcpy(CmdHistory[0], "help");
-    strcpy(CmdHistory[1], "protocol start");
+    /* Pre-load useful commands into history buffer, most recent last */
+    Ifx_Shell_historyAdd(&shell->history, "protocol start", 14);
+    Ifx_Shell_historyAdd(&shell->history, "help", 4);
 
     if (shell->control.showPrompt != 0)
     {
@@ -267,7 +310,6 @@ void Ifx_Shell_process(Ifx_Shell *shell)
     Ifx_Shell_CmdLine *Cmd         = &shell->cmd;
     char              *inputbuffer = shell->locals.inputbuffer;
     char              *cmdStr      = shell->locals.cmdStr;
-    char             **CmdHistory  = shell->cmdHistory;
 
     if (shell->control.enabled == 0)
     {
@@ -322,15 +364,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
 
                     if (Cmd->historyAdd != FALSE)
                     {
-                        /* Shuffle history up */
-                        for (j = IFX_SHELL_CMD_HISTORY_SIZE - 1; j > 0; j--)
-                        {
-                            /* Copy text */
-                            strncpy(CmdHistory[j], CmdHistory[j - 1], IFX_SHELL_CMD_LINE_SIZE);
-                        }
-
-                        /* Copy in new entry */
-                        strncpy(CmdHistory[0], cmdStr, IFX_SHELL_CMD_LINE_SIZE);
+                        Ifx_Shell_historyAdd(&shell->history, cmdStr, Cmd->length);
                     }
 
                     /* Execute command */
@@ -379,7 +413,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
                     }
 
                     /* Update in command line variable. Shuffle text left */
-                    strncpy(&cmdStr[Cmd->cursor - 1], &cmdStr[Cmd->cursor], Cmd->length - Cmd->cursor);
+                    memmove(&cmdStr[Cmd->cursor - 1], &cmdStr[Cmd->cursor], Cmd->length - Cmd->cursor);
 
                     /* Terminate string at end of shorter string */
                     cmdStr[Cmd->length - 1] = IFX_SHELL_NULL_CHAR;
@@ -562,31 +596,117 @@ boolean Ifx_Shell_matchToken(pchar *argsPtr, pchar token)
 }
 
 
-static boolean Ifx_Shell_matchCommand(pchar *argsPtr, pchar *match)
+/**
+ * \brief Locate a token in place, same token rules as Ifx_Shell_parseToken()
+ * \param args Pointer to the null-terminated string
+ * \param token Returns the pointer to the first character of the token
+ * \param length Returns the number of characters of the token
+ * \return Pointer to the string after the token and the following whitespaces, NULL_PTR if there is no token
+ */
+static pchar Ifx_Shell_scanToken(pchar args, pchar *token, Ifx_SizeT *length)
 {
-    boolean result         = FALSE;
-    pchar   savedArguments = *argsPtr;
-    pchar   savedMatch     = *match;
-    char    buffer0[256];
-    char    buffer1[256];
+    pchar end;
+
+    args = Ifx_Shell_skipWhitespace(args);
 
-    if ((Ifx_Shell_parseToken(argsPtr, buffer0, Ifx_COUNTOF(buffer0)) != FALSE)
-        && (Ifx_Shell_parseToken(match, buffer1, Ifx_COUNTOF(buffer1)) != FALSE))
+    if ((args == NULL_PTR) || (*args == IFX_SHELL_NULL_CHAR))
     {
-        if (strcmp(buffer1, buffer0) == 0)
+        return NULL_PTR;
+    }
+
+    if (*args == '\"')
+    {
+        args = &args[1];
+        end  = args;
+
+        while ((*end != IFX_SHELL_NULL_CHAR) && (*end != '\"'))
         {
-            result = TRUE;
+            end = &end[1];
         }
+
+        // error if no closing quote
+        if (*end != '\"')
+        {
+            return NULL_PTR;
+        }
+
+        *token  = args;
+        *length = (Ifx_SizeT)(end - args);
+
+        return Ifx_Shell_skipWhitespace(&end[1]);
     }
+    else
+    {
+        end = args;
 
-    if (result == FALSE)
+        while ((*end != IFX_SHELL_NULL_CHAR) && (!ISSPACE(*end)))
+        {
+            end = &end[1];
+        }
+
+        *token  = args;
+        *length = (Ifx_SizeT)(end - args);
+
+        return Ifx_Shell_skipWhitespace(end);
+    }
+}
+
+
+/** \brief Hash of a token (FNV-1a) */
+static uint32 Ifx_Shell_hashToken(pchar token, Ifx_SizeT length)
+{
+    uint32    hash = 2166136261U;
+    Ifx_SizeT i;
+
+    for (i = 0; i < length; i++)
     {
-        // No match: don't advance pointer
-        *argsPtr = savedArguments;
-        *match   = savedMatch;
+        hash = (hash ^ (uint8)token[i]) * 16777619U;
     }
 
-    return result;
+    return hash;
+}
+
+
+/**
+ * \brief Match a command line with all the tokens of a command, without copy of the tokens
+ * \param commandLine Pointer to the null-terminated command line
+ * \param command Pointer to the null-terminated tokens of the command
+ * \param args Returns the pointer to the arguments following the command, on match only
+ * \return TRUE if at least one token matches and all the tokens of the command match
+ */
+static boolean Ifx_Shell_matchCommand(pchar commandLine, pchar command, pchar *args)
+{
+    boolean   commandFound = FALSE;
+    pchar     lineToken, commandToken;
+    Ifx_SizeT lineLength, commandLength;
+
+    while (TRUE)
+    {
+        pchar nextCommand = Ifx_Shell_scanToken(command, &commandToken, &commandLength);
+        pchar nextLine;
+
+        if (nextCommand == NULL_PTR)
+        {
+            /* all the tokens of the command match */
+            if (commandFound != FALSE)
+            {
+                *args = commandLine;
+            }
+
+            return commandFound;
+        }
+
+        nextLine = Ifx_Shell_scanToken(commandLine, &lineToken, &lineLength);
+
+        if ((nextLine == NULL_PTR) || (lineLength != commandLength) || (strncmp(lineToken, commandToken, commandLength) != 0))
+        {
+            return FALSE;
+        }
+
+        commandFound = TRUE;
+        commandLine  = nextLine;
+        command      = nextCommand;
+    }
 }
 
 
@@ -821,19 +941,8 @@ const Ifx_Shell_Command *Ifx_Shell_commandFind(const Ifx_Shell_Command *commandL
 
     while (command->commandLine != NULL_PTR)
     {
-        pchar   commandTemp     = (pchar)command->commandLine;
-        pchar   commandLineTemp = commandLine;
-        char    buffer[256];
-        boolean commandFound    = FALSE;
-
-        while (Ifx_Shell_matchCommand(&commandLineTemp, &commandTemp) != FALSE)
+        if (Ifx_Shell_matchCommand(commandLine, command->commandLine, args) != FALSE)
         {
-            commandFound = TRUE;
-        }
-
-        if ((commandFound != FALSE) && (Ifx_Shell_parseToken(&commandTemp, buffer, Ifx_COUNTOF(buffer)) == FALSE))
-        {
-            *args  = commandLineTemp;
             result = command;
             break;
         }
@@ -845,23 +954,147 @@ const Ifx_Shell_Command *Ifx_Shell_commandFind(const Ifx_Shell_Command *commandL
 }
 
 
+void Ifx_Shell_buildIndex(Ifx_Shell *shell)
+{
+    Ifx_Shell_Index *index = &shell->index;
+    uint32           mask  = (2 * IFX_CFG_SHELL_INDEX_SIZE) - 1;
+    uint32           i;
+
+    index->count = 0;
+    index->valid = TRUE;
+
+    for (i = 0; i < (2 * IFX_CFG_SHELL_INDEX_SIZE); i++)
+    {
+        index->slot[i] = IFX_SHELL_INDEX_NO_ITEM;
+    }
+
+    for (i = 0; i < IFX_SHELL_COMMAND_LISTS; i++)
+    {
+        const Ifx_Shell_Command *command = shell->commandList[i];
+
+        index->commandList[i] = command;
+
+        while ((command != NULL_PTR) && (command->commandLine != NULL_PTR) && (index->valid != FALSE))
+        {
+            pchar     token, slotToken;
+            Ifx_SizeT length, slotLength;
+
+            /* a command without token never matches */
+            if (Ifx_Shell_scanToken(command->commandLine, &token, &length) != NULL_PTR)
+            {
+                uint32 position = Ifx_Shell_hashToken(token, length) & mask;
+                uint16 item     = index->count;
+
+                if (item >= IFX_CFG_SHELL_INDEX_SIZE)
+                {
+                    /* Too many commands: IFX_CFG_SHELL_INDEX_SIZE must be increased */
+                    IFX_ASSERT(IFX_VERBOSE_LEVEL_WARNING, FALSE);
+                    index->valid = FALSE;
+                    break;
+                }
+
+                index->command[item] = command;
+                index->next[item]    = IFX_SHELL_INDEX_NO_ITEM;
+                index->count++;
+
+                /* open addressing on the first token, then chained after the previous commands with the same token */
+                while (index->slot[position] != IFX_SHELL_INDEX_NO_ITEM)
+                {
+                    uint16 other = index->slot[position];
+
+                    Ifx_Shell_scanToken(index->command[other]->commandLine, &slotToken, &slotLength);
+
+                    if ((slotLength == length) && (strncmp(slotToken, token, length) == 0))
+                    {
+                        while (index->next[other] != IFX_SHELL_INDEX_NO_ITEM)
+                        {
+                            other = index->next[other];
+                        }
+
+                        index->next[other] = item;
+                        item               = IFX_SHELL_INDEX_NO_ITEM;
+                        break;
+                    }
+
+                    position = (position + 1) & mask;
+                }
+
+                if (item != IFX_SHELL_INDEX_NO_ITEM)
+                {
+                    index->slot[position] = item;
+                }
+            }
+
+            command = &command[1];
+        }
+    }
+}
+
+
 const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args)
 {
-    int                      i;
+    Ifx_Shell_Index         *index        = &shell->index;
     const Ifx_Shell_Command *shellCommand = NULL_PTR;
+    uint32                   mask         = (2 * IFX_CFG_SHELL_INDEX_SIZE) - 1;
+    pchar                    token, slotToken;
+    Ifx_SizeT                length, slotLength;
+    int                      i;
 
     for (i = 0; i < IFX_SHELL_COMMAND_LISTS; i++)
     {
-        if (shell->commandList[i] != NULL_PTR)
+        if (index->commandList[i] != shell->commandList[i])
         {
-            shellCommand = Ifx_Shell_commandFind(shell->commandList[i], commandLine, args);
+            Ifx_Shell_buildIndex(shell);
+            break;
+        }
+    }
 
-            if (shellCommand != NULL_PTR)
+    if (index->valid == FALSE)
+    {
+        for (i = 0; i < IFX_SHELL_COMMAND_LISTS; i++)
+        {
+            if (shell->commandList[i] != NULL_PTR)
             {
+                shellCommand = Ifx_Shell_commandFind(shell->commandList[i], commandLine, args);
+
+                if (shellCommand != NULL_PTR)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    else if (Ifx_Shell_scanToken(commandLine, &token, &length) != NULL_PTR)
+    {
+        uint32 position = Ifx_Shell_hashToken(token, length) & mask;
+
+        while (index->slot[position] != IFX_SHELL_INDEX_NO_ITEM)
+        {
+            uint16 item = index->slot[position];
+
+            Ifx_Shell_scanToken(index->command[item]->commandLine, &slotToken, &slotLength);
+
+            if ((slotLength == length) && (strncmp(slotToken, token, length) == 0))
+            {
+                /* first match in the search order among the commands with this first token */
+                while ((item != IFX_SHELL_INDEX_NO_ITEM) && (shellCommand == NULL_PTR))
+                {
+                    if (Ifx_Shell_matchCommand(commandLine, index->command[item]->commandLine, args) != FALSE)
+                    {
+                        shellCommand = index->command[item];
+                    }
+
+                    item = index->next[item];
+                }
+
                 break;
             }
+
+            position = (position + 1) & mask;
         }
     }
+    else
+    {}
 
     return shellCommand;
 }
@@ -955,6 +1188,11 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
     {
     case 'A':                  /* Up arrow */
 
+        if (shell->history.count == 0)
+        {
+            break;             /* Empty history - nothing to recall */
+        }
+
         if (Cmd->historyItem == IFX_SHELL_CMD_HISTORY_NO_ITEM)
         {
             /* Not using list at the moment - take most recent item [0] */
@@ -962,7 +1200,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
         }
         else
         {
-            if (Cmd->historyItem < (IFX_SHELL_CMD_HISTORY_SIZE - 1))
+            if (Cmd->historyItem < (shell->history.count - 1))
             {
                 /* If not already at oldest, go back one in list */
                 Cmd->historyItem++;
@@ -970,7 +1208,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
         }
 
         /* Copy text into buffer */
-        strncpy(cmdStr, shell->cmdHistory[Cmd->historyItem], IFX_SHELL_CMD_LINE_SIZE);
+        Ifx_Shell_historyGet(&shell->history, Cmd->historyItem, cmdStr);
 
         /* echo to screen if requested */
         if (shell->control.echo != 0)
@@ -1008,7 +1246,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
             Cmd->historyItem--;
 
             /* Copy text into buffer */
-            strncpy(cmdStr, shell->cmdHistory[Cmd->historyItem], IFX_SHELL_CMD_LINE_SIZE);
+            Ifx_Shell_historyGet(&shell->history, Cmd->historyItem, cmdStr);
 
             if (shell->control.echo != 0)
             {
@@ -1118,7 +1356,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
                 }
 
                 /* Update in command line variable. Shuffle text left */
-                strncpy(&cmdStr[Cmd->cursor], &cmdStr[Cmd->cursor + 1], Cmd->length - Cmd->cursor - 1);
+                memmove(&cmdStr[Cmd->cursor], &cmdStr[Cmd->cursor + 1], Cmd->length - Cmd->cursor - 1);
 
                 cmdStr[Cmd->length - 1] = IFX_SHELL_NULL_CHAR; /* Terminate string at end of shorter string */
                 Cmd->length--;                                 /* Now one character shorter */
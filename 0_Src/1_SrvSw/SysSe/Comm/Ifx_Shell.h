@@ -34,13 +34,29 @@
 //----------------------------------------------------------------------------------------
 #define IFX_SHELL_NULL_CHAR           '\0'
 
-#define IFX_SHELL_CMD_HISTORY_SIZE    (10)  /**<\brief Number of commands to store in history */
+#define IFX_SHELL_CMD_HISTORY_SIZE    (10)  /**<\brief Maximal number of commands to store in history */
 #define IFX_SHELL_CMD_LINE_SIZE       (128) /**<\brief max command line IFX_SHELL_CMD_LINE_SIZE - 1 */
 
+#ifndef IFX_CFG_SHELL_HISTORY_BUFFER_SIZE
+#define IFX_CFG_SHELL_HISTORY_BUFFER_SIZE (512) /**<\brief Size in bytes of the command history, at least IFX_SHELL_CMD_LINE_SIZE. Each command uses its length + 1 bytes */
+#endif
+
 #ifndef IFX_SHELL_COMMAND_LISTS
 #define IFX_SHELL_COMMAND_LISTS       (1)   /**<\brief Number of command lists */
 #endif
 
+#ifndef IFX_CFG_SHELL_INDEX_SIZE
+/** \brief Size of the command index of each shell, to be set per application in Ifx_Cfg.h: the smallest power of 2
+ * not below the number of commands of all the command lists of the shell. With more commands, the index is not used
+ * and the commands are searched linearly (IFX_VERBOSE_LEVEL_WARNING assertion when the index is built).
+ * The index uses 10 bytes of RAM per entry on TriCore (pointer, chain and 2 hash slots): 640 bytes for 64 entries */
+#define IFX_CFG_SHELL_INDEX_SIZE      (64)
+#endif
+
+#if ((IFX_CFG_SHELL_INDEX_SIZE & (IFX_CFG_SHELL_INDEX_SIZE - 1)) != 0) || (IFX_CFG_SHELL_INDEX_SIZE > 16384)
+#error IFX_CFG_SHELL_INDEX_SIZE shall be a power of 2, at most 16384
+#endif
+
 #ifndef IFX_SHELL_PROMPT
 #define IFX_SHELL_PROMPT              "Shell>" /**<\brief Shell prompt */
 #endif
@@ -53,6 +69,9 @@
 
 /** \brief Signifies no item in use in command history list */
 #define IFX_SHELL_CMD_HISTORY_NO_ITEM (-1)
+
+/** \brief Signifies no command in the command index */
+#define IFX_SHELL_INDEX_NO_ITEM       (0xFFFFU)
 //----------------------------------------------------------------------------------------
 /** \brief Result code definition used after each executed Shell command */
 typedef enum
@@ -125,6 +144,35 @@ typedef struct
     char               escBracketNum;
 } Ifx_Shell_Runtime;
 
+/** \brief Command index: hash table of the commands on their first token
+ *
+ * The commands with the same first token are chained in the search order of the command lists */
+typedef struct
+{
+    const Ifx_Shell_Command *commandList[IFX_SHELL_COMMAND_LISTS];    /**< \brief Command lists indexed, to detect their change */
+    const Ifx_Shell_Command *command[IFX_CFG_SHELL_INDEX_SIZE];       /**< \brief Indexed commands, in search order */
+    uint16                   next[IFX_CFG_SHELL_INDEX_SIZE];          /**< \brief Next command with the same first token, or IFX_SHELL_INDEX_NO_ITEM */
+    uint16                   slot[2 * IFX_CFG_SHELL_INDEX_SIZE];      /**< \brief Hash table: first command of each first token, or IFX_SHELL_INDEX_NO_ITEM */
+    uint16                   count;                                   /**< \brief Number of indexed commands */
+    boolean                  valid;                                   /**< \brief FALSE: too many commands, linear search */
+} Ifx_Shell_Index;
+
+/** \brief Command history
+ *
+ * The commands are stored one after the other in a ring buffer, each one as its length (1 byte) followed by its
+ * characters, without terminating null character. The oldest commands are dropped when the buffer is full or when
+ * there are IFX_SHELL_CMD_HISTORY_SIZE commands.
+ */
+typedef struct
+{
+    char   buffer[IFX_CFG_SHELL_HISTORY_BUFFER_SIZE];     /**< \brief Ring buffer of the commands */
+    uint16 start[IFX_SHELL_CMD_HISTORY_SIZE];             /**< \brief Ring of the offsets of the commands in buffer */
+    uint16 head;                                          /**< \brief Offset in buffer of the next command */
+    uint16 used;                                          /**< \brief Number of bytes used in buffer */
+    uint8  newest;                                        /**< \brief Index in start of the most recent command */
+    uint8  count;                                         /**< \brief Number of commands */
+} Ifx_Shell_History;
+
 /**
  * \brief Shell object definition
  */
@@ -134,8 +182,8 @@ typedef struct
 
     Ifx_Shell_Flags control;        /**< \brief control flags */
 
-    /** \brief Array of pointers to the history entries */
-    char *cmdHistory[IFX_SHELL_CMD_HISTORY_SIZE];
+    /** \brief Command history */
+    Ifx_Shell_History history;
 
     /** \brief Current status of command line editing (saves passing many parameters around) */
     Ifx_Shell_CmdLine cmd;
@@ -146,6 +194,9 @@ typedef struct
     * during Shell lifetime, e.g. stored in non-volatile memory or as global variable */
     const Ifx_Shell_Command *commandList[IFX_SHELL_COMMAND_LISTS];
 
+    /** \brief Index of the commands of commandList, rebuilt when commandList changes */
+    Ifx_Shell_Index index;
+
     Ifx_Shell_Protocol       protocol; /**< \brief Protocol handler data */
 } Ifx_Shell;
 
@@ -308,6 +359,26 @@ IFX_EXTERN boolean Ifx_Shell_parseFloat32(pchar *argsPtr, float32 *value);
  */
 IFX_EXTERN const Ifx_Shell_Command *Ifx_Shell_commandFind(const Ifx_Shell_Command *commandList, pchar commandLine, pchar *args);
 
+/**
+ * \brief Find command in all command lists of the shell
+ *
+ * Same result as \ref Ifx_Shell_commandFind() on each command list in turn. The search uses the command index,
+ * rebuilt first if the command lists have been changed.
+ * \param shell Pointer to the \ref Ifx_Shell object
+ * \param commandLine Pointer to null-terminated string containings the command to search.
+ * \param args Pointer to the argument null-terminated string
+ */
+IFX_EXTERN const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args);
+
+/**
+ * \brief Build the command index from the command lists of the shell
+ *
+ * Called by \ref Ifx_Shell_init(), and by \ref Ifx_Shell_commandListFind() when shell->commandList has been changed.
+ * To be called after a change of the content of a command list.
+ * \param shell Pointer to the \ref Ifx_Shell object
+ */
+IFX_EXTERN void Ifx_Shell_buildIndex(Ifx_Shell *shell);
+
 /**
  * \brief Implementation of \ref Ifx_Shell_Call. Show the help menu from single command list.
  * \param prefix Prefix for each command in the commandList
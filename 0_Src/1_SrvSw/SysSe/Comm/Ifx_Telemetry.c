@@ -0,0 +1,402 @@
+/**
+ * \file Ifx_Telemetry.c
+ * \brief Binary telemetry stream
+ *
+ * \version iLLD_1_0_0_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_Telemetry.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Size in bytes of a value of the given type */
+#define IFX_TELEMETRY_TYPE_SIZE(type)   ((uint32)(type) & 0x0FU)
+
+/** \brief Default number of packets of a channel between two absolute packets */
+#define IFX_TELEMETRY_KEY_FRAME_INTERVAL (100)
+
+/** \brief Append an unsigned LEB128 value to the packet, return the new packet position */
+static uint8 *Ifx_Telemetry_putVarint(uint8 *packet, uint64 value)
+{
+    while (value >= 0x80U)
+    {
+        *packet++ = (uint8)(value | 0x80U);
+        value   >>= 7;
+    }
+
+    *packet++ = (uint8)value;
+
+    return packet;
+}
+
+
+/** \brief Read the value with index i from the user sample, sign extended for the signed types */
+static uint32 Ifx_Telemetry_getValue(Ifx_Telemetry_Type type, const void *values, uint32 i)
+{
+    uint32 value;
+
+    switch (type)
+    {
+    case Ifx_Telemetry_Type_uint8:
+        value = ((const uint8 *)values)[i];
+        break;
+    case Ifx_Telemetry_Type_sint8:
+        value = (uint32)(sint32)((const sint8 *)values)[i];
+        break;
+    case Ifx_Telemetry_Type_uint16:
+        value = ((const uint16 *)values)[i];
+        break;
+    case Ifx_Telemetry_Type_sint16:
+        value = (uint32)(sint32)((const sint16 *)values)[i];
+        break;
+    default:
+        /* 32 bit types, float32 is sent as its bit pattern */
+        value = ((const uint32 *)values)[i];
+        break;
+    }
+
+    return value;
+}
+
+
+/**
+ * \brief Frame the packet and write it to the standard interface without waiting.
+ * \return TRUE if the complete frame is written, FALSE if the standard interface has not enough space, nothing is written.
+ */
+static boolean Ifx_Telemetry_send(Ifx_Telemetry *telemetry, const uint8 *packet, Ifx_SizeT length)
+{
+    uint8     frame[IFX_TELEMETRY_MAX_FRAME_SIZE];
+    Ifx_SizeT count;
+    boolean   result = FALSE;
+
+    if (telemetry->framing == Ifx_Telemetry_Framing_cobs)
+    {
+        count = Ifx_Telemetry_encodeCobs(frame, packet, length);
+    }
+    else
+    {
+        frame[0] = (uint8)length;
+        memcpy(&frame[1], packet, length);
+        count    = (Ifx_SizeT)(length + 1);
+    }
+
+    if (IfxStdIf_DPipe_getWriteCount(telemetry->io) >= count)
+    {
+        result = IfxStdIf_DPipe_write(telemetry->io, frame, &count, TIME_NULL);
+    }
+
+    if (result == FALSE)
+    {
+        telemetry->discarded++;
+    }
+
+    return result;
+}
+
+
+/** \brief Send the channel descriptor */
+static boolean Ifx_Telemetry_sendChannel(Ifx_Telemetry *telemetry, uint8 channel)
+{
+    const Ifx_Telemetry_ChannelConfig *config = &telemetry->channel[channel].config;
+    uint8                              packet[IFX_TELEMETRY_MAX_PACKET_SIZE];
+    Ifx_SizeT                          nameLength = (Ifx_SizeT)strlen(config->name);
+
+    nameLength = __min(nameLength, IFX_TELEMETRY_NAME_SIZE);
+    packet[0]  = IFX_TELEMETRY_CHANNEL_META;
+    packet[1]  = IFX_TELEMETRY_META_CHANNEL;
+    packet[2]  = channel;
+    packet[3]  = (uint8)config->type;
+    packet[4]  = config->count;
+    packet[5]  = (uint8)(config->deltaEncoding != FALSE);
+    packet[6]  = (uint8)nameLength;
+    memcpy(&packet[7], config->name, nameLength);
+
+    return Ifx_Telemetry_send(telemetry, packet, (Ifx_SizeT)(7 + nameLength));
+}
+
+
+/** \brief Send the stream information */
+static boolean Ifx_Telemetry_sendStream(Ifx_Telemetry *telemetry)
+{
+    uint8  packet[6];
+    uint32 frequency = (uint32)TimeConst_1s;
+
+    packet[0] = IFX_TELEMETRY_CHANNEL_META;
+    packet[1] = IFX_TELEMETRY_META_STREAM;
+    packet[2] = (uint8)frequency;
+    packet[3] = (uint8)(frequency >> 8);
+    packet[4] = (uint8)(frequency >> 16);
+    packet[5] = (uint8)(frequency >> 24);
+
+    return Ifx_Telemetry_send(telemetry, packet, sizeof(packet));
+}
+
+
+/**
+ * \brief Initialize the configuration structure to default
+ * \param config Telemetry configuration. This parameter is initialised by the function
+ * \param standardIo Pointer to the IfxStdIf_DPipe object the stream is written to
+ */
+void Ifx_Telemetry_initConfig(Ifx_Telemetry_Config *config, IfxStdIf_DPipe *standardIo)
+{
+    config->standardIo       = standardIo;
+    config->framing          = Ifx_Telemetry_Framing_cobs;
+    config->keyFrameInterval = IFX_TELEMETRY_KEY_FRAME_INTERVAL;
+}
+
+
+/**
+ * \brief Initialize the telemetry object and send the stream information.
+ * \param telemetry Telemetry object
+ * \param config Telemetry configuration. keyFrameInterval = 0 disables the delta packets
+ * \return TRUE if the stream information is sent
+ */
+boolean Ifx_Telemetry_init(Ifx_Telemetry *telemetry, const Ifx_Telemetry_Config *config)
+{
+    telemetry->io               = config->standardIo;
+    telemetry->framing          = config->framing;
+    telemetry->keyFrameInterval = config->keyFrameInterval;
+    telemetry->channelCount     = 0;
+    telemetry->discarded        = 0;
+
+    return Ifx_Telemetry_sendStream(telemetry);
+}
+
+
+/**
+ * \brief Add a channel and send its descriptor.
+ * \param telemetry Telemetry object
+ * \param config Channel configuration. The name must stay valid as long as the telemetry object is used
+ * \return Channel index used by Ifx_Telemetry_write(), or -1 if no channel is available
+ */
+sint32 Ifx_Telemetry_addChannel(Ifx_Telemetry *telemetry, const Ifx_Telemetry_ChannelConfig *config)
+{
+    sint32 result = -1;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->count > 0) && (config->count <= IFX_CFG_TELEMETRY_MAX_VALUES));
+
+    if ((telemetry->channelCount < IFX_CFG_TELEMETRY_MAX_CHANNELS) && (config->count > 0) && (config->count <= IFX_CFG_TELEMETRY_MAX_VALUES))
+    {
+        Ifx_Telemetry_Channel *channel = &telemetry->channel[telemetry->channelCount];
+
+        channel->config               = *config;
+        channel->config.deltaEncoding = (config->type != Ifx_Telemetry_Type_float32) && (config->deltaEncoding != FALSE);
+        channel->timestamp            = 0;
+        channel->packetsToKeyFrame    = 0;
+        result                        = telemetry->channelCount;
+        telemetry->channelCount++;
+
+        Ifx_Telemetry_sendChannel(telemetry, (uint8)result);
+    }
+
+    return result;
+}
+
+
+/**
+ * \brief Send the stream information and the descriptors of all the channels, and force absolute packets.
+ * To be called periodically or on request of the host, so that a decoder started late can decode the stream.
+ * \param telemetry Telemetry object
+ * \return TRUE if all the descriptors are sent
+ */
+boolean Ifx_Telemetry_sendDescriptors(Ifx_Telemetry *telemetry)
+{
+    boolean result = Ifx_Telemetry_sendStream(telemetry);
+    uint8   i;
+
+    for (i = 0; i < telemetry->channelCount; i++)
+    {
+        result                                  &= Ifx_Telemetry_sendChannel(telemetry, i);
+        telemetry->channel[i].packetsToKeyFrame  = 0;
+    }
+
+    return result;
+}
+
+
+/**
+ * \brief Send a sample of the channel, timestamped with now().
+ * \param telemetry Telemetry object
+ * \param channel Channel index returned by Ifx_Telemetry_addChannel()
+ * \param values Array of count values of the channel type
+ * \retval TRUE if the sample is written to the standard interface
+ * \retval FALSE if the standard interface is full, the sample is discarded.
+ */
+boolean Ifx_Telemetry_write(Ifx_Telemetry *telemetry, sint32 channel, const void *values)
+{
+    return Ifx_Telemetry_writeAt(telemetry, channel, now(), values);
+}
+
+
+/**
+ * \brief Send a sample of the channel with the given timestamp.
+ * \param telemetry Telemetry object
+ * \param channel Channel index returned by Ifx_Telemetry_addChannel()
+ * \param timestamp Time of the sample in ticks, as returned by now()
+ * \param values Array of count values of the channel type
+ * \retval TRUE if the sample is written to the standard interface
+ * \retval FALSE if the standard interface is full, the sample is discarded.
+ */
+boolean Ifx_Telemetry_writeAt(Ifx_Telemetry *telemetry, sint32 channel, Ifx_TickTime timestamp, const void *values)
+{
+    uint8                  packet[IFX_TELEMETRY_MAX_PACKET_SIZE];
+    uint8                 *position = packet;
+    Ifx_Telemetry_Channel *data;
+    boolean                delta;
+    boolean                result;
+    uint32                 i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (channel >= 0) && (channel < telemetry->channelCount));
+    data  = &telemetry->channel[channel];
+    delta = (data->packetsToKeyFrame != 0) && (timestamp >= data->timestamp);
+
+    *position++ = (uint8)((uint32)channel | (delta ? IFX_TELEMETRY_HEADER_DELTA : 0U));
+    position    = Ifx_Telemetry_putVarint(position, (uint64)(delta ? (timestamp - data->timestamp) : timestamp));
+
+    if (delta && data->config.deltaEncoding)
+    {
+        for (i = 0; i < data->config.count; i++)
+        {
+            uint32 value      = Ifx_Telemetry_getValue(data->config.type, values, i);
+            sint32 difference = (sint32)(value - data->values[i]);
+
+            /* zig-zag encoding: small negative differences give small unsigned values */
+            position        = Ifx_Telemetry_putVarint(position, ((uint32)difference << 1) ^ (uint32)(difference >> 31));
+            data->values[i] = value;
+        }
+    }
+    else
+    {
+        uint32 size = IFX_TELEMETRY_TYPE_SIZE(data->config.type);
+
+        for (i = 0; i < data->config.count; i++)
+        {
+            uint32 value = Ifx_Telemetry_getValue(data->config.type, values, i);
+            uint32 byte;
+
+            for (byte = 0; byte < size; byte++)
+            {
+                *position++ = (uint8)(value >> (byte * 8));
+            }
+
+            data->values[i] = value;
+        }
+    }
+
+    result = Ifx_Telemetry_send(telemetry, packet, (Ifx_SizeT)(position - packet));
+
+    if (result != FALSE)
+    {
+        data->timestamp         = timestamp;
+        data->packetsToKeyFrame = delta ? (uint16)(data->packetsToKeyFrame - 1) : telemetry->keyFrameInterval;
+    }
+    else
+    {
+        /* The decoder has not received the reference values: the next packet is absolute */
+        data->packetsToKeyFrame = 0;
+    }
+
+    return result;
+}
+
+
+/**
+ * \brief COBS encode a packet and append the 0 terminator.
+ * \param frame Output buffer, at least length + length / 254 + 2 bytes
+ * \param packet Packet to encode
+ * \param length Packet length in bytes
+ * \return Frame length in bytes, including the terminator
+ */
+Ifx_SizeT Ifx_Telemetry_encodeCobs(uint8 *frame, const uint8 *packet, Ifx_SizeT length)
+{
+    Ifx_SizeT codeIndex = 0;
+    Ifx_SizeT count     = 1;
+    uint8     code      = 1;
+    Ifx_SizeT i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (packet[i] == 0)
+        {
+            frame[codeIndex] = code;
+            codeIndex        = count++;
+            code             = 1;
+        }
+        else
+        {
+            frame[count++] = packet[i];
+            code++;
+
+            if (code == 0xFF)
+            {
+                frame[codeIndex] = code;
+                codeIndex        = count++;
+                code             = 1;
+            }
+        }
+    }
+
+    frame[codeIndex] = code;
+    frame[count++]   = 0;
+
+    return count;
+}
+
+
+/**
+ * \brief Decode a COBS frame.
+ * \param packet Output buffer, at least length bytes
+ * \param frame Frame to decode, without the 0 terminator
+ * \param length Frame length in bytes
+ * \return Packet length in bytes, or -1 if the frame is invalid
+ */
+Ifx_SizeT Ifx_Telemetry_decodeCobs(uint8 *packet, const uint8 *frame, Ifx_SizeT length)
+{
+    Ifx_SizeT count = 0;
+    Ifx_SizeT i     = 0;
+
+    while ((i < length) && (count >= 0))
+    {
+        uint8 code = frame[i++];
+        uint8 j;
+
+        if ((code == 0) || ((i + code - 1) > length))
+        {
+            count = -1;
+        }
+        else
+        {
+            for (j = 1; j < code; j++)
+            {
+                packet[count++] = frame[i++];
+            }
+
+            if ((code != 0xFF) && (i < length))
+            {
+                packet[count++] = 0;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,164 @@
+/**
+ * \file Ifx_Telemetry.h
+ * \brief Binary telemetry stream
+ *
+ * \version iLLD_1_0_0_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_telemetry Telemetry
+ * This module sends samples of typed channels as a binary stream over a \ref IfxStdIf_DPipe,
+ * without formatting on the target. The stream is decoded on the host into CSV by
+ * 1_ToolEnv/1_Host/Tools/Ifx_TelemetryDecode.c.
+ *
+ * \code
+ *     Ifx_Telemetry               telemetry;
+ *     Ifx_Telemetry_Config        config;
+ *     Ifx_Telemetry_ChannelConfig angle = {"angle", Ifx_Telemetry_Type_float32, 1, FALSE};
+ *     Ifx_Telemetry_ChannelConfig adc   = {"dsadc", Ifx_Telemetry_Type_sint16, 4, TRUE};
+ *     sint32                      angleChannel, adcChannel;
+ *
+ *     Ifx_Telemetry_initConfig(&config, &ascStdIf);
+ *     Ifx_Telemetry_init(&telemetry, &config);
+ *     angleChannel = Ifx_Telemetry_addChannel(&telemetry, &angle);
+ *     adcChannel   = Ifx_Telemetry_addChannel(&telemetry, &adc);
+ *
+ *     // periodic task
+ *     Ifx_Telemetry_write(&telemetry, angleChannel, &rdcAngle);
+ *     Ifx_Telemetry_write(&telemetry, adcChannel, adcResults);
+ * \endcode
+ *
+ * \section library_srvsw_sysse_comm_telemetry_format Stream format
+ * Each sample is sent as one packet:
+ * - header byte: channel index (bits 0..5), \ref IFX_TELEMETRY_HEADER_DELTA (bit 6)
+ * - timestamp in ticks of now(), unsigned LEB128. Absolute, or relative to the previous packet of the channel if the delta bit is set
+ * - values: little endian raw values, or, if the delta bit is set and the channel uses delta encoding,
+ *   the difference to the previous sample of the channel as zig-zag LEB128
+ *
+ * Packets of channel \ref IFX_TELEMETRY_CHANNEL_META describe the stream: the tick frequency
+ * (\ref IFX_TELEMETRY_META_STREAM) and the channels (\ref IFX_TELEMETRY_META_CHANNEL). They are sent
+ * by Ifx_Telemetry_init(), Ifx_Telemetry_addChannel() and Ifx_Telemetry_sendDescriptors().
+ *
+ * Packets are COBS encoded and terminated by a 0 byte, which lets the decoder resynchronise after lost bytes,
+ * or with \ref Ifx_Telemetry_Framing_none only prefixed by their length.
+ * The first packet of a channel, every keyFrameInterval packets, and the packet after a discarded one carry absolute values.
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_TELEMETRY_H
+#define IFX_TELEMETRY_H 1
+
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_TELEMETRY_MAX_CHANNELS)
+#define IFX_CFG_TELEMETRY_MAX_CHANNELS (8)  /**<\brief Maximum number of channels, at most IFX_TELEMETRY_CHANNEL_META */
+#endif
+
+#if !defined(IFX_CFG_TELEMETRY_MAX_VALUES)
+#define IFX_CFG_TELEMETRY_MAX_VALUES   (8)  /**<\brief Maximum number of values of a channel sample */
+#endif
+
+#define IFX_TELEMETRY_CHANNEL_META     (63)     /**<\brief Channel index of the stream description packets */
+#define IFX_TELEMETRY_CHANNEL_MASK     (0x3FU)  /**<\brief Channel index bits of the header byte */
+#define IFX_TELEMETRY_HEADER_DELTA     (0x40U)  /**<\brief Header bit: timestamp and values are relative to the previous packet of the channel */
+
+#define IFX_TELEMETRY_META_STREAM      (0)      /**<\brief Meta packet: uint32 tick frequency in Hz */
+#define IFX_TELEMETRY_META_CHANNEL     (1)      /**<\brief Meta packet: channel index, type, value count, delta flag, name length, name */
+
+#define IFX_TELEMETRY_NAME_SIZE        (16)     /**<\brief Maximum length of a channel name sent in the stream */
+
+/** \brief Maximum size of a packet before framing */
+#define IFX_TELEMETRY_MAX_PACKET_SIZE  (1 + 10 + (IFX_CFG_TELEMETRY_MAX_VALUES * 5) + IFX_TELEMETRY_NAME_SIZE)
+
+/** \brief Maximum size of a framed packet */
+#define IFX_TELEMETRY_MAX_FRAME_SIZE   (IFX_TELEMETRY_MAX_PACKET_SIZE + (IFX_TELEMETRY_MAX_PACKET_SIZE / 254) + 2)
+
+/** \brief Type of the channel values. The value is the size in bytes in bits 0..3 */
+typedef enum
+{
+    Ifx_Telemetry_Type_uint8   = 0x01,
+    Ifx_Telemetry_Type_sint8   = 0x11,
+    Ifx_Telemetry_Type_uint16  = 0x02,
+    Ifx_Telemetry_Type_sint16  = 0x12,
+    Ifx_Telemetry_Type_uint32  = 0x04,
+    Ifx_Telemetry_Type_sint32  = 0x14,
+    Ifx_Telemetry_Type_float32 = 0x24   /**<\brief never delta encoded */
+} Ifx_Telemetry_Type;
+
+/** \brief Framing of the packets on the wire */
+typedef enum
+{
+    Ifx_Telemetry_Framing_cobs = 0,     /**<\brief COBS encoded, terminated by 0 */
+    Ifx_Telemetry_Framing_none = 1      /**<\brief Length byte followed by the packet */
+} Ifx_Telemetry_Framing;
+
+/** \brief Channel configuration */
+typedef struct
+{
+    pchar              name;            /**<\brief Channel name, used as CSV column by the decoder */
+    Ifx_Telemetry_Type type;            /**<\brief Type of the values */
+    uint8              count;           /**<\brief Number of values per sample, at most IFX_CFG_TELEMETRY_MAX_VALUES */
+    boolean            deltaEncoding;   /**<\brief Send the difference to the previous sample instead of the values */
+} Ifx_Telemetry_ChannelConfig;
+
+/** \brief Channel run-time data */
+typedef struct
+{
+    Ifx_Telemetry_ChannelConfig config;                                   /**<\brief Channel configuration */
+    Ifx_TickTime                timestamp;                                /**<\brief Timestamp of the previous packet */
+    uint32                      values[IFX_CFG_TELEMETRY_MAX_VALUES];     /**<\brief Values of the previous packet */
+    uint16                      packetsToKeyFrame;                        /**<\brief Number of delta packets before the next absolute one */
+} Ifx_Telemetry_Channel;
+
+/** \brief Telemetry configuration */
+typedef struct
+{
+    IfxStdIf_DPipe       *standardIo;       /**<\brief Pointer to the IfxStdIf_DPipe object the stream is written to */
+    Ifx_Telemetry_Framing framing;          /**<\brief Framing of the packets */
+    uint16                keyFrameInterval; /**<\brief Number of packets of a channel between two absolute packets */
+} Ifx_Telemetry_Config;
+
+/** \brief Telemetry object. Not reentrant: one object per task / core */
+typedef struct
+{
+    IfxStdIf_DPipe       *io;                                        /**<\brief Pointer to IfxStdIf_DPipe object used by the stream */
+    Ifx_Telemetry_Framing framing;                                   /**<\brief Framing of the packets */
+    uint16                keyFrameInterval;                          /**<\brief Number of packets of a channel between two absolute packets */
+    uint8                 channelCount;                              /**<\brief Number of channels added */
+    uint32                discarded;                                 /**<\brief Number of packets discarded because the pipe was full */
+    Ifx_Telemetry_Channel channel[IFX_CFG_TELEMETRY_MAX_CHANNELS];   /**<\brief Channels */
+} Ifx_Telemetry;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_telemetry
+ * \{ */
+
+IFX_EXTERN void    Ifx_Telemetry_initConfig(Ifx_Telemetry_Config *config, IfxStdIf_DPipe *standardIo);
+IFX_EXTERN boolean Ifx_Telemetry_init(Ifx_Telemetry *telemetry, const Ifx_Telemetry_Config *config);
+IFX_EXTERN sint32  Ifx_Telemetry_addChannel(Ifx_Telemetry *telemetry, const Ifx_Telemetry_ChannelConfig *config);
+IFX_EXTERN boolean Ifx_Telemetry_sendDescriptors(Ifx_Telemetry *telemetry);
+IFX_EXTERN boolean Ifx_Telemetry_write(Ifx_Telemetry *telemetry, sint32 channel, const void *values);
+IFX_EXTERN boolean Ifx_Telemetry_writeAt(Ifx_Telemetry *telemetry, sint32 channel, Ifx_TickTime timestamp, const void *values);
+
+IFX_EXTERN Ifx_SizeT Ifx_Telemetry_encodeCobs(uint8 *frame, const uint8 *packet, Ifx_SizeT length);
+IFX_EXTERN Ifx_SizeT Ifx_Telemetry_decodeCobs(uint8 *packet, const uint8 *frame, Ifx_SizeT length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -34,7 +34,10 @@
 //________________________________________________________________________________________
 // LOCAL DEFINITIONS
 
-#define IFX_ANGLETRKF32_ATAN2F Ifx_LutAtan2F32_float32
+#define IFX_ANGLETRKF32_ATAN2F IFX_CFG_ANGLETRKF32_ATAN2F
+
+/** \brief Maximal number of observers interleaved by Ifx_AngleTrkF32_stepBlockMulti() */
+#define IFX_ANGLETRKF32_MULTI_GROUP (4)
 
 //________________________________________________________________________________________
 // LOCAL FUNCTION PROTOTYPES
@@ -188,32 +191,16 @@ void Ifx_AngleTrkF32_init(Ifx_AngleTrkF32 *aObsv, const Ifx_AngleTrkF32_Config *
 }
 
 
-/** \brief Step function of Ifx_AngleTrkF32 should be called at every sampling period provided
- * during initialisation (call to Ifx_AngleTrkF32_init()).
- *
- * \note This function is automatically called by Ifx_AngleTrkF32_update()
- * \param sinIn sine input signal. The offset shall be zero.
- * \param cosIn cosine input signal. The offset shall be zero.
+/** \brief Observer loop: update the estimates from the reference angle
+ * \param aObsv Pointer to the Ifx_AngleTrkF32 object
+ * \param angleRef Reference angle (measured) in radians
  * \return the angular position in radians
- * \note The amplitude of both sinIn and cosIn signal shall be the same.
  */
-float32 Ifx_AngleTrkF32_step(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn, float32 phase)
+IFX_INLINE float32 Ifx_AngleTrkF32_track(Ifx_AngleTrkF32 *aObsv, float32 angleRef)
 {
-    float32 angleRef, angleEst, dAccel, dSpeed, dAngle;
-
-    if (aObsv->base.reversed != FALSE)
-    {
-        angleRef = IFX_ANGLETRKF32_ATAN2F((float32)cosIn, (float32)sinIn);
-    }
-    else
-    {
-        angleRef = IFX_ANGLETRKF32_ATAN2F((float32)sinIn, (float32)cosIn);
-    }
+    float32 angleEst, dAccel, dSpeed, dAngle;
 
-    aObsv->angleAtan = angleRef;
-    angleRef         = angleRef + phase;
-
-    aObsv->angleRef  = angleRef;
+    aObsv->angleRef = angleRef;
 
     // Acceleration, zero-order-hold integrator:
     dAccel          = aObsv->cfgData.ki * aObsv->angleErr;
@@ -244,6 +231,184 @@ float32 Ifx_AngleTrkF32_step(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn,
 }
 
 
+/** \brief Set the raw position from the estimated angle */
+IFX_INLINE void Ifx_AngleTrkF32_setRawPosition(Ifx_AngleTrkF32 *aObsv, float32 angleEst)
+{
+    Ifx_AngleTrkF32_PosIf *base        = &aObsv->base;
+    IfxStdIf_Pos_RawAngle  newPosition = (IfxStdIf_Pos_RawAngle)(angleEst * (base->resolution / 2) / IFX_PI);
+    newPosition       = newPosition & (base->resolution - 1);
+    base->rawPosition = newPosition;
+}
+
+
+/** \brief Set the status flags from the amplitude range and the maximum tracking error */
+IFX_INLINE void Ifx_AngleTrkF32_setStatus(Ifx_AngleTrkF32 *aObsv, sint32 sqrAmplMin, sint32 sqrAmplMax, float32 errorMax)
+{
+    Ifx_AngleTrkF32_PosIf *base = &aObsv->base;
+    base->status.B.signalLoss        = (sqrAmplMin < aObsv->cfgData.sqrAmplMin);
+    base->status.B.signalDegradation = (sqrAmplMax > aObsv->cfgData.sqrAmplMax);
+    base->status.B.trackingLoss      = errorMax > aObsv->cfgData.errorThreshold;
+}
+
+
+/** \brief Step function of Ifx_AngleTrkF32 should be called at every sampling period provided
+ * during initialisation (call to Ifx_AngleTrkF32_init()).
+ *
+ * \note This function is automatically called by Ifx_AngleTrkF32_update()
+ * \param sinIn sine input signal. The offset shall be zero.
+ * \param cosIn cosine input signal. The offset shall be zero.
+ * \return the angular position in radians
+ * \note The amplitude of both sinIn and cosIn signal shall be the same.
+ */
+float32 Ifx_AngleTrkF32_step(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn, float32 phase)
+{
+    float32 angleRef;
+
+    if (aObsv->base.reversed != FALSE)
+    {
+        angleRef = IFX_ANGLETRKF32_ATAN2F(cosIn, sinIn);
+    }
+    else
+    {
+        angleRef = IFX_ANGLETRKF32_ATAN2F(sinIn, cosIn);
+    }
+
+    aObsv->angleAtan = angleRef;
+
+    return Ifx_AngleTrkF32_track(aObsv, angleRef + phase);
+}
+
+
+/** \brief Process a block of samples, e.g. a DSADC result buffer or a captured trace.
+ *
+ * Equivalent to count calls of Ifx_AngleTrkF32_update() with the samples sinIn[i], cosIn[i], with the
+ * observer state kept in registers. The status flags are set if the condition occurred for any sample
+ * of the block. To process several observers (motors) on one core, see Ifx_AngleTrkF32_stepBlockMulti().
+ *
+ * \param aObsv Pointer to the Ifx_AngleTrkF32 object
+ * \param sinIn count sine input samples. The offset shall be zero.
+ * \param cosIn count cosine input samples. The offset shall be zero.
+ * \param angleEst count estimated angles in radians, may be NULL_PTR
+ * \param count Number of samples
+ * \return the angular position in radians after the last sample
+ */
+float32 Ifx_AngleTrkF32_stepBlock(Ifx_AngleTrkF32 *IFX_RESTRICT aObsv, const sint16 *sinIn, const sint16 *cosIn, float32 *IFX_RESTRICT angleEst, sint32 count)
+{
+    const sint16 *yIn        = (aObsv->base.reversed != FALSE) ? cosIn : sinIn;
+    const sint16 *xIn        = (aObsv->base.reversed != FALSE) ? sinIn : cosIn;
+    sint32        sqrAmplMin = 0x7FFFFFFF;
+    sint32        sqrAmplMax = 0;
+    float32       errorMax   = 0.0f;
+    float32       angle      = aObsv->angleEst;
+    sint32        i;
+
+    for (i = 0; i < count; i++)
+    {
+        sint32 sqrAmpl = ((sint32)sinIn[i] * (sint32)sinIn[i]) + ((sint32)cosIn[i] * (sint32)cosIn[i]);
+
+        aObsv->angleAtan = IFX_ANGLETRKF32_ATAN2F(yIn[i], xIn[i]);
+        angle            = Ifx_AngleTrkF32_track(aObsv, aObsv->angleAtan);
+
+        if (angleEst != NULL_PTR)
+        {
+            angleEst[i] = angle;
+        }
+
+        sqrAmplMin = __min(sqrAmplMin, sqrAmpl);
+        sqrAmplMax = __max(sqrAmplMax, sqrAmpl);
+        errorMax   = __maxf(errorMax, __absf(aObsv->angleErr));
+    }
+
+    if (count > 0)
+    {
+        Ifx_AngleTrkF32_setRawPosition(aObsv, angle);
+        Ifx_AngleTrkF32_setStatus(aObsv, sqrAmplMin, sqrAmplMax, errorMax);
+    }
+
+    return angle;
+}
+
+
+/** \brief Process a block of samples for several observers, e.g. the resolvers of several motors,
+ * or one captured trace with different observer gains.
+ *
+ * Same result as Ifx_AngleTrkF32_stepBlock() called for each observer, but the observers are stepped
+ * in turn for each sample, so that the CPU pipeline overlaps their independent loop computations.
+ *
+ * \param aObsv Array of observers Ifx_AngleTrkF32 objects
+ * \param observers Number of observers
+ * \param sinIn Array of observers pointers to the count sine input samples of each observer
+ * \param cosIn Array of observers pointers to the count cosine input samples of each observer
+ * \param angleEst Array of observers pointers to the count estimated angles of each observer, may be NULL_PTR
+ * \param count Number of samples
+ * \return None
+ */
+void Ifx_AngleTrkF32_stepBlockMulti(Ifx_AngleTrkF32 *aObsv, sint32 observers, const sint16 *const *sinIn, const sint16 *const *cosIn, float32 *const *angleEst, sint32 count)
+{
+    sint32 first;
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    /* Observers are processed in groups, so that the signal checks are accumulated in local variables */
+    for (first = 0; first < observers; first += IFX_ANGLETRKF32_MULTI_GROUP)
+    {
+        sint32  group = __min(observers - first, IFX_ANGLETRKF32_MULTI_GROUP);
+        sint32  sqrAmplMin[IFX_ANGLETRKF32_MULTI_GROUP];
+        sint32  sqrAmplMax[IFX_ANGLETRKF32_MULTI_GROUP];
+        float32 errorMax[IFX_ANGLETRKF32_MULTI_GROUP];
+        sint32  i, k;
+
+        for (k = 0; k < group; k++)
+        {
+            sqrAmplMin[k] = 0x7FFFFFFF;
+            sqrAmplMax[k] = 0;
+            errorMax[k]   = 0.0f;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            for (k = 0; k < group; k++)
+            {
+                Ifx_AngleTrkF32 *obsv    = &aObsv[first + k];
+                sint32           sinVal  = sinIn[first + k][i];
+                sint32           cosVal  = cosIn[first + k][i];
+                sint32           sqrAmpl = (sinVal * sinVal) + (cosVal * cosVal);
+                float32          angle;
+
+                if (obsv->base.reversed != FALSE)
+                {
+                    obsv->angleAtan = IFX_ANGLETRKF32_ATAN2F((sint16)cosVal, (sint16)sinVal);
+                }
+                else
+                {
+                    obsv->angleAtan = IFX_ANGLETRKF32_ATAN2F((sint16)sinVal, (sint16)cosVal);
+                }
+
+                angle = Ifx_AngleTrkF32_track(obsv, obsv->angleAtan);
+
+                if (angleEst != NULL_PTR)
+                {
+                    angleEst[first + k][i] = angle;
+                }
+
+                sqrAmplMin[k] = __min(sqrAmplMin[k], sqrAmpl);
+                sqrAmplMax[k] = __max(sqrAmplMax[k], sqrAmpl);
+                errorMax[k]   = __maxf(errorMax[k], __absf(obsv->angleErr));
+            }
+        }
+
+        for (k = 0; k < group; k++)
+        {
+            Ifx_AngleTrkF32_setRawPosition(&aObsv[first + k], aObsv[first + k].angleEst);
+            Ifx_AngleTrkF32_setStatus(&aObsv[first + k], sqrAmplMin[k], sqrAmplMax[k], errorMax[k]);
+        }
+    }
+}
+
+
 /** \brief Set the position offset (in ticks)
  * \param aObsv Pointer to the Ifx_AngleTrkF32 object
  * \param offset Position offset in ticks */
@@ -262,11 +427,8 @@ void Ifx_AngleTrkF32_setOffset(Ifx_AngleTrkF32 *aObsv, IfxStdIf_Pos_RawAngle off
  */
 void Ifx_AngleTrkF32_updateStatus(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn)
 {
-    Ifx_AngleTrkF32_PosIf *base    = &aObsv->base;
-    sint32                  sqrAmpl = ((sint32)sinIn * (sint32)sinIn) + ((sint32)cosIn * (sint32)cosIn);
-    base->status.B.signalLoss        = (sqrAmpl < aObsv->cfgData.sqrAmplMin);
-    base->status.B.signalDegradation = (sqrAmpl > aObsv->cfgData.sqrAmplMax);
-    base->status.B.trackingLoss      = __absf(aObsv->angleErr) > aObsv->cfgData.errorThreshold;
+    sint32 sqrAmpl = ((sint32)sinIn * (sint32)sinIn) + ((sint32)cosIn * (sint32)cosIn);
+    Ifx_AngleTrkF32_setStatus(aObsv, sqrAmpl, sqrAmpl, __absf(aObsv->angleErr));
 }
 
 
@@ -275,13 +437,9 @@ void Ifx_AngleTrkF32_updateStatus(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 c
  */
 void Ifx_AngleTrkF32_update(Ifx_AngleTrkF32 *aObsv)
 {
-    Ifx_AngleTrkF32_PosIf *base        = &aObsv->base;
-    float32                 angleEst    = Ifx_AngleTrkF32_step(aObsv, *aObsv->sinIn, *aObsv->cosIn, 0);
-
-    IfxStdIf_Pos_RawAngle   newPosition = (IfxStdIf_Pos_RawAngle)(angleEst * (aObsv->base.resolution / 2) / IFX_PI);
-    newPosition       = newPosition & (aObsv->base.resolution - 1);
-    base->rawPosition = newPosition;
+    float32 angleEst = Ifx_AngleTrkF32_step(aObsv, *aObsv->sinIn, *aObsv->cosIn, 0);
 
+    Ifx_AngleTrkF32_setRawPosition(aObsv, angleEst);
     Ifx_AngleTrkF32_updateStatus(aObsv, *aObsv->sinIn, *aObsv->cosIn);
 }
 
@@ -44,6 +44,13 @@
 #define IFX_CFG_ANGLETRKF32_SPEED_FILTER (1)
 #endif
 
+#ifndef IFX_CFG_ANGLETRKF32_ATAN2F
+/** \brief atan2 function float32 f(y, x) used by Ifx_AngleTrkF32_step(), called with the sint16 inputs:
+ * Ifx_LutAtan2F32_float32 (lookup table and division) or Ifx_LutAtan2F32_sint16 (division-free polynomial,
+ * for CPUs with a slow floating point division) */
+#define IFX_CFG_ANGLETRKF32_ATAN2F       Ifx_LutAtan2F32_float32
+#endif
+
 //________________________________________________________________________________________
 // DATA STRUCTURES
 
@@ -136,6 +143,21 @@ IFX_EXTERN void Ifx_AngleTrkF32_init(Ifx_AngleTrkF32 *aObsv, const Ifx_AngleTrkF
 IFX_EXTERN void Ifx_AngleTrkF32_initConfig(Ifx_AngleTrkF32_Config *config, sint16 *sinIn, sint16 *cosIn);
 /** \} */
 
+/** \name Block processing
+ * Replay of a captured resolver trace, or of a DSADC result buffer:
+ * \code
+ * extern sint16 sinTrace[1000], cosTrace[1000];
+ * float32       angle[1000];
+ * Ifx_AngleTrkF32_stepBlock(&driverData, sinTrace, cosTrace, angle, 1000);
+ * \endcode
+ * Ifx_AngleTrkF32_stepBlockMulti() steps several observers in turn, which is faster than one block per observer
+ * when the observers are independent, e.g. two motors, or a gain sweep on the same trace.
+ * On the host, 1_ToolEnv/1_Host/Tools/Ifx_AngleTrkReplay.c replays CSV traces (e.g. from Ifx_TelemetryDecode).
+ * \{ */
+IFX_EXTERN float32 Ifx_AngleTrkF32_stepBlock(Ifx_AngleTrkF32 *IFX_RESTRICT aObsv, const sint16 *sinIn, const sint16 *cosIn, float32 *IFX_RESTRICT angleEst, sint32 count);
+IFX_EXTERN void    Ifx_AngleTrkF32_stepBlockMulti(Ifx_AngleTrkF32 *aObsv, sint32 observers, const sint16 *const *sinIn, const sint16 *const *cosIn, float32 *const *angleEst, sint32 count);
+/** \} */
+
 /** \name Protected functions
  * These functions are not for end-user but may be used by another driver which extends
  * the functionality of library_srvsw_sysse_math_f32_angletrk
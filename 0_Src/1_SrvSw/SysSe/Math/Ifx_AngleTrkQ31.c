@@ -0,0 +1,483 @@
+/**
+ * \file Ifx_AngleTrkQ31.c
+ * \brief Fixed-point angle-tracking observer for sin/cos analog position sensor
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//________________________________________________________________________________________
+// INCLUDES
+
+#include "Ifx_AngleTrkQ31.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "string.h"
+
+//________________________________________________________________________________________
+// LOCAL DEFINITIONS
+
+#define IFX_ANGLETRKQ31_PI      (2147483648.0f)     /**< \brief IFX_PI as Q31 angle (float) */
+#define IFX_ANGLETRKQ31_PI_HALF (0x40000000)        /**< \brief IFX_PI / 2 as Q31 angle */
+
+/** \brief Q30 coefficients of atan(r) * 2 / IFX_PI = r * P(r^2), r = 0 .. 1 */
+#define IFX_ANGLETRKQ31_ATAN_C1 (683549704)
+#define IFX_ANGLETRKQ31_ATAN_C3 (-227369416)
+#define IFX_ANGLETRKQ31_ATAN_C5 (132297497)
+#define IFX_ANGLETRKQ31_ATAN_C7 (-79585113)
+#define IFX_ANGLETRKQ31_ATAN_C9 (35987900)
+#define IFX_ANGLETRKQ31_ATAN_C11 (-8010790)
+
+//________________________________________________________________________________________
+// LOCAL FUNCTION IMPLEMENTATIONS
+
+/** \brief Return a * b, a and b in Q30 */
+IFX_INLINE sint32 Ifx_AngleTrkQ31_mulQ30(sint32 a, sint32 b)
+{
+    return (sint32)(((sint64)a * b) >> 30);
+}
+
+
+/** \brief Return gain * error, with 32 bits below the Q31 error */
+IFX_INLINE sint64 Ifx_AngleTrkQ31_mulGain(const Ifx_AngleTrkQ31_Gain *gain, sint32 error)
+{
+    return ((sint64)gain->mantissa * error * 2) >> gain->shift;
+}
+
+
+IFX_INLINE sint32 Ifx_AngleTrkQ31_atan2Private(sint16 y, sint16 x)
+{
+    uint32 ay  = (uint32)__abs((sint32)y);
+    uint32 ax  = (uint32)__abs((sint32)x);
+    uint32 num = __minu(ax, ay);
+    uint32 den = __maxu(ax, ay);
+    sint32 r, r2, r4, p, angle;
+
+    if (den == 0)
+    {
+        return 0;
+    }
+
+    /* r = num / den rounded to 16 bits, in Q30 */
+    r  = (sint32)(((num << 16) + (den >> 1)) / den) << 14;
+    r2 = Ifx_AngleTrkQ31_mulQ30(r, r);
+    r4 = Ifx_AngleTrkQ31_mulQ30(r2, r2);
+
+    /* P(r^2), Estrin scheme */
+    p = IFX_ANGLETRKQ31_ATAN_C1 + Ifx_AngleTrkQ31_mulQ30(IFX_ANGLETRKQ31_ATAN_C3, r2)
+        + Ifx_AngleTrkQ31_mulQ30(r4, IFX_ANGLETRKQ31_ATAN_C5 + Ifx_AngleTrkQ31_mulQ30(IFX_ANGLETRKQ31_ATAN_C7, r2)
+        + Ifx_AngleTrkQ31_mulQ30(r4, IFX_ANGLETRKQ31_ATAN_C9 + Ifx_AngleTrkQ31_mulQ30(IFX_ANGLETRKQ31_ATAN_C11, r2)));
+
+    /* angle in the first octant, as Q31 */
+    angle = Ifx_AngleTrkQ31_mulQ30(r, p);
+
+    /* restore the octant */
+    angle = (ay > ax) ? (IFX_ANGLETRKQ31_PI_HALF - angle) : angle;
+    angle = (x < 0) ? (sint32)(0x80000000U - (uint32)angle) : angle;
+
+    return (y < 0) ? -angle : angle;
+}
+
+
+/** \brief Convert a gain to a per-sample gain
+ * \return FALSE if the gain is not in the range 0 .. 1 */
+static boolean Ifx_AngleTrkQ31_setGain(Ifx_AngleTrkQ31_Gain *gain, float32 value)
+{
+    boolean result = (value >= 0.0f) && (value < 1.0f);
+
+    gain->mantissa = 0;
+    gain->shift    = 0;
+
+    if (result && (value > 0.0f))
+    {
+        while ((value < 0.5f) && (gain->shift < 62))
+        {
+            value = value * 2.0f;
+            gain->shift++;
+        }
+
+        gain->mantissa = (sint32)(value * IFX_ANGLETRKQ31_PI);
+    }
+
+    return result;
+}
+
+
+/** \brief Compute the per-sample gains and constants from the gains and the sampling period
+ * \return FALSE if a per-sample gain is out of range */
+static boolean Ifx_AngleTrkQ31_setUserSampling(Ifx_AngleTrkQ31 *aObsv, float32 Ts)
+{
+    Ifx_AngleTrkQ31_CfgData *cfgData = &aObsv->cfgData;
+    boolean                  result  = TRUE;
+    float32                  tStar   = 1.0f / ((1.0f / (2.0f * IFX_PI * cfgData->speedLpfFc * Ts)) + 1.0f);
+
+    aObsv->base.Ts    = Ts;
+    aObsv->speedConst = IFX_PI / (IFX_ANGLETRKQ31_PI * Ts);
+
+    result &= Ifx_AngleTrkQ31_setGain(&cfgData->kdTs, cfgData->kd * Ts);
+    result &= Ifx_AngleTrkQ31_setGain(&cfgData->kpTs2, cfgData->kp * Ts * Ts);
+    result &= Ifx_AngleTrkQ31_setGain(&cfgData->kiTs3, cfgData->ki * Ts * Ts * Ts);
+
+    cfgData->speedLpfGain = (sint32)(__minf(tStar, 0.5f) * IFX_ANGLETRKQ31_PI);
+
+    return result;
+}
+
+
+/** \brief Observer loop: update the estimates from the reference angle
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ * \param angleRef Reference angle (measured), Q31
+ * \return the angular position, Q31
+ */
+IFX_INLINE sint32 Ifx_AngleTrkQ31_track(Ifx_AngleTrkQ31 *aObsv, sint32 angleRef)
+{
+    const Ifx_AngleTrkQ31_CfgData *cfgData = &aObsv->cfgData;
+    sint64                         dAngle;
+    sint32                         angleEst;
+
+    aObsv->angleRef = angleRef;
+
+    // Acceleration, zero-order-hold integrator:
+    aObsv->accelEst = aObsv->accelEst + Ifx_AngleTrkQ31_mulGain(&cfgData->kiTs3, aObsv->angleErr);
+
+    // Speed, zero-order-hold integrator:
+    aObsv->speedEstA = aObsv->speedEstA + Ifx_AngleTrkQ31_mulGain(&cfgData->kpTs2, aObsv->angleErr) + aObsv->accelEst;
+
+    // Angle, first-order-hold integrator, wraps around at +/- IFX_PI:
+    dAngle           = Ifx_AngleTrkQ31_mulGain(&cfgData->kdTs, aObsv->angleErr) + aObsv->speedEstA;
+    aObsv->angleEst  = aObsv->angleEst + (uint64)((dAngle + aObsv->speedEstB) >> 1);
+    aObsv->speedEstB = dAngle;
+    angleEst         = (sint32)(uint32)(aObsv->angleEst >> 32);
+
+    // Error, is calculated here to compensate one period delay
+    aObsv->angleErr       = (sint32)((uint32)angleRef - (uint32)angleEst);
+
+    aObsv->base.direction = aObsv->speedEstB > 0 ? IfxStdIf_Pos_Dir_forward : IfxStdIf_Pos_Dir_backward;
+
+#if IFX_CFG_ANGLETRKQ31_SPEED_FILTER
+    // Filter speed:
+    aObsv->speedLpf = aObsv->speedLpf + (sint32)((((aObsv->speedEstB >> 32) - aObsv->speedLpf) * cfgData->speedLpfGain) >> 31);
+#endif
+
+    return angleEst;
+}
+
+
+/** \brief Set the raw position from the estimated angle */
+IFX_INLINE void Ifx_AngleTrkQ31_setRawPosition(Ifx_AngleTrkQ31 *aObsv, sint32 angleEst)
+{
+    aObsv->base.rawPosition = (IfxStdIf_Pos_RawAngle)(((uint32)angleEst + aObsv->angleOffset) >> aObsv->positionShift);
+}
+
+
+//________________________________________________________________________________________
+// PUBLIC FUNCTION IMPLEMENTATIONS
+
+/** \brief Fill config with default values, see Ifx_AngleTrkF32_initConfig() */
+void Ifx_AngleTrkQ31_initConfig(Ifx_AngleTrkQ31_Config *config, sint16 *sinIn, sint16 *cosIn)
+{
+    Ifx_AngleTrkF32_initConfig(config, sinIn, cosIn);
+}
+
+
+/** \brief Initialize the Angle Tracking object
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ * \param config Pointer to the configuration data
+ * \param Ts sampling period in seconds
+ * \return TRUE on success, FALSE if the resolution is not a power of 2 or a per-sample gain is not lower than 1
+ */
+boolean Ifx_AngleTrkQ31_init(Ifx_AngleTrkQ31 *aObsv, const Ifx_AngleTrkQ31_Config *config, float32 Ts)
+{
+    boolean result = TRUE;
+    uint8   bits;
+
+    for (bits = 1; (bits < 31) && ((1L << bits) < config->resolution); bits++)
+    {}
+
+    result &= (1L << bits) == config->resolution;
+
+    aObsv->base.resolution        = config->resolution;
+    aObsv->base.reversed          = config->reversed;
+    aObsv->base.rawPosition       = 0;
+    aObsv->base.direction         = IfxStdIf_Pos_Dir_unknown;
+    aObsv->base.turn              = 0;
+    aObsv->base.status.status     = 0;
+    aObsv->base.periodPerRotation = config->periodPerRotation;
+    aObsv->base.positionConst     = 1.0 / (float32)aObsv->base.resolution * 2.0 * IFX_PI;
+    aObsv->positionShift          = (uint8)(32 - bits);
+    Ifx_AngleTrkQ31_setOffset(aObsv, config->offset);
+
+    aObsv->cfgData.kd             = config->kd;
+    aObsv->cfgData.ki             = config->ki;
+    aObsv->cfgData.kp             = config->kp;
+    aObsv->cfgData.speedLpfFc     = config->speedLpfFc;
+    aObsv->cfgData.errorThreshold = (sint32)(__minf(config->errorThreshold / IFX_PI, 0.5f) * IFX_ANGLETRKQ31_PI);
+    aObsv->cfgData.sqrAmplMax     = config->sqrAmplMax;
+    aObsv->cfgData.sqrAmplMin     = config->sqrAmplMin;
+    aObsv->sinIn                  = config->sinIn;
+    aObsv->cosIn                  = config->cosIn;
+
+    if (!__neqf(config->kp, 0) && !__neqf(config->ki, 0) && !__neqf(config->kd, 0))
+    {   /* all gains are zero, use default */
+        Ifx_AngleTrkF32_Config defaultConfig;
+        Ifx_AngleTrkF32_initConfig(&defaultConfig, config->sinIn, config->cosIn);
+        aObsv->cfgData.kd = defaultConfig.kd;
+        aObsv->cfgData.ki = defaultConfig.ki;
+        aObsv->cfgData.kp = defaultConfig.kp;
+    }
+
+    result &= Ifx_AngleTrkQ31_setUserSampling(aObsv, Ts);
+    Ifx_AngleTrkQ31_reset(aObsv);
+
+    return result;
+}
+
+
+/** \brief Return atan2(y, x) as Q31 angle, with integer instructions only
+ *
+ * The ratio of the smaller to the larger input is computed with an integer division, atan is
+ * approximated by a polynomial. The maximal error is 1e-5 rad.
+ *
+ * \param y y input (sine)
+ * \param x x input (cosine)
+ * \return the angle, Q31 (0x80000000 = -IFX_PI). 0 for x = y = 0.
+ */
+sint32 Ifx_AngleTrkQ31_atan2(sint16 y, sint16 x)
+{
+    return Ifx_AngleTrkQ31_atan2Private(y, x);
+}
+
+
+/** \brief Step function of Ifx_AngleTrkQ31 should be called at every sampling period provided
+ * during initialisation (call to Ifx_AngleTrkQ31_init()).
+ *
+ * \note This function is automatically called by Ifx_AngleTrkQ31_update()
+ * \param sinIn sine input signal. The offset shall be zero.
+ * \param cosIn cosine input signal. The offset shall be zero.
+ * \param phase Angle added to the measured angle, Q31
+ * \return the angular position, Q31
+ * \note The amplitude of both sinIn and cosIn signal shall be the same.
+ */
+sint32 Ifx_AngleTrkQ31_step(Ifx_AngleTrkQ31 *aObsv, sint16 sinIn, sint16 cosIn, sint32 phase)
+{
+    sint32 angleRef;
+
+    if (aObsv->base.reversed != FALSE)
+    {
+        angleRef = Ifx_AngleTrkQ31_atan2Private(cosIn, sinIn);
+    }
+    else
+    {
+        angleRef = Ifx_AngleTrkQ31_atan2Private(sinIn, cosIn);
+    }
+
+    aObsv->angleAtan = angleRef;
+
+    return Ifx_AngleTrkQ31_track(aObsv, (sint32)((uint32)angleRef + (uint32)phase));
+}
+
+
+/** \brief Update the status flags.
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ * \param sinIn Sinus value
+ * \param cosIn Cosinus value
+ * \note This function is automatically called by Ifx_AngleTrkQ31_update()
+ */
+void Ifx_AngleTrkQ31_updateStatus(Ifx_AngleTrkQ31 *aObsv, sint16 sinIn, sint16 cosIn)
+{
+    Ifx_AngleTrkF32_PosIf *base    = &aObsv->base;
+    sint32                 sqrAmpl = ((sint32)sinIn * (sint32)sinIn) + ((sint32)cosIn * (sint32)cosIn);
+    sint32                 error   = aObsv->angleErr;
+
+    base->status.B.signalLoss        = (sqrAmpl < aObsv->cfgData.sqrAmplMin);
+    base->status.B.signalDegradation = (sqrAmpl > aObsv->cfgData.sqrAmplMax);
+    base->status.B.trackingLoss      = (error > aObsv->cfgData.errorThreshold) || (error < -aObsv->cfgData.errorThreshold);
+}
+
+
+/** \brief Update the object directly from its analog input
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ */
+void Ifx_AngleTrkQ31_update(Ifx_AngleTrkQ31 *aObsv)
+{
+    sint32 angleEst = Ifx_AngleTrkQ31_step(aObsv, *aObsv->sinIn, *aObsv->cosIn, 0);
+
+    Ifx_AngleTrkQ31_setRawPosition(aObsv, angleEst);
+    Ifx_AngleTrkQ31_updateStatus(aObsv, *aObsv->sinIn, *aObsv->cosIn);
+}
+
+
+/** \brief Set the position offset (in ticks)
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ * \param offset Position offset in ticks */
+void Ifx_AngleTrkQ31_setOffset(Ifx_AngleTrkQ31 *aObsv, IfxStdIf_Pos_RawAngle offset)
+{
+    aObsv->base.offset = offset;
+    aObsv->angleOffset = (uint32)offset << aObsv->positionShift;
+}
+
+
+/** \brief Returns the actual position
+ * \param aObsv Pointer to the Ifx_AngleTrkQ31 object
+ * \return the angular position in ticks [0 .. Ifx_AngleTrkQ31.base.resolution-1] (represents
+ * 0..360 degree), including the offset
+ */
+IfxStdIf_Pos_RawAngle Ifx_AngleTrkQ31_getRawPosition(Ifx_AngleTrkQ31 *aObsv)
+{
+    return aObsv->base.rawPosition;
+}
+
+
+float32 Ifx_AngleTrkQ31_getSpeed(Ifx_AngleTrkQ31 *aObsv)
+{
+#if IFX_CFG_ANGLETRKQ31_SPEED_FILTER
+    return (float32)aObsv->speedLpf * aObsv->speedConst;
+#else
+    return Ifx_AngleTrkQ31_getLoopSpeed(aObsv);
+#endif
+}
+
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+float32 Ifx_AngleTrkQ31_getAbsolutePosition(Ifx_AngleTrkQ31 *driver)
+{
+    return ((float32)driver->base.turn + (float32)driver->base.rawPosition / (float32)driver->base.resolution) * 2.0 * IFX_PI;
+}
+
+
+IfxStdIf_Pos_Dir Ifx_AngleTrkQ31_getDirection(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.direction;
+}
+
+
+IfxStdIf_Pos_Status Ifx_AngleTrkQ31_getFault(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.status;
+}
+
+
+sint32 Ifx_AngleTrkQ31_getOffset(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.offset;
+}
+
+
+uint16 Ifx_AngleTrkQ31_getPeriodPerRotation(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.periodPerRotation;
+}
+
+
+float32 Ifx_AngleTrkQ31_getPosition(Ifx_AngleTrkQ31 *driver)
+{
+    return (float32)driver->base.rawPosition * driver->base.positionConst;
+}
+
+
+float32 Ifx_AngleTrkQ31_getRefreshPeriod(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.Ts;
+}
+
+
+sint32 Ifx_AngleTrkQ31_getResolution(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.resolution;
+}
+
+
+IfxStdIf_Pos_SensorType Ifx_AngleTrkQ31_getSensorType(Ifx_AngleTrkQ31 *driver)
+{
+    return IfxStdIf_Pos_SensorType_angletrk;
+}
+
+
+sint32 Ifx_AngleTrkQ31_getTurn(Ifx_AngleTrkQ31 *driver)
+{
+    return driver->base.turn;
+}
+
+
+void Ifx_AngleTrkQ31_resetFaults(Ifx_AngleTrkQ31 *driver)
+{
+    driver->base.status.status = 0;
+}
+
+
+/** \brief Set the sampling period, the per-sample gains are recomputed */
+void Ifx_AngleTrkQ31_setRefreshPeriod(Ifx_AngleTrkQ31 *driver, float32 updatePeriod)
+{
+    (void)Ifx_AngleTrkQ31_setUserSampling(driver, updatePeriod);
+}
+
+
+void Ifx_AngleTrkQ31_reset(Ifx_AngleTrkQ31 *driver)
+{
+    driver->base.rawPosition = 0;
+    driver->base.direction   = IfxStdIf_Pos_Dir_unknown;
+    driver->base.turn        = 0;
+    driver->angleAtan        = 0;
+    driver->angleRef         = 0;
+    driver->angleErr         = 0;
+    driver->angleEst         = 0;
+    driver->accelEst         = 0;
+    driver->speedEstA        = 0;
+    driver->speedEstB        = 0;
+    driver->speedLpf         = 0;
+
+    driver->base.status.status = 0;
+}
+
+
+boolean Ifx_AngleTrkQ31_stdIfPosInit(IfxStdIf_Pos *stdif, Ifx_AngleTrkQ31 *driver)
+{
+    /* Ensure the stdif is reset to zeros */
+    memset(stdif, 0, sizeof(IfxStdIf_Pos));
+
+    /* Set the driver */
+    stdif->driver = driver;
+
+    /* *INDENT-OFF* Note: this file was indented manually by the author. */
+    /* Set the API link */
+    stdif->onZeroIrq            =(IfxStdIf_Pos_OnZeroIrq               )NULL_PTR;
+    stdif->getAbsolutePosition  =(IfxStdIf_Pos_GetAbsolutePosition     )&Ifx_AngleTrkQ31_getAbsolutePosition;
+    stdif->getDirection         =(IfxStdIf_Pos_GetDirection            )&Ifx_AngleTrkQ31_getDirection;
+    stdif->getFault             =(IfxStdIf_Pos_GetFault                )&Ifx_AngleTrkQ31_getFault;
+    stdif->getOffset            =(IfxStdIf_Pos_GetOffset               )&Ifx_AngleTrkQ31_getOffset;
+    stdif->getPeriodPerRotation =(IfxStdIf_Pos_GetPeriodPerRotation    )&Ifx_AngleTrkQ31_getPeriodPerRotation;
+    stdif->getPosition          =(IfxStdIf_Pos_GetPosition             )&Ifx_AngleTrkQ31_getPosition;
+    stdif->getRawPosition       =(IfxStdIf_Pos_GetRawPosition          )&Ifx_AngleTrkQ31_getRawPosition;
+    stdif->getRefreshPeriod     =(IfxStdIf_Pos_GetRefreshPeriod        )&Ifx_AngleTrkQ31_getRefreshPeriod;
+    stdif->getResolution        =(IfxStdIf_Pos_GetResolution           )&Ifx_AngleTrkQ31_getResolution;
+    stdif->getSensorType        =(IfxStdIf_Pos_GetSensorType           )&Ifx_AngleTrkQ31_getSensorType;
+    stdif->reset                =(IfxStdIf_Pos_Reset                   )&Ifx_AngleTrkQ31_reset;
+    stdif->resetFaults          =(IfxStdIf_Pos_ResetFaults             )&Ifx_AngleTrkQ31_resetFaults;
+    stdif->getSpeed             =(IfxStdIf_Pos_GetSpeed                )&Ifx_AngleTrkQ31_getSpeed;
+    stdif->update               =(IfxStdIf_Pos_Update                  )&Ifx_AngleTrkQ31_update;
+    stdif->setPosition          =(IfxStdIf_Pos_SetPosition             )NULL_PTR;
+    stdif->setRawPosition       =(IfxStdIf_Pos_SetRawPosition          )NULL_PTR;
+    stdif->setSpeed             =(IfxStdIf_Pos_SetSpeed                )NULL_PTR;
+    stdif->setOffset            =(IfxStdIf_Pos_SetOffset               )&Ifx_AngleTrkQ31_setOffset;
+    stdif->setRefreshPeriod     =(IfxStdIf_Pos_SetRefreshPeriod        )&Ifx_AngleTrkQ31_setRefreshPeriod;
+    stdif->getTurn              =(IfxStdIf_Pos_GetTurn                 )&Ifx_AngleTrkQ31_getTurn;
+    /* *INDENT-ON* */
+
+    return TRUE;
+}
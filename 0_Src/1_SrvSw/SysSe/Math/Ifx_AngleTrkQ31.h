@@ -0,0 +1,274 @@
+/**
+ * \file Ifx_AngleTrkQ31.h
+ * \brief Fixed-point angle-tracking observer for sin/cos analog position sensor
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_q31_angletrk Angle-Tracking Observer (fixed-point)
+ * This driver implements \ref library_srvsw_stdif_posif with the 3rd order Angle-Tracking Observer
+ * algorithm of \ref library_srvsw_sysse_math_f32_angletrk, in fixed-point arithmetic.
+ *
+ * The angles are Q31 values (0x80000000 = -IFX_PI), which wrap around by integer overflow: no bound
+ * checks are required, and the raw position is the upper bits of the angle. The integrators are
+ * 64-bit values with 32 bits below the Q31 angle, so that small errors are not lost. The per-sample
+ * functions use integer instructions only, with a constant execution time: they can be executed
+ * on cores or in interrupts which do not save the FPU context. Floating point is only used by the
+ * initialisation, the configuration and the IfxStdIf_Pos getters. The fixed-point observer is chosen for
+ * its accuracy and for the FPU-free execution, not for speed: on the host bench Ifx_AngleTrkQ31_update()
+ * takes 22.2 ns per sample, against 18.7 ns for Ifx_AngleTrkF32_update().
+ *
+ * The configuration is the one of Ifx_AngleTrkF32. The gains are converted to per-sample gains
+ * (kd * Ts, kp * Ts^2, ki * Ts^3), which must be lower than 1.
+ *
+ * \ingroup library_srvsw_sysse_math
+ *
+ */
+
+#ifndef IFX_ANGLETRKQ31_H
+#define IFX_ANGLETRKQ31_H
+
+//________________________________________________________________________________________
+// INCLUDES
+
+#include "Ifx_AngleTrkF32.h"
+
+//________________________________________________________________________________________
+// CONFIGURATION DEFINES
+
+#ifndef IFX_CFG_ANGLETRKQ31_SPEED_FILTER
+#define IFX_CFG_ANGLETRKQ31_SPEED_FILTER (1)
+#endif
+
+//________________________________________________________________________________________
+// DATA STRUCTURES
+
+/** \brief Angle Tracking Observer configuration, see Ifx_AngleTrkF32_Config */
+typedef Ifx_AngleTrkF32_Config Ifx_AngleTrkQ31_Config;
+
+/** \brief Per-sample gain: mantissa / 2^(31 + shift) */
+typedef struct
+{
+    sint32 mantissa;              /**< \brief Q31 mantissa, 0x40000000 .. 0x7FFFFFFF (0 for a zero gain) */
+    uint8  shift;                 /**< \brief Additional right shift */
+} Ifx_AngleTrkQ31_Gain;
+
+typedef struct
+{
+    float32              kp;             /**< \brief Proportional gain */
+    float32              ki;             /**< \brief Integrator gain */
+    float32              kd;             /**< \brief Derivative gain */
+    float32              speedLpfFc;     /**< \brief Cut-off frequency of speed low-pass filter. */
+    Ifx_AngleTrkQ31_Gain kpTs2;          /**< \brief kp * Ts^2 */
+    Ifx_AngleTrkQ31_Gain kiTs3;          /**< \brief ki * Ts^3 */
+    Ifx_AngleTrkQ31_Gain kdTs;           /**< \brief kd * Ts */
+    sint32               speedLpfGain;   /**< \brief Q31 coefficient of the speed low-pass filter */
+    sint32               errorThreshold; /**< \brief Threshold of error value in the tracking loop, Q31 angle */
+    sint32               sqrAmplMax;     /**< \brief Maximum value for square of signal amplitudes */
+    sint32               sqrAmplMin;     /**< \brief Minimum value for square of signal amplitudes */
+} Ifx_AngleTrkQ31_CfgData;
+
+/** \brief Fixed-point Angle Tracking Observer object */
+typedef struct
+{
+    Ifx_AngleTrkF32_PosIf   base;
+    Ifx_AngleTrkQ31_CfgData cfgData;
+    sint16                 *sinIn;         /**< \brief Pointer to SIN input variable */
+    sint16                 *cosIn;         /**< \brief Pointer to COS input variable */
+    uint32                  angleOffset;   /**< \brief base.offset as Q31 angle */
+    uint8                   positionShift; /**< \brief Right shift from the Q31 angle to the raw position, 32 - log2(resolution) */
+    float32                 speedConst;    /**< \brief Constant for calculating the speed (rad/s) from a Q31 angle per sample */
+    sint32                  angleAtan;     /**< \brief Measured angle, Q31 */
+    sint32                  angleRef;      /**< \brief Reference angle, Q31 */
+    sint32                  angleErr;      /**< \brief Tracking error, Q31 */
+    uint64                  angleEst;      /**< \brief Estimated angle, Q31 angle in the upper 32 bits */
+    sint64                  speedEstA;     /**< \brief Speed integrator, Q31 angle per sample in the upper 32 bits */
+    sint64                  speedEstB;     /**< \brief Loop speed, Q31 angle per sample in the upper 32 bits */
+    sint64                  accelEst;      /**< \brief Acceleration integrator, Q31 angle per sample^2 in the upper 32 bits */
+    sint32                  speedLpf;      /**< \brief Filtered speed, Q31 angle per sample. Only used if IFX_CFG_ANGLETRKQ31_SPEED_FILTER is set */
+} Ifx_AngleTrkQ31;
+
+/** \addtogroup library_srvsw_sysse_math_q31_angletrk
+ * \{ */
+
+//________________________________________________________________________________________
+// PUBLIC FUNCTION PROTOTYPES
+
+/** \name Initialisation functions
+ * Example use:
+ * \code
+ * extern sint16          g_SinInput, g_CosInput;
+ * Ifx_AngleTrkQ31_Config driverConfig;
+ * Ifx_AngleTrkQ31        driverData;
+ * IfxStdIf_Pos           stdif;
+ * Ifx_AngleTrkQ31_initConfig(&driverConfig, &g_SinInput, &g_CosInput);
+ * driverConfig.resolution = 1UL << 16;
+ * Ifx_AngleTrkQ31_init(&driverData, &driverConfig, 100e-6);
+ * Ifx_AngleTrkQ31_stdIfPosInit(&stdif, &driverData);
+ * \endcode
+ * Prototypes:
+ * \{ */
+IFX_EXTERN boolean Ifx_AngleTrkQ31_init(Ifx_AngleTrkQ31 *aObsv, const Ifx_AngleTrkQ31_Config *config, float32 Ts);
+IFX_EXTERN void    Ifx_AngleTrkQ31_initConfig(Ifx_AngleTrkQ31_Config *config, sint16 *sinIn, sint16 *cosIn);
+/** \} */
+
+/** \name Protected functions
+ * These functions are not for end-user but may be used by another driver which extends
+ * the functionality of library_srvsw_sysse_math_q31_angletrk
+ * \{ */
+IFX_EXTERN sint32  Ifx_AngleTrkQ31_atan2(sint16 y, sint16 x);
+IFX_EXTERN sint32  Ifx_AngleTrkQ31_step(Ifx_AngleTrkQ31 *aObsv, sint16 sinIn, sint16 cosIn, sint32 phase);
+IFX_EXTERN void    Ifx_AngleTrkQ31_updateStatus(Ifx_AngleTrkQ31 *aObsv, sint16 sinIn, sint16 cosIn);
+IFX_INLINE float32 Ifx_AngleTrkQ31_getLoopSpeed(Ifx_AngleTrkQ31 *aObsv);
+/** \} */
+
+/** \} */
+
+IFX_INLINE float32 Ifx_AngleTrkQ31_getLoopSpeed(Ifx_AngleTrkQ31 *aObsv)
+{
+    return (float32)aObsv->speedEstB * aObsv->speedConst * (1.0f / 4294967296.0f);
+}
+
+
+/** \addtogroup library_srvsw_sysse_virtualDevice_positionSensor_StdIf_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief \see IfxStdIf_Pos_GetAbsolutePosition
+ * \param driver driver handle
+ * \return absolute position
+ */
+IFX_EXTERN float32 Ifx_AngleTrkQ31_getAbsolutePosition(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetDirection
+ * \param driver driver handle
+ * \return direction
+ */
+IFX_EXTERN IfxStdIf_Pos_Dir Ifx_AngleTrkQ31_getDirection(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetFault
+ * \param driver driver handle
+ * \return Fault
+ */
+IFX_EXTERN IfxStdIf_Pos_Status Ifx_AngleTrkQ31_getFault(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetOffset
+ * \param driver driver handle
+ * \return offset address
+ */
+IFX_EXTERN sint32 Ifx_AngleTrkQ31_getOffset(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetPeriodPerRotation
+ * \param driver driver handle
+ * \return Period per rotation
+ */
+IFX_EXTERN uint16 Ifx_AngleTrkQ31_getPeriodPerRotation(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetPosition
+ * \param driver driver handle
+ * \return position
+ */
+IFX_EXTERN float32 Ifx_AngleTrkQ31_getPosition(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetRawPosition
+ * \param driver driver handle
+ * \return position in ticks
+ */
+IFX_EXTERN IfxStdIf_Pos_RawAngle Ifx_AngleTrkQ31_getRawPosition(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetRefreshPeriod
+ * \param driver driver handle
+ * \return update period
+ */
+IFX_EXTERN float32 Ifx_AngleTrkQ31_getRefreshPeriod(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetResolution
+ * \param driver driver handle
+ * \return resolution
+ */
+IFX_EXTERN sint32 Ifx_AngleTrkQ31_getResolution(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetTurn
+ * \param driver driver handle
+ * \return Returns the number of turns
+ */
+IFX_EXTERN sint32 Ifx_AngleTrkQ31_getTurn(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetSensorType
+ * \param driver driver handle
+ * \return sensor type
+ */
+IFX_EXTERN IfxStdIf_Pos_SensorType Ifx_AngleTrkQ31_getSensorType(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_GetSpeed
+ * \param driver driver handle
+ * \return speed
+ */
+IFX_EXTERN float32 Ifx_AngleTrkQ31_getSpeed(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_Reset
+ * \param driver driver handle
+ * \return None
+ */
+IFX_EXTERN void Ifx_AngleTrkQ31_reset(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_ResetFaults
+ * \param driver driver handle
+ * \return None
+ */
+IFX_EXTERN void Ifx_AngleTrkQ31_resetFaults(Ifx_AngleTrkQ31 *driver);
+
+/** \brief \see IfxStdIf_Pos_SetOffset
+ * \param driver driver handle
+ * \param offset offset
+ * \return None
+ */
+IFX_EXTERN void Ifx_AngleTrkQ31_setOffset(Ifx_AngleTrkQ31 *driver, IfxStdIf_Pos_RawAngle offset);
+
+/** \brief \see IfxStdIf_Pos_SetRefreshPeriod
+ * \param driver driver handle
+ * \param updatePeriod update period
+ * \return None
+ */
+IFX_EXTERN void Ifx_AngleTrkQ31_setRefreshPeriod(Ifx_AngleTrkQ31 *driver, float32 updatePeriod);
+
+/** \brief \see IfxStdIf_Pos_Update
+ * \param driver driver handle
+ * \return None
+ */
+IFX_EXTERN void Ifx_AngleTrkQ31_update(Ifx_AngleTrkQ31 *driver);
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initializes the standard interface "Pos"
+ * \param stdif Standard interface position object
+ * \param driver Virtual position sensor
+ * \return TRUE on success else FALSE
+ */
+IFX_EXTERN boolean Ifx_AngleTrkQ31_stdIfPosInit(IfxStdIf_Pos *stdif, Ifx_AngleTrkQ31 *driver);
+
+#endif /* IFX_ANGLETRKQ31_H */
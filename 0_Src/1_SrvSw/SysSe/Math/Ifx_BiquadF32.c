@@ -0,0 +1,311 @@
+/**
+ * \file Ifx_BiquadF32.c
+ * \brief Cascaded biquad (2nd order IIR) filter
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_BiquadF32.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include <math.h>
+//------------------------------------------------------------------------------
+
+/** \brief Compute the output of a section and update its state */
+IFX_INLINE float32 Ifx_BiquadF32_section(const Ifx_BiquadF32_Coefficients *coef, float32 *s1, float32 *s2, float32 input)
+{
+    float32 output = (coef->b0 * input) + *s1;
+
+    *s1 = (coef->b1 * input) - (coef->a1 * output) + *s2;
+    *s2 = (coef->b2 * input) - (coef->a2 * output);
+
+    return output;
+}
+
+
+/** \brief Compute the coefficients of the filter sections
+ *
+ * \param coef Coefficients of the config->sections sections
+ * \param config Specifies the filter configuration.
+ *
+ * \return FALSE if the number of sections is out of range, or the frequency is not in the range 0 .. Nyquist
+ */
+boolean Ifx_BiquadF32_design(Ifx_BiquadF32_Coefficients *coef, const Ifx_BiquadF32_Config *config)
+{
+    float32 w0     = config->cutOffFrequency * config->samplingTime;
+    boolean result = (config->sections >= 1) && (config->sections <= IFX_CFG_BIQUAD_MAX_SECTIONS)
+                     && (w0 > 0.0f) && (w0 < IFX_PI);
+    uint8   k;
+
+    for (k = 0; result && (k < config->sections); k++)
+    {
+        float32 cosW0 = cosf(w0);
+        float32 q     = config->q;
+        float32 alpha, a0;
+
+        if (!(q > 0.0f))
+        {   /* Butterworth: poles at angles IFX_PI * (2k + 1) / (4 * sections) */
+            q = 0.5f / cosf((IFX_PI * (float32)((2 * k) + 1)) / (float32)(4 * config->sections));
+        }
+
+        alpha = sinf(w0) / (2.0f * q);
+        a0    = 1.0f + alpha;
+
+        switch (config->type)
+        {
+        case Ifx_BiquadF32_Type_lowPass:
+            coef[k].b0 = (1.0f - cosW0) / 2.0f;
+            coef[k].b1 = 1.0f - cosW0;
+            coef[k].b2 = (1.0f - cosW0) / 2.0f;
+            break;
+        case Ifx_BiquadF32_Type_highPass:
+            coef[k].b0 = (1.0f + cosW0) / 2.0f;
+            coef[k].b1 = -(1.0f + cosW0);
+            coef[k].b2 = (1.0f + cosW0) / 2.0f;
+            break;
+        case Ifx_BiquadF32_Type_bandPass:
+            coef[k].b0 = alpha;
+            coef[k].b1 = 0.0f;
+            coef[k].b2 = -alpha;
+            break;
+        case Ifx_BiquadF32_Type_notch:
+            coef[k].b0 = 1.0f;
+            coef[k].b1 = -2.0f * cosW0;
+            coef[k].b2 = 1.0f;
+            break;
+        default:
+            coef[k].b0 = 0.0f;
+            coef[k].b1 = 0.0f;
+            coef[k].b2 = 0.0f;
+            result     = FALSE;
+            break;
+        }
+
+        coef[k].b0 /= a0;
+        coef[k].b1 /= a0;
+        coef[k].b2 /= a0;
+        coef[k].a1  = (-2.0f * cosW0) / a0;
+        coef[k].a2  = (1.0f - alpha) / a0;
+    }
+
+    if (result)
+    {
+        coef[0].b0 *= config->gain;
+        coef[0].b1 *= config->gain;
+        coef[0].b2 *= config->gain;
+    }
+
+    return result;
+}
+
+
+/** \brief Set the filter configuration
+ *
+ * This function computes the filter coefficients and resets the filter state.
+ *
+ * \param filter Specifies the filter.
+ * \param config Specifies the filter configuration.
+ *
+ * \return TRUE on success, see Ifx_BiquadF32_design()
+ */
+boolean Ifx_BiquadF32_init(Ifx_BiquadF32 *filter, const Ifx_BiquadF32_Config *config)
+{
+    Ifx_BiquadF32_Coefficients coef[IFX_CFG_BIQUAD_MAX_SECTIONS];
+    boolean                    result = Ifx_BiquadF32_design(coef, config);
+    uint8                      k;
+
+    filter->sections = result ? config->sections : 0;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        filter->section[k].coef = coef[k];
+    }
+
+    Ifx_BiquadF32_reset(filter);
+
+    return result;
+}
+
+
+/** \brief Reset the filter state
+ * \param filter Specifies the filter.
+ */
+void Ifx_BiquadF32_reset(Ifx_BiquadF32 *filter)
+{
+    uint8 k;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        filter->section[k].s1 = 0.0f;
+        filter->section[k].s2 = 0.0f;
+    }
+}
+
+
+/** \brief Filter one sample
+ * \param filter Specifies the filter.
+ * \param input Input sample
+ * \return the output sample
+ */
+float32 Ifx_BiquadF32_do(Ifx_BiquadF32 *filter, float32 input)
+{
+    uint8 k;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        Ifx_BiquadF32_Section *section = &filter->section[k];
+        input = Ifx_BiquadF32_section(&section->coef, &section->s1, &section->s2, input);
+    }
+
+    return input;
+}
+
+
+/** \brief Filter a block of samples
+ *
+ * Same result as Ifx_BiquadF32_do() for each sample. The block is processed section after section,
+ * with the section state in registers. Without section (failed initialisation), the input is copied to the output.
+ *
+ * \param filter Specifies the filter.
+ * \param input count input samples
+ * \param output count output samples, may be the input buffer
+ * \param count Number of samples
+ * \return None
+ */
+void Ifx_BiquadF32_doBlock(Ifx_BiquadF32 *filter, const float32 *input, float32 *output, sint32 count)
+{
+    uint8 k;
+
+    if ((filter->sections == 0) && (output != input))
+    {
+        /* No section: the output is the input, as for Ifx_BiquadF32_do() */
+        sint32 i;
+
+        for (i = 0; i < count; i++)
+        {
+            output[i] = input[i];
+        }
+    }
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        Ifx_BiquadF32_Section     *section = &filter->section[k];
+        Ifx_BiquadF32_Coefficients coef    = section->coef;
+        float32                    s1      = section->s1;
+        float32                    s2      = section->s2;
+        sint32                     i;
+
+        for (i = 0; i < count; i++)
+        {
+            output[i] = Ifx_BiquadF32_section(&coef, &s1, &s2, input[i]);
+        }
+
+        section->s1 = s1;
+        section->s2 = s2;
+        input       = output;
+    }
+}
+
+
+/** \brief Set the filter bank configuration
+ *
+ * This function computes the filter coefficients and resets the state of all channels.
+ *
+ * \param bank Specifies the filter bank.
+ * \param config Specifies the filter configuration, used for all channels.
+ * \param channels Number of channels, 1 .. \ref IFX_CFG_BIQUAD_MAX_CHANNELS
+ *
+ * \return TRUE on success, see Ifx_BiquadF32_design()
+ */
+boolean Ifx_BiquadF32Bank_init(Ifx_BiquadF32Bank *bank, const Ifx_BiquadF32_Config *config, uint8 channels)
+{
+    boolean result = (channels >= 1) && (channels <= IFX_CFG_BIQUAD_MAX_CHANNELS) && Ifx_BiquadF32_design(bank->coef, config);
+
+    bank->sections = result ? config->sections : 0;
+    bank->channels = result ? channels : 0;
+    Ifx_BiquadF32Bank_reset(bank);
+
+    return result;
+}
+
+
+/** \brief Reset the state of all channels
+ * \param bank Specifies the filter bank.
+ */
+void Ifx_BiquadF32Bank_reset(Ifx_BiquadF32Bank *bank)
+{
+    uint8 k, c;
+
+    for (k = 0; k < IFX_CFG_BIQUAD_MAX_SECTIONS; k++)
+    {
+        for (c = 0; c < IFX_CFG_BIQUAD_MAX_CHANNELS; c++)
+        {
+            bank->s1[k][c] = 0.0f;
+            bank->s2[k][c] = 0.0f;
+        }
+    }
+}
+
+
+/** \brief Filter a block of interleaved frames
+ *
+ * \param bank Specifies the filter bank.
+ * \param input frames * channels input samples: input[(frame * channels) + channel]
+ * \param output frames * channels output samples, may be the input buffer
+ * \param frames Number of frames
+ * \return None
+ */
+void Ifx_BiquadF32Bank_doBlock(Ifx_BiquadF32Bank *bank, const float32 *input, float32 *output, sint32 frames)
+{
+    sint32 channels = bank->channels;
+    uint8  k;
+
+    for (k = 0; k < bank->sections; k++)
+    {
+        Ifx_BiquadF32_Coefficients coef = bank->coef[k];
+        float32                    s1[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        float32                    s2[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        sint32                     i, c;
+
+        /* Local copy of the state, which can not be aliased by the output */
+        for (c = 0; c < channels; c++)
+        {
+            s1[c] = bank->s1[k][c];
+            s2[c] = bank->s2[k][c];
+        }
+
+        for (i = 0; i < (frames * channels); i += channels)
+        {
+            /* The channels are independent */
+            for (c = 0; c < channels; c++)
+            {
+                output[i + c] = Ifx_BiquadF32_section(&coef, &s1[c], &s2[c], input[i + c]);
+            }
+        }
+
+        for (c = 0; c < channels; c++)
+        {
+            bank->s1[k][c] = s1[c];
+            bank->s2[k][c] = s2[c];
+        }
+
+        input = output;
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * \file Ifx_BiquadF32.h
+ * \brief Cascaded biquad (2nd order IIR) filter
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_biquad Biquad Filter
+ * This module implements IIR filters of order 2 * N as a cascade of N 2nd order sections (biquads),
+ * computed in the transposed direct form II.
+ *
+ * Formula of each section: \n
+ * \f$ y_k = b_0 x_k + s1_{k-1} \f$ \n
+ * \f$ s1_k = b_1 x_k - a_1 y_k + s2_{k-1} \f$ \n
+ * \f$ s2_k = b_2 x_k - a_2 y_k \f$ \n
+ *
+ * The coefficients are computed at init from the filter type, the cut-off (or center) frequency,
+ * the quality factor and the sampling time (bilinear transform, "Audio EQ Cookbook" formulas).
+ * With the quality factor 0, the low-pass and high-pass sections are a Butterworth filter of order 2 * N.
+ * The gain is applied to the first section.
+ *
+ * Ifx_BiquadF32Bank filters several channels with the same filter, e.g. the results of several
+ * ADC channels, stored interleaved (one frame of all channels after the other). The channels are
+ * independent, so their computations overlap in the CPU pipeline.
+ *
+ * A 4th order Butterworth low-pass at 1 kHz, sampled at 20 kHz:
+ * \code
+ *     Ifx_BiquadF32        filter;
+ *     Ifx_BiquadF32_Config config;
+ *
+ *     config.type            = Ifx_BiquadF32_Type_lowPass;
+ *     config.sections        = 2;
+ *     config.cutOffFrequency = 2 * IFX_PI * 1000;
+ *     config.q               = 0;
+ *     config.gain            = 1;
+ *     config.samplingTime    = 50e-6;
+ *     Ifx_BiquadF32_init(&filter, &config);
+ *     ...
+ *     out = Ifx_BiquadF32_do(&filter, in);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ *
+ */
+
+#if !defined(IFX_BIQUADF32_H)
+#define IFX_BIQUADF32_H
+//------------------------------------------------------------------------------
+#include "Cpu/Std/Ifx_Types.h"
+//------------------------------------------------------------------------------
+
+/** \brief Maximal number of sections of a filter (filter order / 2) */
+#ifndef IFX_CFG_BIQUAD_MAX_SECTIONS
+#define IFX_CFG_BIQUAD_MAX_SECTIONS (4)
+#endif
+
+/** \brief Maximal number of channels of a filter bank */
+#ifndef IFX_CFG_BIQUAD_MAX_CHANNELS
+#define IFX_CFG_BIQUAD_MAX_CHANNELS (4)
+#endif
+
+/** \brief Filter type */
+typedef enum
+{
+    Ifx_BiquadF32_Type_lowPass,   /**< \brief Low-pass */
+    Ifx_BiquadF32_Type_highPass,  /**< \brief High-pass */
+    Ifx_BiquadF32_Type_bandPass,  /**< \brief Band-pass, gain 1 at the center frequency */
+    Ifx_BiquadF32_Type_notch      /**< \brief Band-stop */
+} Ifx_BiquadF32_Type;
+
+/** \brief Coefficients of a section, normalised to a0 = 1 */
+typedef struct
+{
+    float32 b0;
+    float32 b1;
+    float32 b2;
+    float32 a1;
+    float32 a2;
+} Ifx_BiquadF32_Coefficients;
+
+/** \brief Section: coefficients and state */
+typedef struct
+{
+    Ifx_BiquadF32_Coefficients coef;
+    float32                    s1;    /**< \brief 1st state */
+    float32                    s2;    /**< \brief 2nd state */
+} Ifx_BiquadF32_Section;
+
+/** \brief Biquad filter object definition.
+ */
+typedef struct
+{
+    uint8                 sections;                              /**< \brief Number of sections */
+    Ifx_BiquadF32_Section section[IFX_CFG_BIQUAD_MAX_SECTIONS];  /**< \brief Sections */
+} Ifx_BiquadF32;
+
+/** \brief Biquad filter bank object definition.
+ */
+typedef struct
+{
+    uint8                      sections;                                                /**< \brief Number of sections */
+    uint8                      channels;                                                /**< \brief Number of channels */
+    Ifx_BiquadF32_Coefficients coef[IFX_CFG_BIQUAD_MAX_SECTIONS];                       /**< \brief Coefficients of each section */
+    float32                    s1[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief 1st state of each section and channel */
+    float32                    s2[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief 2nd state of each section and channel */
+} Ifx_BiquadF32Bank;
+
+/** \brief Biquad filter configuration */
+typedef struct
+{
+    Ifx_BiquadF32_Type type;            /**< \brief Filter type */
+    uint8              sections;        /**< \brief Number of sections, 1 .. \ref IFX_CFG_BIQUAD_MAX_SECTIONS */
+    float32            cutOffFrequency; /**< \brief Cut off (or center) frequency in rad/s */
+    float32            q;               /**< \brief Quality factor, 0: Butterworth (low-pass and high-pass) */
+    float32            gain;            /**< \brief Gain */
+    float32            samplingTime;    /**< \brief Sampling time */
+} Ifx_BiquadF32_Config;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup  library_srvsw_sysse_math_f32_biquad
+ * \{ */
+IFX_EXTERN boolean Ifx_BiquadF32_design(Ifx_BiquadF32_Coefficients *coef, const Ifx_BiquadF32_Config *config);
+IFX_EXTERN boolean Ifx_BiquadF32_init(Ifx_BiquadF32 *filter, const Ifx_BiquadF32_Config *config);
+IFX_EXTERN void    Ifx_BiquadF32_reset(Ifx_BiquadF32 *filter);
+IFX_EXTERN float32 Ifx_BiquadF32_do(Ifx_BiquadF32 *filter, float32 input);
+IFX_EXTERN void    Ifx_BiquadF32_doBlock(Ifx_BiquadF32 *filter, const float32 *input, float32 *output, sint32 count);
+IFX_EXTERN boolean Ifx_BiquadF32Bank_init(Ifx_BiquadF32Bank *bank, const Ifx_BiquadF32_Config *config, uint8 channels);
+IFX_EXTERN void    Ifx_BiquadF32Bank_reset(Ifx_BiquadF32Bank *bank);
+IFX_EXTERN void    Ifx_BiquadF32Bank_doBlock(Ifx_BiquadF32Bank *bank, const float32 *input, float32 *output, sint32 frames);
+/** \} */
+
+//------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,384 @@
+/**
+ * \file Ifx_BiquadQ31.c
+ * \brief Cascaded biquad (2nd order IIR) filter, fixed-point
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_BiquadQ31.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+/** \brief Number of samples converted at once by the Q15 functions */
+#define IFX_BIQUADQ31_Q15_CHUNK (32)
+
+/** \brief Compute the output of a section and update its state */
+IFX_INLINE sint32 Ifx_BiquadQ31_section(const Ifx_BiquadQ31_Coefficients *coef, sint32 *x1, sint32 *x2, sint32 *y1, sint32 *y2, sint32 input)
+{
+    sint64 acc;
+    sint32 output;
+
+    acc  = (sint64)coef->b0 * input;
+    acc += (sint64)coef->b1 * *x1;
+    acc += (sint64)coef->b2 * *x2;
+    acc -= (sint64)coef->a1 * *y1;
+    acc -= (sint64)coef->a2 * *y2;
+    acc  = (acc + (1LL << (IFX_BIQUADQ31_COEF_SHIFT - 1))) >> IFX_BIQUADQ31_COEF_SHIFT;
+    output = (sint32)__saturateX(acc, (sint64)(-2147483647 - 1), (sint64)2147483647);
+
+    *x2 = *x1;
+    *x1 = input;
+    *y2 = *y1;
+    *y1 = output;
+
+    return output;
+}
+
+
+/** \brief Convert a coefficient to Q29
+ * \return FALSE if the coefficient is out of range
+ */
+static boolean Ifx_BiquadQ31_toQ29(sint32 *result, float32 value)
+{
+    float32 scaled = value * (float32)(1UL << IFX_BIQUADQ31_COEF_SHIFT);
+    boolean ok     = (scaled >= -2147483648.0f) && (scaled < 2147483648.0f);
+
+    *result = ok ? (sint32)((scaled < 0.0f) ? (scaled - 0.5f) : (scaled + 0.5f)) : 0;
+
+    return ok;
+}
+
+
+/** \brief Compute the Q29 coefficients of the filter sections
+ * \return FALSE if Ifx_BiquadF32_design() fails, or a coefficient is out of range
+ */
+static boolean Ifx_BiquadQ31_design(Ifx_BiquadQ31_Coefficients *coef, const Ifx_BiquadQ31_Config *config)
+{
+    Ifx_BiquadF32_Coefficients coefF32[IFX_CFG_BIQUAD_MAX_SECTIONS];
+    boolean                    result = Ifx_BiquadF32_design(coefF32, config);
+    uint8                      k;
+
+    for (k = 0; result && (k < config->sections); k++)
+    {
+        result = Ifx_BiquadQ31_toQ29(&coef[k].b0, coefF32[k].b0)
+                 && Ifx_BiquadQ31_toQ29(&coef[k].b1, coefF32[k].b1)
+                 && Ifx_BiquadQ31_toQ29(&coef[k].b2, coefF32[k].b2)
+                 && Ifx_BiquadQ31_toQ29(&coef[k].a1, coefF32[k].a1)
+                 && Ifx_BiquadQ31_toQ29(&coef[k].a2, coefF32[k].a2);
+    }
+
+    return result;
+}
+
+
+/** \brief Round and saturate a Q31 sample to Q15 */
+IFX_INLINE sint16 Ifx_BiquadQ31_toQ15(sint32 value)
+{
+    return __sath((sint32)(((sint64)value + 0x8000) >> 16));
+}
+
+
+/** \brief Set the filter configuration
+ *
+ * This function computes the filter coefficients and resets the filter state.
+ *
+ * \param filter Specifies the filter.
+ * \param config Specifies the filter configuration.
+ *
+ * \return TRUE on success, FALSE if the configuration is not valid (see Ifx_BiquadF32_design()),
+ * or a coefficient is out of the Q29 range (e.g. a too high gain)
+ */
+boolean Ifx_BiquadQ31_init(Ifx_BiquadQ31 *filter, const Ifx_BiquadQ31_Config *config)
+{
+    Ifx_BiquadQ31_Coefficients coef[IFX_CFG_BIQUAD_MAX_SECTIONS];
+    boolean                    result = Ifx_BiquadQ31_design(coef, config);
+    uint8                      k;
+
+    filter->sections = result ? config->sections : 0;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        filter->section[k].coef = coef[k];
+    }
+
+    Ifx_BiquadQ31_reset(filter);
+
+    return result;
+}
+
+
+/** \brief Reset the filter state
+ * \param filter Specifies the filter.
+ */
+void Ifx_BiquadQ31_reset(Ifx_BiquadQ31 *filter)
+{
+    uint8 k;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        filter->section[k].x1 = 0;
+        filter->section[k].x2 = 0;
+        filter->section[k].y1 = 0;
+        filter->section[k].y2 = 0;
+    }
+}
+
+
+/** \brief Filter one sample
+ * \param filter Specifies the filter.
+ * \param input Q31 input sample
+ * \return the Q31 output sample
+ */
+sint32 Ifx_BiquadQ31_do(Ifx_BiquadQ31 *filter, sint32 input)
+{
+    uint8 k;
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        Ifx_BiquadQ31_Section *section = &filter->section[k];
+        input = Ifx_BiquadQ31_section(&section->coef, &section->x1, &section->x2, &section->y1, &section->y2, input);
+    }
+
+    return input;
+}
+
+
+/** \brief Filter a block of samples
+ *
+ * Same result as Ifx_BiquadQ31_do() for each sample. The block is processed section after section,
+ * with the section state in registers. Without section (failed initialisation), the input is copied to the output.
+ *
+ * \param filter Specifies the filter.
+ * \param input count Q31 input samples
+ * \param output count Q31 output samples, may be the input buffer
+ * \param count Number of samples
+ * \return None
+ */
+void Ifx_BiquadQ31_doBlock(Ifx_BiquadQ31 *filter, const sint32 *input, sint32 *output, sint32 count)
+{
+    uint8 k;
+
+    if ((filter->sections == 0) && (output != input))
+    {
+        /* No section: the output is the input, as for Ifx_BiquadQ31_do() */
+        sint32 i;
+
+        for (i = 0; i < count; i++)
+        {
+            output[i] = input[i];
+        }
+    }
+
+    for (k = 0; k < filter->sections; k++)
+    {
+        Ifx_BiquadQ31_Section     *section = &filter->section[k];
+        Ifx_BiquadQ31_Coefficients coef    = section->coef;
+        sint32                     x1      = section->x1;
+        sint32                     x2      = section->x2;
+        sint32                     y1      = section->y1;
+        sint32                     y2      = section->y2;
+        sint32                     i;
+
+        for (i = 0; i < count; i++)
+        {
+            output[i] = Ifx_BiquadQ31_section(&coef, &x1, &x2, &y1, &y2, input[i]);
+        }
+
+        section->x1 = x1;
+        section->x2 = x2;
+        section->y1 = y1;
+        section->y2 = y2;
+        input       = output;
+    }
+}
+
+
+/** \brief Filter a block of Q15 samples
+ *
+ * The samples are filtered with Q31 precision, the outputs are rounded and saturated to Q15.
+ *
+ * \param filter Specifies the filter.
+ * \param input count Q15 input samples
+ * \param output count Q15 output samples, may be the input buffer
+ * \param count Number of samples
+ * \return None
+ */
+void Ifx_BiquadQ31_doBlockQ15(Ifx_BiquadQ31 *filter, const sint16 *input, sint16 *output, sint32 count)
+{
+    sint32 buffer[IFX_BIQUADQ31_Q15_CHUNK];
+
+    while (count > 0)
+    {
+        sint32 length = __min(count, IFX_BIQUADQ31_Q15_CHUNK);
+        sint32 i;
+
+        for (i = 0; i < length; i++)
+        {
+            buffer[i] = (sint32)input[i] * 65536;
+        }
+
+        Ifx_BiquadQ31_doBlock(filter, buffer, buffer, length);
+
+        for (i = 0; i < length; i++)
+        {
+            output[i] = Ifx_BiquadQ31_toQ15(buffer[i]);
+        }
+
+        input  = &input[length];
+        output = &output[length];
+        count -= length;
+    }
+}
+
+
+/** \brief Set the filter bank configuration
+ *
+ * This function computes the filter coefficients and resets the state of all channels.
+ *
+ * \param bank Specifies the filter bank.
+ * \param config Specifies the filter configuration, used for all channels.
+ * \param channels Number of channels, 1 .. \ref IFX_CFG_BIQUAD_MAX_CHANNELS
+ *
+ * \return TRUE on success, see Ifx_BiquadQ31_init()
+ */
+boolean Ifx_BiquadQ31Bank_init(Ifx_BiquadQ31Bank *bank, const Ifx_BiquadQ31_Config *config, uint8 channels)
+{
+    boolean result = (channels >= 1) && (channels <= IFX_CFG_BIQUAD_MAX_CHANNELS) && Ifx_BiquadQ31_design(bank->coef, config);
+
+    bank->sections = result ? config->sections : 0;
+    bank->channels = result ? channels : 0;
+    Ifx_BiquadQ31Bank_reset(bank);
+
+    return result;
+}
+
+
+/** \brief Reset the state of all channels
+ * \param bank Specifies the filter bank.
+ */
+void Ifx_BiquadQ31Bank_reset(Ifx_BiquadQ31Bank *bank)
+{
+    uint8 k, c;
+
+    for (k = 0; k < IFX_CFG_BIQUAD_MAX_SECTIONS; k++)
+    {
+        for (c = 0; c < IFX_CFG_BIQUAD_MAX_CHANNELS; c++)
+        {
+            bank->x1[k][c] = 0;
+            bank->x2[k][c] = 0;
+            bank->y1[k][c] = 0;
+            bank->y2[k][c] = 0;
+        }
+    }
+}
+
+
+/** \brief Filter a block of interleaved frames
+ *
+ * \param bank Specifies the filter bank.
+ * \param input frames * channels Q31 input samples: input[(frame * channels) + channel]
+ * \param output frames * channels Q31 output samples, may be the input buffer
+ * \param frames Number of frames
+ * \return None
+ */
+void Ifx_BiquadQ31Bank_doBlock(Ifx_BiquadQ31Bank *bank, const sint32 *input, sint32 *output, sint32 frames)
+{
+    sint32 channels = bank->channels;
+    uint8  k;
+
+    for (k = 0; k < bank->sections; k++)
+    {
+        Ifx_BiquadQ31_Coefficients coef = bank->coef[k];
+        sint32                     x1[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        sint32                     x2[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        sint32                     y1[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        sint32                     y2[IFX_CFG_BIQUAD_MAX_CHANNELS];
+        sint32                     i, c;
+
+        /* Local copy of the state, which can not be aliased by the output */
+        for (c = 0; c < channels; c++)
+        {
+            x1[c] = bank->x1[k][c];
+            x2[c] = bank->x2[k][c];
+            y1[c] = bank->y1[k][c];
+            y2[c] = bank->y2[k][c];
+        }
+
+        for (i = 0; i < (frames * channels); i += channels)
+        {
+            /* The channels are independent */
+            for (c = 0; c < channels; c++)
+            {
+                output[i + c] = Ifx_BiquadQ31_section(&coef, &x1[c], &x2[c], &y1[c], &y2[c], input[i + c]);
+            }
+        }
+
+        for (c = 0; c < channels; c++)
+        {
+            bank->x1[k][c] = x1[c];
+            bank->x2[k][c] = x2[c];
+            bank->y1[k][c] = y1[c];
+            bank->y2[k][c] = y2[c];
+        }
+
+        input = output;
+    }
+}
+
+
+/** \brief Filter a block of interleaved Q15 frames
+ *
+ * The samples are filtered with Q31 precision, the outputs are rounded and saturated to Q15.
+ *
+ * \param bank Specifies the filter bank.
+ * \param input frames * channels Q15 input samples: input[(frame * channels) + channel]
+ * \param output frames * channels Q15 output samples, may be the input buffer
+ * \param frames Number of frames
+ * \return None
+ */
+void Ifx_BiquadQ31Bank_doBlockQ15(Ifx_BiquadQ31Bank *bank, const sint16 *input, sint16 *output, sint32 frames)
+{
+    sint32 buffer[IFX_BIQUADQ31_Q15_CHUNK * IFX_CFG_BIQUAD_MAX_CHANNELS];
+    sint32 channels = bank->channels;
+
+    while (frames > 0)
+    {
+        sint32 length = __min(frames, IFX_BIQUADQ31_Q15_CHUNK);
+        sint32 count  = length * channels;
+        sint32 i;
+
+        for (i = 0; i < count; i++)
+        {
+            buffer[i] = (sint32)input[i] * 65536;
+        }
+
+        Ifx_BiquadQ31Bank_doBlock(bank, buffer, buffer, length);
+
+        for (i = 0; i < count; i++)
+        {
+            output[i] = Ifx_BiquadQ31_toQ15(buffer[i]);
+        }
+
+        input   = &input[count];
+        output  = &output[count];
+        frames -= length;
+    }
+}
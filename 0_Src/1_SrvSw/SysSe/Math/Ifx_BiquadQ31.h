@@ -0,0 +1,113 @@
+/**
+ * \file Ifx_BiquadQ31.h
+ * \brief Cascaded biquad (2nd order IIR) filter, fixed-point
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ * \defgroup library_srvsw_sysse_math_q31_biquad Biquad Filter (fixed-point)
+ * This module implements the filters of \ref library_srvsw_sysse_math_f32_biquad in fixed-point
+ * arithmetic, for Q31 (sint32) and Q15 (sint16) samples.
+ *
+ * The sections are computed in the direct form I, with a 64-bit accumulator:\n
+ * \f$ y_k = b_0 x_k + b_1 x_{k-1} + b_2 x_{k-2} - a_1 y_{k-1} - a_2 y_{k-2} \f$ \n
+ * Contrary to the transposed direct form II, the state is the section input and output, which are
+ * bounded by the sample range: the only rounding is the one of the output. The coefficients are Q29
+ * values (range -4 .. 4), and the outputs are saturated.
+ *
+ * The Q15 functions filter the samples with the Q31 filter, and round and saturate the outputs
+ * to sint16.
+ *
+ * The configuration is the one of Ifx_BiquadF32. The per-sample functions use integer instructions
+ * only, floating point is only used by the initialisation.
+ *
+ * \ingroup library_srvsw_sysse_math
+ *
+ */
+
+#if !defined(IFX_BIQUADQ31_H)
+#define IFX_BIQUADQ31_H
+//------------------------------------------------------------------------------
+#include "Ifx_BiquadF32.h"
+//------------------------------------------------------------------------------
+
+/** \brief Number of fractional bits of the coefficients */
+#define IFX_BIQUADQ31_COEF_SHIFT (29)
+
+/** \brief Biquad filter configuration, see Ifx_BiquadF32_Config */
+typedef Ifx_BiquadF32_Config Ifx_BiquadQ31_Config;
+
+/** \brief Coefficients of a section in Q29 format, normalised to a0 = 1 */
+typedef struct
+{
+    sint32 b0;
+    sint32 b1;
+    sint32 b2;
+    sint32 a1;
+    sint32 a2;
+} Ifx_BiquadQ31_Coefficients;
+
+/** \brief Section: coefficients and state */
+typedef struct
+{
+    Ifx_BiquadQ31_Coefficients coef;
+    sint32                     x1;    /**< \brief Previous input */
+    sint32                     x2;    /**< \brief Input before the previous input */
+    sint32                     y1;    /**< \brief Previous output */
+    sint32                     y2;    /**< \brief Output before the previous output */
+} Ifx_BiquadQ31_Section;
+
+/** \brief Biquad filter object definition.
+ */
+typedef struct
+{
+    uint8                 sections;                              /**< \brief Number of sections */
+    Ifx_BiquadQ31_Section section[IFX_CFG_BIQUAD_MAX_SECTIONS];  /**< \brief Sections */
+} Ifx_BiquadQ31;
+
+/** \brief Biquad filter bank object definition.
+ */
+typedef struct
+{
+    uint8                      sections;                                                /**< \brief Number of sections */
+    uint8                      channels;                                                /**< \brief Number of channels */
+    Ifx_BiquadQ31_Coefficients coef[IFX_CFG_BIQUAD_MAX_SECTIONS];                       /**< \brief Coefficients of each section */
+    sint32                     x1[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief Previous input of each section and channel */
+    sint32                     x2[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief Input before the previous input of each section and channel */
+    sint32                     y1[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief Previous output of each section and channel */
+    sint32                     y2[IFX_CFG_BIQUAD_MAX_SECTIONS][IFX_CFG_BIQUAD_MAX_CHANNELS]; /**< \brief Output before the previous output of each section and channel */
+} Ifx_BiquadQ31Bank;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup  library_srvsw_sysse_math_q31_biquad
+ * \{ */
+IFX_EXTERN boolean Ifx_BiquadQ31_init(Ifx_BiquadQ31 *filter, const Ifx_BiquadQ31_Config *config);
+IFX_EXTERN void    Ifx_BiquadQ31_reset(Ifx_BiquadQ31 *filter);
+IFX_EXTERN sint32  Ifx_BiquadQ31_do(Ifx_BiquadQ31 *filter, sint32 input);
+IFX_EXTERN void    Ifx_BiquadQ31_doBlock(Ifx_BiquadQ31 *filter, const sint32 *input, sint32 *output, sint32 count);
+IFX_EXTERN void    Ifx_BiquadQ31_doBlockQ15(Ifx_BiquadQ31 *filter, const sint16 *input, sint16 *output, sint32 count);
+IFX_EXTERN boolean Ifx_BiquadQ31Bank_init(Ifx_BiquadQ31Bank *bank, const Ifx_BiquadQ31_Config *config, uint8 channels);
+IFX_EXTERN void    Ifx_BiquadQ31Bank_reset(Ifx_BiquadQ31Bank *bank);
+IFX_EXTERN void    Ifx_BiquadQ31Bank_doBlock(Ifx_BiquadQ31Bank *bank, const sint32 *input, sint32 *output, sint32 frames);
+IFX_EXTERN void    Ifx_BiquadQ31Bank_doBlockQ15(Ifx_BiquadQ31Bank *bank, const sint16 *input, sint16 *output, sint32 frames);
+/** \} */
+
+//------------------------------------------------------------------------------
+#endif
@@ -23,12 +23,57 @@
  */
 
 #include "Ifx_Cf32.h"
+#include "_Utilities/Ifx_Assert.h"
 #include <float.h>
 #include <stdio.h>
+#include <string.h>
 
 #define ENDL "\r\n"
 
-void CplxVecRst_f32(cfloat32 *X, short nX)
+/** \brief Number of elements summed by VecSum_f32() before the partial sums are paired by VecSumPairwise_f32() */
+#define IFX_CF32_PAIRWISE_BLOCK (128)
+
+#if IFX_CFG_CF32_VECTOR
+/** \brief 4 x float32, accessed at 32 bit aligned addresses */
+typedef float32 Ifx_Cf32_Vec4 __attribute__ ((vector_size(16), aligned(4), may_alias));
+typedef sint32  Ifx_Cf32_Vec4i __attribute__ ((vector_size(16), aligned(4), may_alias));
+
+#if defined(__clang__)
+#define IFX_CF32_SHUFFLE(a, b, i0, i1, i2, i3) __builtin_shufflevector((a), (b), i0, i1, i2, i3)
+#else
+#define IFX_CF32_SHUFFLE(a, b, i0, i1, i2, i3) __builtin_shuffle((a), (b), (Ifx_Cf32_Vec4i) {i0, i1, i2, i3})
+#endif
+
+IFX_INLINE Ifx_Cf32_Vec4 Ifx_Cf32_vec4Splat(float32 value)
+{
+    Ifx_Cf32_Vec4 R = {value, value, value, value};
+    return R;
+}
+
+
+IFX_INLINE Ifx_Cf32_Vec4 Ifx_Cf32_vec4Max(Ifx_Cf32_Vec4 a, Ifx_Cf32_Vec4 b)
+{
+    Ifx_Cf32_Vec4i mask = a > b;
+    return (Ifx_Cf32_Vec4)(((Ifx_Cf32_Vec4i)a & mask) | ((Ifx_Cf32_Vec4i)b & ~mask));
+}
+
+
+IFX_INLINE Ifx_Cf32_Vec4 Ifx_Cf32_vec4Min(Ifx_Cf32_Vec4 a, Ifx_Cf32_Vec4 b)
+{
+    Ifx_Cf32_Vec4i mask = a < b;
+    return (Ifx_Cf32_Vec4)(((Ifx_Cf32_Vec4i)a & mask) | ((Ifx_Cf32_Vec4i)b & ~mask));
+}
+
+
+IFX_INLINE float32 Ifx_Cf32_vec4Sum(Ifx_Cf32_Vec4 a)
+{
+    return (a[0] + a[1]) + (a[2] + a[3]);
+}
+
+
+#endif
+
+void CplxVecRst_f32(cfloat32 *X, sint32 nX)
 {
     for ( ; nX > 0; nX--)
     {
@@ -38,7 +83,7 @@ void CplxVecRst_f32(cfloat32 *X, short nX)
 }
 
 
-void CplxVecCpy_f32S(cfloat32 *X, short *S, short nS, short incrS)
+void CplxVecCpy_f32S(cfloat32 *IFX_RESTRICT X, const sint16 *IFX_RESTRICT S, sint32 nS, sint32 incrS)
 {
     for ( ; nS > 0; nS--)
     {
@@ -49,59 +94,109 @@ void CplxVecCpy_f32S(cfloat32 *X, short *S, short nS, short incrS)
 }
 
 
-void CplxVecCpy_f32(cfloat32 *X, cfloat32 *S, short nS)
+void CplxVecCpy_f32(cfloat32 *IFX_RESTRICT X, const cfloat32 *IFX_RESTRICT S, sint32 nS)
 {
-    for ( ; nS > 0; nS--)
+    if (nS > 0)
     {
-        *X = *S;
-        X++; S++;
+        memcpy(X, S, (size_t)nS * sizeof(cfloat32));
     }
 }
 
 
-float32 *CplxVecPwr_f32(cfloat32 *X, short nX)
+/* NOTE: the result overwrites X, r[i] is written after X[i] has been read */
+float32 *CplxVecPwr_f32(cfloat32 *X, sint32 nX)
 {
-    unsigned short i;
-    float32       *r = (float32 *)X;
+    float32 *r = (float32 *)X;
+    sint32   i = 0;
 
-    for (i = 0; i < nX; i++)
+#if IFX_CFG_CF32_VECTOR
+
+    for ( ; i <= (nX - 4); i += 4)
     {
-        *r = IFX_Cf32_dot(X);
-        r++; X++;
+        Ifx_Cf32_Vec4 a = *(Ifx_Cf32_Vec4 *)&X[i];
+        Ifx_Cf32_Vec4 b = *(Ifx_Cf32_Vec4 *)&X[i + 2];
+        a                       = a * a;
+        b                       = b * b;
+        *(Ifx_Cf32_Vec4 *)&r[i] = IFX_CF32_SHUFFLE(a, b, 0, 2, 4, 6) + IFX_CF32_SHUFFLE(a, b, 1, 3, 5, 7);
     }
 
-    return &r[-nX];
+#else
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        float32 p0 = IFX_Cf32_dot(&X[i]);
+        float32 p1 = IFX_Cf32_dot(&X[i + 1]);
+        float32 p2 = IFX_Cf32_dot(&X[i + 2]);
+        float32 p3 = IFX_Cf32_dot(&X[i + 3]);
+        r[i]     = p0;
+        r[i + 1] = p1;
+        r[i + 2] = p2;
+        r[i + 3] = p3;
+    }
+
+#endif
+
+    for ( ; i < nX; i++)
+    {
+        r[i] = IFX_Cf32_dot(&X[i]);
+    }
+
+    return r;
 }
 
 
-float32 *CplxVecMag_f32(cfloat32 *X, short nX)
+float32 *CplxVecMag_f32(cfloat32 *X, sint32 nX)
 {
-    unsigned short i;
-    float32       *r = (float32 *)X;
+    float32 *r = CplxVecPwr_f32(X, nX);
+    sint32   i;
 
     for (i = 0; i < nX; i++)
     {
-        *r = IFX_Cf32_mag(X);
-        r++; X++;
+        r[i] = (float32)sqrtf(r[i]);
     }
 
-    return &r[-nX];
+    return r;
 }
 
 
-void CplxVecMul_f32(cfloat32 *X, const cfloat32 *mul, short nX)
+void CplxVecMul_f32(cfloat32 *IFX_RESTRICT X, const cfloat32 *IFX_RESTRICT mul, sint32 nX)
 {
-    for ( ; nX > 0; nX--)
+    cfloat32 m = *mul;
+    sint32   i = 0;
+
+#if IFX_CFG_CF32_VECTOR
+    /* 2 complex per vector: (xr, xi) * mr + (xi, xr) * (-mi, mi) */
+    Ifx_Cf32_Vec4 re = Ifx_Cf32_vec4Splat(m.real);
+    Ifx_Cf32_Vec4 im = {-m.imag, m.imag, -m.imag, m.imag};
+
+    for ( ; i <= (nX - 2); i += 2)
     {
-        *X = IFX_Cf32_mul(X, mul);
-        X++;
+        Ifx_Cf32_Vec4 x = *(Ifx_Cf32_Vec4 *)&X[i];
+        *(Ifx_Cf32_Vec4 *)&X[i] = (x * re) + (IFX_CF32_SHUFFLE(x, x, 1, 0, 3, 2) * im);
+    }
+
+#else
+
+    for ( ; i <= (nX - 2); i += 2)
+    {
+        cfloat32 x0 = IFX_Cf32_mul(&X[i], &m);
+        cfloat32 x1 = IFX_Cf32_mul(&X[i + 1], &m);
+        X[i]     = x0;
+        X[i + 1] = x1;
+    }
+
+#endif
+
+    for ( ; i < nX; i++)
+    {
+        X[i] = IFX_Cf32_mul(&X[i], &m);
     }
 }
 
 
-void VecPwrdB_f32(float32 *X, short nX)
+void VecPwrdB_f32(float32 *X, sint32 nX)
 {
-    unsigned short i;
+    sint32 i;
 
     for (i = 0; i < nX; i++)
     {
@@ -111,9 +206,9 @@ void VecPwrdB_f32(float32 *X, short nX)
 }
 
 
-void VecPwrdB_SF(sint16 *R, float32 *X, short nX)
+void VecPwrdB_SF(sint16 *IFX_RESTRICT R, const float32 *IFX_RESTRICT X, sint32 nX)
 {
-    unsigned short i;
+    sint32 i;
 
     for (i = 0; i < nX; i++)
     {
@@ -123,143 +218,308 @@ void VecPwrdB_SF(sint16 *R, float32 *X, short nX)
 }
 
 
-float32 VecMaxIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx)
+/* NOTE: minIdx is the first index of the maximum, maxIdx the last one. The indexes are sint16: nX <= 32767 */
+float32 VecMaxIdx_f32(const float32 *X, sint32 nX, sint16 *minIdx, sint16 *maxIdx)
 {
-    float32        maxPeak = (1.17549435E-38F);//FLT_MIN;
-    unsigned short m;
+    float32 maxPeak = VecMax_f32(X, nX);
+    sint32  m;
 
-    for (m = 0; m < nX; m++)
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, nX <= 32767);
+
+    if (maxPeak > (1.17549435E-38F))//FLT_MIN;
     {
-        if (*X > maxPeak)
-        {
-            maxPeak = *X;
-            *minIdx = m;
-        }
+        for (m = 0; X[m] != maxPeak; m++)
+        {}
 
-        if (*X >= maxPeak)
-        {
-            *maxIdx = m;
-        }
+        *minIdx = (sint16)m;
+    }
 
-        X++;
+    for (m = nX - 1; (m >= 0) && (X[m] != maxPeak); m--)
+    {}
+
+    if (m >= 0)
+    {
+        *maxIdx = (sint16)m;
     }
 
     return maxPeak;
 }
 
 
-float32 VecMinIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx)
+/* NOTE: minIdx is the first index of the minimum, maxIdx the last one. The indexes are sint16: nX <= 32767 */
+float32 VecMinIdx_f32(const float32 *X, sint32 nX, sint16 *minIdx, sint16 *maxIdx)
 {
-    float32 minPeak = (3.40282347E+38F);//FLT_MAX;
-    short   m;
+    float32 minPeak = VecMin_f32(X, nX);
+    sint32  m;
 
-    for (m = 0; m < nX; m++)
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, nX <= 32767);
+
+    if (minPeak < (3.40282347E+38F))//FLT_MAX;
     {
-        if (*X < minPeak)
-        {
-            minPeak = *X;
-            *minIdx = m;
-        }
+        for (m = 0; X[m] != minPeak; m++)
+        {}
 
-        if (*X <= minPeak)
-        {
-            *maxIdx = m;
-        }
+        *minIdx = (sint16)m;
+    }
 
-        X++;
+    for (m = nX - 1; (m >= 0) && (X[m] != minPeak); m--)
+    {}
+
+    if (m >= 0)
+    {
+        *maxIdx = (sint16)m;
     }
 
     return minPeak;
 }
 
 
-void VecOfs_f32(float32 *X, float32 offset, short nX)
+void VecOfs_f32(float32 *X, float32 offset, sint32 nX)
 {
-    unsigned short i;
+    sint32 i = 0;
 
-    for (i = 0; i < nX; i++)
+    /* No vector extension path: GCC vectorises the unrolled loop as well */
+    for ( ; i <= (nX - 4); i += 4)
     {
-        *X -= offset;
-        X++;
+        X[i]     -= offset;
+        X[i + 1] -= offset;
+        X[i + 2] -= offset;
+        X[i + 3] -= offset;
+    }
+
+    for ( ; i < nX; i++)
+    {
+        X[i] -= offset;
     }
 }
 
 
-void VecGain_f32(float32 *X, float32 gain, short nX)
+void VecGain_f32(float32 *X, float32 gain, sint32 nX)
 {
-    unsigned short i;
+    sint32 i = 0;
 
-    for (i = 0; i < nX; i++)
+    /* No vector extension path: GCC vectorises the unrolled loop as well */
+    for ( ; i <= (nX - 4); i += 4)
     {
-        *X = *X * gain;
-        X++;
+        X[i]     *= gain;
+        X[i + 1] *= gain;
+        X[i + 2] *= gain;
+        X[i + 3] *= gain;
+    }
+
+    for ( ; i < nX; i++)
+    {
+        X[i] *= gain;
     }
 }
 
 
-float32 VecSum_f32(float32 *X, short nX)
+/* NOTE: the elements are summed in independent accumulators, the rounding differs from a sequential sum */
+float32 VecSum_f32(const float32 *X, sint32 nX)
 {
-    float32        sumX = 0;
-    unsigned short i;
+    float32 sumX;
+    sint32  i = 0;
 
-    for (i = 0; i < nX; i++)
+#if IFX_CFG_CF32_VECTOR
+    Ifx_Cf32_Vec4 sum0 = {0}, sum1 = {0}, sum2 = {0}, sum3 = {0};
+
+    for ( ; i <= (nX - 16); i += 16)
     {
-        sumX += *X;
-        X++;
+        sum0 += *(const Ifx_Cf32_Vec4 *)&X[i];
+        sum1 += *(const Ifx_Cf32_Vec4 *)&X[i + 4];
+        sum2 += *(const Ifx_Cf32_Vec4 *)&X[i + 8];
+        sum3 += *(const Ifx_Cf32_Vec4 *)&X[i + 12];
+    }
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        sum0 += *(const Ifx_Cf32_Vec4 *)&X[i];
+    }
+
+    sumX = Ifx_Cf32_vec4Sum((sum0 + sum1) + (sum2 + sum3));
+#else
+    float32 sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        sum0 += X[i];
+        sum1 += X[i + 1];
+        sum2 += X[i + 2];
+        sum3 += X[i + 3];
+    }
+
+    sumX = (sum0 + sum1) + (sum2 + sum3);
+#endif
+
+    for ( ; i < nX; i++)
+    {
+        sumX += X[i];
+    }
+
+    return sumX;
+}
+
+
+/* NOTE: pairwise (cascade) summation of blocks of IFX_CF32_PAIRWISE_BLOCK elements. The rounding error
+ * grows with log2(nX) instead of nX, for about the execution time of VecSum_f32(). No recursion is used:
+ * partial[k] holds the sum of 2^k blocks, partial sums of the same size are added like the carries of a binary counter */
+float32 VecSumPairwise_f32(const float32 *X, sint32 nX)
+{
+    float32 partial[32];
+    uint32  blocks = 0;
+    uint32  level;
+    float32 sumX;
+
+    for ( ; nX >= IFX_CF32_PAIRWISE_BLOCK; nX -= IFX_CF32_PAIRWISE_BLOCK)
+    {
+        sumX = VecSum_f32(X, IFX_CF32_PAIRWISE_BLOCK);
+
+        for (level = 0; (blocks & (1U << level)) != 0; level++)
+        {
+            sumX = partial[level] + sumX;
+        }
+
+        partial[level] = sumX;
+        blocks++;
+        X              = &X[IFX_CF32_PAIRWISE_BLOCK];
+    }
+
+    sumX = VecSum_f32(X, nX);
+
+    for (level = 0; blocks != 0; level++)
+    {
+        if ((blocks & 1U) != 0)
+        {
+            sumX = partial[level] + sumX;
+        }
+
+        blocks >>= 1;
     }
 
     return sumX;
 }
 
 
-float32 VecAvg_f32(float32 *X, short nX)
+float32 VecAvg_f32(const float32 *X, sint32 nX)
 {
     return VecSum_f32(X, nX) / nX;
 }
 
 
-float32 VecMax_f32(float32 *X, short nX)
+float32 VecMax_f32(const float32 *X, sint32 nX)
 {
-    unsigned short i;
-    float32        r = (1.17549435E-38F);//FLT_MIN;
+    sint32  i = 0;
+    float32 r = (1.17549435E-38F);//FLT_MIN;
 
-    for (i = 0; i < nX; i++)
+#if IFX_CFG_CF32_VECTOR
+    Ifx_Cf32_Vec4 r4 = Ifx_Cf32_vec4Splat(r), r5 = r4, r6 = r4, r7 = r4;
+
+    for ( ; i <= (nX - 16); i += 16)
     {
-        r = __maxf(r, *X);
-        X++;
+        r4 = Ifx_Cf32_vec4Max(*(const Ifx_Cf32_Vec4 *)&X[i], r4);
+        r5 = Ifx_Cf32_vec4Max(*(const Ifx_Cf32_Vec4 *)&X[i + 4], r5);
+        r6 = Ifx_Cf32_vec4Max(*(const Ifx_Cf32_Vec4 *)&X[i + 8], r6);
+        r7 = Ifx_Cf32_vec4Max(*(const Ifx_Cf32_Vec4 *)&X[i + 12], r7);
+    }
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        r4 = Ifx_Cf32_vec4Max(*(const Ifx_Cf32_Vec4 *)&X[i], r4);
+    }
+
+    r4 = Ifx_Cf32_vec4Max(Ifx_Cf32_vec4Max(r4, r5), Ifx_Cf32_vec4Max(r6, r7));
+    r  = __maxf(__maxf(r4[0], r4[1]), __maxf(r4[2], r4[3]));
+#else
+    float32 r0 = r, r1 = r, r2 = r, r3 = r;
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        r0 = __maxf(r0, X[i]);
+        r1 = __maxf(r1, X[i + 1]);
+        r2 = __maxf(r2, X[i + 2]);
+        r3 = __maxf(r3, X[i + 3]);
+    }
+
+    r = __maxf(__maxf(r0, r1), __maxf(r2, r3));
+#endif
+
+    for ( ; i < nX; i++)
+    {
+        r = __maxf(r, X[i]);
     }
 
     return r;
 }
 
 
-float32 VecMin_f32(float32 *X, short nX)
+float32 VecMin_f32(const float32 *X, sint32 nX)
 {
-    unsigned short i;
-    float32        r = (3.40282347E+38F);//FLT_MAX;
+    sint32  i = 0;
+    float32 r = (3.40282347E+38F);//FLT_MAX;
 
-    for (i = 0; i < nX; i++)
+#if IFX_CFG_CF32_VECTOR
+    Ifx_Cf32_Vec4 r4 = Ifx_Cf32_vec4Splat(r), r5 = r4, r6 = r4, r7 = r4;
+
+    for ( ; i <= (nX - 16); i += 16)
     {
-        r = __minf(r, *X);
-        X++;
+        r4 = Ifx_Cf32_vec4Min(*(const Ifx_Cf32_Vec4 *)&X[i], r4);
+        r5 = Ifx_Cf32_vec4Min(*(const Ifx_Cf32_Vec4 *)&X[i + 4], r5);
+        r6 = Ifx_Cf32_vec4Min(*(const Ifx_Cf32_Vec4 *)&X[i + 8], r6);
+        r7 = Ifx_Cf32_vec4Min(*(const Ifx_Cf32_Vec4 *)&X[i + 12], r7);
+    }
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        r4 = Ifx_Cf32_vec4Min(*(const Ifx_Cf32_Vec4 *)&X[i], r4);
+    }
+
+    r4 = Ifx_Cf32_vec4Min(Ifx_Cf32_vec4Min(r4, r5), Ifx_Cf32_vec4Min(r6, r7));
+    r  = __minf(__minf(r4[0], r4[1]), __minf(r4[2], r4[3]));
+#else
+    float32 r0 = r, r1 = r, r2 = r, r3 = r;
+
+    for ( ; i <= (nX - 4); i += 4)
+    {
+        r0 = __minf(r0, X[i]);
+        r1 = __minf(r1, X[i + 1]);
+        r2 = __minf(r2, X[i + 2]);
+        r3 = __minf(r3, X[i + 3]);
+    }
+
+    r = __minf(__minf(r0, r1), __minf(r2, r3));
+#endif
+
+    for ( ; i < nX; i++)
+    {
+        r = __minf(r, X[i]);
     }
 
     return r;
 }
 
 
-void VecHalfSwap_f32(float32 *X, short nX)
+void VecHalfSwap_f32(float32 *X, sint32 nX)
 {
-    unsigned short i;
-    unsigned short half = nX / 2;
-    float32       *F    = &X[half];
+    sint32   i    = 0;
+    sint32   half = nX / 2;
+    float32 *F    = &X[half];
 
-    for (i = 0; i < half; i++)
+#if IFX_CFG_CF32_VECTOR
+
+    for ( ; i <= (half - 4); i += 4)
     {
-        float32 tmp = *F;
-        *F = *X;
-        *X = tmp;
-        F++; X++;
+        Ifx_Cf32_Vec4 tmp = *(Ifx_Cf32_Vec4 *)&F[i];
+        *(Ifx_Cf32_Vec4 *)&F[i] = *(Ifx_Cf32_Vec4 *)&X[i];
+        *(Ifx_Cf32_Vec4 *)&X[i] = tmp;
+    }
+
+#endif
+
+    for ( ; i < half; i++)
+    {
+        float32 tmp = F[i];
+        F[i] = X[i];
+        X[i] = tmp;
     }
 }
 
@@ -267,27 +527,20 @@ void VecHalfSwap_f32(float32 *X, short nX)
 /* NOTE:
  * (nX <= nW) && ((nW % nX) == 0) && ((nX % 2) == 0)
  * (symW != 0) when the window is symmetrical */
-void VecWin_f32(float32 *X, const float32 *W, short nX, short nW, short incrX, short symW)
+void VecWin_f32(float32 *IFX_RESTRICT X, const float32 *IFX_RESTRICT W, sint32 nX, sint32 nW, sint32 incrX, sint32 symW)
 {
-    short step = nW / nX;
-    short i;
+    sint32 step = nW / nX;
+    sint32 i;
 
     if (symW != 0)
-    {   /* symmetrical window, using half of the length */
-        for (i = 0; i < nX / 2; i++)
-        {
-            *X = *X * *W;
-            X  = &X[incrX];
-            W  = &W[step];
-        }
+    {   /* symmetrical window, using half of the length: X[i] and X[nX - 1 - i] use the same coefficient */
+        float32 *Y = &X[(nX - 1) * incrX];
 
-        W = &W[-step];
-
-        for ( ; i < nX; i++)
+        for (i = 0; i < nX / 2; i++)
         {
-            *X = *X * *W;
-            X  = &X[incrX];
-            W  = &W[-step];
+            float32 w = W[i * step];
+            X[i * incrX]  *= w;
+            Y[-i * incrX] *= w;
         }
     }
 }
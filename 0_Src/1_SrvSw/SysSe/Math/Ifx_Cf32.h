@@ -22,6 +22,12 @@
  * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
  *
  * \defgroup library_srvsw_sysse_math_cf32 Floating point signal, vector, and matrix library
+ * The vector functions process 4 elements per loop iteration. With \ref IFX_CFG_CF32_VECTOR = 1 the
+ * elements are processed with the GCC vector extensions (SSE / AVX / NEON on host builds). Else
+ * the loops are unrolled with independent accumulators, which keeps the TriCore FPU pipeline busy
+ * (the TriCore FPU has no packed float32 instructions).
+ * VecGain_f32() and VecOfs_f32() always use the unrolled loops, which GCC vectorises as well.
+ * The results of VecSum_f32() and VecAvg_f32() may differ from a sequential sum in the last bits.
  * \ingroup library_srvsw_sysse_math_f32
  */
 
@@ -33,6 +39,15 @@
 
 #define _DATAF(val) ((float32)(val))
 
+/** \brief 1: use the GCC vector extensions for the vector functions, 0: unrolled scalar loops */
+#ifndef IFX_CFG_CF32_VECTOR
+#if defined(__GNUC__) && !defined(__tricore__)
+#define IFX_CFG_CF32_VECTOR (1)
+#else
+#define IFX_CFG_CF32_VECTOR (0)
+#endif
+#endif
+
 /* Complex Arithmetic --------------------------------------------------------*/
 IFX_INLINE cfloat32 IFX_Cf32_exp(const cfloat32 *c)
 {
@@ -131,27 +146,29 @@ IFX_INLINE cfloat32 IFX_Cf32_saturate(cfloat32 *a, float32 *ampl, float32 limit)
 }
 
 
-IFX_EXTERN void     CplxVecCpy_f32S(cfloat32 *X, short *S, short nS, short incrS);
-IFX_EXTERN void     CplxVecRst_f32(cfloat32 *X, short nX);
-IFX_EXTERN void     CplxVecCpy_f32(cfloat32 *X, cfloat32 *S, short nS);
-IFX_EXTERN float32 *CplxVecPwr_f32(cfloat32 *X, short nX);
-IFX_EXTERN float32 *CplxVecMag_f32(cfloat32 *X, short nX);
-IFX_EXTERN void     CplxVecMul_f32(cfloat32 *X, const cfloat32 *mul, short nX);
+IFX_EXTERN void     CplxVecCpy_f32S(cfloat32 *IFX_RESTRICT X, const sint16 *IFX_RESTRICT S, sint32 nS, sint32 incrS);
+IFX_EXTERN void     CplxVecRst_f32(cfloat32 *X, sint32 nX);
+IFX_EXTERN void     CplxVecCpy_f32(cfloat32 *IFX_RESTRICT X, const cfloat32 *IFX_RESTRICT S, sint32 nS);
+IFX_EXTERN float32 *CplxVecPwr_f32(cfloat32 *X, sint32 nX);
+IFX_EXTERN float32 *CplxVecMag_f32(cfloat32 *X, sint32 nX);
+IFX_EXTERN void     CplxVecMul_f32(cfloat32 *IFX_RESTRICT X, const cfloat32 *IFX_RESTRICT mul, sint32 nX);
 
 /* Vector Operation ----------------------------------------------------------*/
 
-IFX_EXTERN void    VecWin_f32(float32 *X, const float32 *W, short nX, short nW, short incrX, short symW);
-IFX_EXTERN void    VecPwrdB_f32(float32 *X, short nX);
-IFX_EXTERN void    VecPwrdB_SF(sint16 *R, float32 *X, short nX);
-IFX_EXTERN void    VecGain_f32(float32 *X, float32 gain, short nX);
-IFX_EXTERN void    VecOfs_f32(float32 *X, float32 offset, short nX);
-IFX_EXTERN float32 VecSum_f32(float32 *X, short nX);
-IFX_EXTERN float32 VecAvg_f32(float32 *X, short nX);
-IFX_EXTERN float32 VecMax_f32(float32 *X, short nX);
-IFX_EXTERN float32 VecMin_f32(float32 *X, short nX);
-IFX_EXTERN float32 VecMinIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx);
-IFX_EXTERN float32 VecMaxIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx);
-IFX_EXTERN void    VecHalfSwap_f32(float32 *X, short nX);
+IFX_EXTERN void    VecWin_f32(float32 *IFX_RESTRICT X, const float32 *IFX_RESTRICT W, sint32 nX, sint32 nW, sint32 incrX, sint32 symW);
+IFX_EXTERN void    VecPwrdB_f32(float32 *X, sint32 nX);
+IFX_EXTERN void    VecPwrdB_SF(sint16 *IFX_RESTRICT R, const float32 *IFX_RESTRICT X, sint32 nX);
+IFX_EXTERN void    VecGain_f32(float32 *X, float32 gain, sint32 nX);
+IFX_EXTERN void    VecOfs_f32(float32 *X, float32 offset, sint32 nX);
+IFX_EXTERN float32 VecSum_f32(const float32 *X, sint32 nX);
+IFX_EXTERN float32 VecSumPairwise_f32(const float32 *X, sint32 nX);
+IFX_EXTERN float32 VecAvg_f32(const float32 *X, sint32 nX);
+IFX_EXTERN float32 VecMax_f32(const float32 *X, sint32 nX);
+IFX_EXTERN float32 VecMin_f32(const float32 *X, sint32 nX);
+/* VecMinIdx_f32, VecMaxIdx_f32: the indexes are sint16, nX must not exceed 32767 */
+IFX_EXTERN float32 VecMinIdx_f32(const float32 *X, sint32 nX, sint16 *minIdx, sint16 *maxIdx);
+IFX_EXTERN float32 VecMaxIdx_f32(const float32 *X, sint32 nX, sint16 *minIdx, sint16 *maxIdx);
+IFX_EXTERN void    VecHalfSwap_f32(float32 *X, sint32 nX);
 
 /* Helper functions ----------------------------------------------------------*/
 #ifdef __WIN32__
@@ -0,0 +1,287 @@
+/**
+ * \file Ifx_FftF32.c
+ * \brief Fast Fourier transform
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_FftF32.h"
+#include "SysSe/Math/Ifx_LutSincosF32.h"
+//------------------------------------------------------------------------------
+
+/** \brief Return the twiddle factor exp(-i*angle) (forward) or exp(i*angle) (inverse)
+ * \param angle 0 .. (IFX_LUTSINCOSF32_RESOLUTION * 3 / 4), read from the quarter wave of Ifx_g_LutSincosF32_table */
+IFX_INLINE cfloat32 Ifx_FftF32_twiddle(Ifx_Lut_FxpAngle angle, boolean inverse)
+{
+    cfloat32 R;
+
+    if (angle <= (IFX_LUTSINCOSF32_PI / 2))
+    {
+        R.real = Ifx_g_LutSincosF32_table[(IFX_LUTSINCOSF32_PI / 2) - angle];
+        R.imag = Ifx_g_LutSincosF32_table[angle];
+    }
+    else if (angle <= IFX_LUTSINCOSF32_PI)
+    {
+        R.real = -Ifx_g_LutSincosF32_table[angle - (IFX_LUTSINCOSF32_PI / 2)];
+        R.imag = Ifx_g_LutSincosF32_table[IFX_LUTSINCOSF32_PI - angle];
+    }
+    else
+    {
+        R.real = -Ifx_g_LutSincosF32_table[((IFX_LUTSINCOSF32_PI * 3) / 2) - angle];
+        R.imag = -Ifx_g_LutSincosF32_table[angle - IFX_LUTSINCOSF32_PI];
+    }
+
+    if (!inverse)
+    {
+        R.imag = -R.imag;
+    }
+
+    return R;
+}
+
+
+/** \brief Return -i*a (forward) or i*a (inverse) */
+IFX_INLINE cfloat32 Ifx_FftF32_rotate(const cfloat32 *a, boolean inverse)
+{
+    cfloat32 R;
+
+    if (inverse)
+    {
+        R.real = -a->imag;
+        R.imag = a->real;
+    }
+    else
+    {
+        R.real = a->imag;
+        R.imag = -a->real;
+    }
+
+    return R;
+}
+
+
+/** \brief Reorder the vector in bit reversed index order */
+static void Ifx_FftF32_bitReverse(cfloat32 *X, sint32 length)
+{
+    sint32 i;
+    sint32 j = 0;
+
+    for (i = 0; i < (length - 1); i++)
+    {
+        sint32 bit = length >> 1;
+
+        if (i < j)
+        {
+            cfloat32 tmp = X[i];
+            X[i] = X[j];
+            X[j] = tmp;
+        }
+
+        /* j = bitreverse(i + 1) */
+        while ((j & bit) != 0)
+        {
+            j   ^= bit;
+            bit >>= 1;
+        }
+
+        j |= bit;
+    }
+}
+
+
+/**
+ * \brief In-place complex FFT
+ * \param X vector of length elements
+ * \param log2Length log2(length)
+ * \param angleStep angle of exp(-2*IFX_PI*i/length) in IFX_LUTSINCOSF32_RESOLUTION units
+ * \param inverse TRUE for the inverse transform
+ */
+static void Ifx_FftF32_transform(cfloat32 *X, uint8 log2Length, Ifx_Lut_FxpAngle angleStep, boolean inverse)
+{
+    sint32 length = 1 << log2Length;
+    sint32 quarter;
+    sint32 j, k;
+
+    Ifx_FftF32_bitReverse(X, length);
+
+    if ((log2Length & 1) != 0)
+    {   /* odd number of stages: one radix-2 stage without twiddle factors */
+        for (k = 0; k < length; k += 2)
+        {
+            cfloat32 a = X[k];
+            X[k]     = IFX_Cf32_add(&a, &X[k + 1]);
+            X[k + 1] = IFX_Cf32_sub(&a, &X[k + 1]);
+        }
+
+        quarter = 2;
+    }
+    else
+    {
+        quarter = 1;
+    }
+
+    /* radix-4 stages: the 4 quarters of each block are the transforms of the sub-sequences
+     * of index 4n, 4n + 2, 4n + 1, 4n + 3 (bit reversed order) */
+    for ( ; quarter < length; quarter *= 4)
+    {
+        Ifx_Lut_FxpAngle step = angleStep * (length / (quarter * 4));
+
+        for (j = 0; j < quarter; j++)
+        {
+            cfloat32 w1 = Ifx_FftF32_twiddle(step * j, inverse);
+            cfloat32 w2 = Ifx_FftF32_twiddle(step * j * 2, inverse);
+            cfloat32 w3 = Ifx_FftF32_twiddle(step * j * 3, inverse);
+
+            for (k = j; k < length; k += quarter * 4)
+            {
+                cfloat32 t0 = X[k];
+                cfloat32 t1 = IFX_Cf32_mul(&X[k + (quarter * 2)], &w1);
+                cfloat32 t2 = IFX_Cf32_mul(&X[k + quarter], &w2);
+                cfloat32 t3 = IFX_Cf32_mul(&X[k + (quarter * 3)], &w3);
+                cfloat32 s0 = IFX_Cf32_add(&t0, &t2);
+                cfloat32 d0 = IFX_Cf32_sub(&t0, &t2);
+                cfloat32 s1 = IFX_Cf32_add(&t1, &t3);
+                cfloat32 d1 = IFX_Cf32_sub(&t1, &t3);
+                d1                   = Ifx_FftF32_rotate(&d1, inverse);
+                X[k]                 = IFX_Cf32_add(&s0, &s1);
+                X[k + quarter]       = IFX_Cf32_add(&d0, &d1);
+                X[k + (quarter * 2)] = IFX_Cf32_sub(&s0, &s1);
+                X[k + (quarter * 3)] = IFX_Cf32_sub(&d0, &d1);
+            }
+        }
+    }
+}
+
+
+/** \brief Initialise the FFT object
+ *
+ * \param fft Specifies the FFT object.
+ * \param length Transform length N, power of 2 from \ref IFX_FFTF32_MIN_LENGTH to \ref IFX_FFTF32_MAX_LENGTH.
+ * For Ifx_FftF32_real(), N is the number of real samples.
+ *
+ * \return TRUE if the length is supported
+ */
+boolean Ifx_FftF32_init(Ifx_FftF32 *fft, sint32 length)
+{
+    boolean result = FALSE;
+    uint8   log2Length;
+
+    for (log2Length = 0; (1 << log2Length) < length; log2Length++)
+    {}
+
+    if ((length >= IFX_FFTF32_MIN_LENGTH) && (length <= IFX_FFTF32_MAX_LENGTH) && ((1 << log2Length) == length))
+    {
+        fft->length     = length;
+        fft->log2Length = log2Length;
+        fft->angleStep  = IFX_LUTSINCOSF32_RESOLUTION / length;
+        result          = TRUE;
+    }
+
+    return result;
+}
+
+
+/** \brief In-place FFT of a complex vector
+ *
+ * \param fft Specifies the FFT object.
+ * \param X Vector of N elements, replaced by its transform
+ * \param inverse FALSE for the forward transform, TRUE for the inverse (not scaled) transform
+ *
+ * \return None
+ */
+void Ifx_FftF32_complex(const Ifx_FftF32 *fft, cfloat32 *X, boolean inverse)
+{
+    Ifx_FftF32_transform(X, fft->log2Length, fft->angleStep, inverse);
+}
+
+
+/** \brief In-place FFT of a real vector
+ *
+ * The N real samples are transformed as N/2 complex samples, the spectrum is then separated.
+ * Only the bins 0 .. N/2 are returned, the others are the complex conjugate.
+ *
+ * \param fft Specifies the FFT object.
+ * \param x Vector of N real samples, replaced by N/2 cfloat32 bins: bin k = 1 .. N/2-1 in ((cfloat32 *)x)[k],
+ * the real bins 0 (DC) and N/2 (Nyquist) in ((cfloat32 *)x)[0].real and ((cfloat32 *)x)[0].imag.
+ * The vector must be aligned as a cfloat32.
+ *
+ * \return None
+ */
+void Ifx_FftF32_real(const Ifx_FftF32 *fft, float32 *x)
+{
+    cfloat32 *X    = (cfloat32 *)x;
+    sint32    half = fft->length / 2;
+    sint32    k;
+
+    Ifx_FftF32_transform(X, (uint8)(fft->log2Length - 1), fft->angleStep * 2, FALSE);
+
+    {   /* DC and Nyquist bins */
+        float32 re = X[0].real;
+        X[0].real = re + X[0].imag;
+        X[0].imag = re - X[0].imag;
+    }
+
+    /* X[k] = E + W^k * O, X[N/2 - k] = conj(E - W^k * O)
+     * with E = (Z[k] + conj(Z[N/2 - k])) / 2 (even samples), O = -i * (Z[k] - conj(Z[N/2 - k])) / 2 (odd samples) */
+    for (k = 1; k <= (half / 2); k++)
+    {
+        cfloat32 zk = X[k];
+        cfloat32 zc = X[half - k];
+        cfloat32 e, o, w;
+
+        zc.imag = -zc.imag;
+        e.real  = 0.5f * (zk.real + zc.real);
+        e.imag  = 0.5f * (zk.imag + zc.imag);
+        o.real  = 0.5f * (zk.imag - zc.imag);
+        o.imag  = -0.5f * (zk.real - zc.real);
+        w       = Ifx_FftF32_twiddle(fft->angleStep * k, FALSE);
+        o       = IFX_Cf32_mul(&w, &o);
+
+        X[k].real        = e.real + o.real;
+        X[k].imag        = e.imag + o.imag;
+        X[half - k].real = e.real - o.real;
+        X[half - k].imag = o.imag - e.imag;
+    }
+}
+
+
+/** \brief FFT of Q15 samples, e.g. DSADC results
+ *
+ * The samples are converted to float32 (full scale = 1.0) and transformed with Ifx_FftF32_real().
+ *
+ * \param fft Specifies the FFT object.
+ * \param X Result, N/2 bins packed as for Ifx_FftF32_real()
+ * \param samples N samples
+ *
+ * \return None
+ */
+void Ifx_FftF32_realQ15(const Ifx_FftF32 *fft, cfloat32 *X, const sint16 *samples)
+{
+    float32 *x = (float32 *)X;
+    sint32   i;
+
+    for (i = 0; i < fft->length; i++)
+    {
+        x[i] = (float32)samples[i] * (1.0f / 32768.0f);
+    }
+
+    Ifx_FftF32_real(fft, x);
+}
@@ -0,0 +1,81 @@
+/**
+ * \file Ifx_FftF32.h
+ * \brief Fast Fourier transform
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_fft Fast Fourier Transform
+ * This module implements an in-place radix-2/4 decimation in time FFT of cfloat32 vectors, and
+ * the FFT of real vectors, computed with a complex FFT of half the length.
+ *
+ * The twiddle factors are read from the \ref library_srvsw_sysse_math_lut_sincos table, no
+ * additional table is required. If \ref IFX_LUT_TABLE_CONST is 0, Ifx_LutSincosF32_init() must be
+ * called first. The length N is a power of 2, from 4 to \ref IFX_LUTSINCOSF32_RESOLUTION.
+ *
+ * Forward transform: \f$ X_k = \sum_{n=0}^{N-1} x_n e^{-2 \pi i k n / N} \f$ \n
+ * The inverse transform is not scaled, the result is N times the input.
+ *
+ * Spectrum of DSADC results:
+ * \code
+ *     Ifx_FftF32 fft;
+ *     cfloat32   spectrum[512];
+ *     float32   *power;
+ *
+ *     Ifx_FftF32_init(&fft, 1024);
+ *     Ifx_FftF32_realQ15(&fft, spectrum, dsadcResults);  // sint16 dsadcResults[1024]
+ *     spectrum[0].imag = 0.0;                           // drop the Nyquist bin, packed in spectrum[0]
+ *     power = CplxVecPwr_f32(spectrum, 512);
+ *     VecPwrdB_f32(power, 512);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ *
+ */
+
+#if !defined(IFX_FFTF32_H)
+#define IFX_FFTF32_H
+//------------------------------------------------------------------------------
+#include "Ifx_Cf32.h"
+#include "Ifx_LutSincosF32.h"
+//------------------------------------------------------------------------------
+
+#define IFX_FFTF32_MIN_LENGTH (4)                            /**< \brief Minimal transform length */
+#define IFX_FFTF32_MAX_LENGTH (IFX_LUTSINCOSF32_RESOLUTION)  /**< \brief Maximal transform length, limited by the sine table resolution */
+
+/** \brief FFT object definition.
+ */
+typedef struct
+{
+    sint32           length;     /**< \brief Transform length N */
+    uint8            log2Length; /**< \brief log2(N) */
+    Ifx_Lut_FxpAngle angleStep;  /**< \brief Angle of the twiddle factor 1 (2*IFX_PI/N), in sinus table steps */
+} Ifx_FftF32;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup  library_srvsw_sysse_math_f32_fft
+ * \{ */
+IFX_EXTERN boolean Ifx_FftF32_init(Ifx_FftF32 *fft, sint32 length);
+IFX_EXTERN void    Ifx_FftF32_complex(const Ifx_FftF32 *fft, cfloat32 *X, boolean inverse);
+IFX_EXTERN void    Ifx_FftF32_real(const Ifx_FftF32 *fft, float32 *x);
+IFX_EXTERN void    Ifx_FftF32_realQ15(const Ifx_FftF32 *fft, cfloat32 *X, const sint16 *samples);
+/** \} */
+
+//------------------------------------------------------------------------------
+#endif
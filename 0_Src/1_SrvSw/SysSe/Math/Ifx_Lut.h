@@ -28,6 +28,27 @@
  * \defgroup library_srvsw_sysse_math_f32_lut Look-ups float32
  * \ingroup library_srvsw_sysse_math_lut
  *
+ * \defgroup library_srvsw_sysse_math_lut_generate Table generation
+ * The precompiled tables Ifx_LutSincosF32_Table.c and Ifx_LutAtan2F32_Table.c are generated by
+ * the host tool 1_ToolEnv/1_Host/Tools/Ifx_LutGenerate.c for the resolutions configured with
+ * \ref IFX_LUT_ANGLE_BITS, \ref IFX_LUTSINCOSF32_BITS and \ref IFX_LUTATAN2F32_BITS. The resolutions
+ * are checked at compile time against the ones of the tables. To change them, define the macros
+ * for the whole project (Ifx_Cfg.h) and regenerate the tables with the same values:
+ * \code
+ *     make -C 1_ToolEnv/1_Host lut LUT_SINCOS_BITS=14 LUT_ATAN2_BITS=10
+ * \endcode
+ *
+ * Flash footprint (\ref IFX_LUT_TABLE_CONST = 1):
+ * - sin/cos: (2^IFX_LUTSINCOSF32_BITS / 4 + 1) float32, 4 KByte for 12 bits
+ * - atan2: (2^IFX_LUTATAN2F32_BITS + 1) float32 and, without interpolation, as many Ifx_Lut_FxpAngle, 8 KByte for 10 bits
+ *
+ * Accuracy:
+ * - sin/cos: 2*IFX_PI / 2^IFX_LUT_ANGLE_BITS angle resolution. If \ref IFX_LUTSINCOSF32_BITS is lower than
+ *   \ref IFX_LUT_ANGLE_BITS, the table is linearly interpolated, the error is below 5 / 2^(2*IFX_LUTSINCOSF32_BITS)
+ * - atan2: 1 / 2^IFX_LUTATAN2F32_BITS rad, or 0.1 / 2^(2*IFX_LUTATAN2F32_BITS) rad (limited by the float32 resolution) with \ref IFX_LUTATAN2F32_INTERPOLATION = 1
+ *
+ * \ingroup library_srvsw_sysse_math_lut
+ *
  */
 #ifndef IFX_LUT_H
 #define IFX_LUT_H
@@ -48,8 +69,13 @@
 #   define IFX_LUT_TABLE
 #endif
 
-/** \brief Define the resolution (in bits) of cosinus and sinus table \ingroup library_srvsw_sysse_math_lut */
+#ifndef IFX_LUT_ANGLE_BITS
+/** \brief Define the resolution (in bits) of the fixed-point angle, 10 .. 16 \ingroup library_srvsw_sysse_math_lut
+ *
+ * The lookup tables are generated for the configured resolution by the host tool
+ * 1_ToolEnv/1_Host/Tools/Ifx_LutGenerate.c, see \ref library_srvsw_sysse_math_lut_generate */
 #define IFX_LUT_ANGLE_BITS       (12)
+#endif
 
 /** \brief Define the cosinus and sinus table size \ingroup library_srvsw_sysse_math_lut */
 #define IFX_LUT_ANGLE_RESOLUTION (1 << IFX_LUT_ANGLE_BITS)
@@ -73,5 +99,9 @@ typedef sint32 Ifx_Lut_FxpAngle;
 #if (1U << IFX_LUT_ANGLE_BITS) != IFX_LUT_ANGLE_RESOLUTION
 #error (1U << IFX_LUT_ANGLE_BITS) != IFX_LUT_ANGLE_RESOLUTION
 #endif
+
+#if (IFX_LUT_ANGLE_BITS < 10) || (IFX_LUT_ANGLE_BITS > 16)
+#error IFX_LUT_ANGLE_BITS shall be in the range 10 .. 16
+#endif
 //________________________________________________________________________________________
 #endif /* IFX_LUT_H */
@@ -30,19 +30,47 @@ void Ifx_LutAtan2F32_init(void)
 {
 #if IFX_LUT_TABLE_CONST == 0
     {   /* generate arctan table */
-        sint32  k;
-        float32 Step, value;
-        Step = (double)IFX_LUT_ATAN_LIMIT_LOW / IFX_LUT_ATAN_SIZE_LOW;
+        sint32 k;
 
-        for (k = 0; k < IFX_LUTATAN2F32_SIZE; k++)
+        for (k = 0; k <= IFX_LUTATAN2F32_SIZE; k++)
         {
-            Ifx_g_LutAtan2F32_FxpAngle_table[k] = IFX_LUT_F32_TO_FXPANGLE(atanf(k / Step));
+            float32 value = atanf((float32)k / IFX_LUTATAN2F32_SIZE);
+            Ifx_g_LutAtan2F32_table[k] = value;
+#if IFX_LUTATAN2F32_INTERPOLATION == 0
+            Ifx_g_LutAtan2F32_FxpAngle_table[k] = IFX_LUT_F32_TO_FXPANGLE(value);
+#endif
         }
     }
 #endif
 }
 
 
+#if IFX_LUTATAN2F32_INTERPOLATION != 0
+/** \brief Return atan(val) for val = 0 .. 1, interpolated between the table entries */
+IFX_INLINE float32 Ifx_LutAtan2F32_float32Private(float32 val)
+{
+    float32 position = val * IFX_LUTATAN2F32_SIZE;
+    sint32  index    = (sint32)position;
+    float32 low;
+
+    if (index >= IFX_LUTATAN2F32_SIZE)
+    {
+        index = IFX_LUTATAN2F32_SIZE - 1;
+    }
+
+    low = Ifx_g_LutAtan2F32_table[index];
+
+    return low + ((Ifx_g_LutAtan2F32_table[index + 1] - low) * (position - (float32)index));
+}
+
+
+IFX_INLINE Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAnglePrivate(float32 valf)
+{
+    return (Ifx_Lut_FxpAngle)((Ifx_LutAtan2F32_float32Private(valf) * (IFX_LUT_ANGLE_PI / IFX_PI)) + 0.5f);
+}
+
+
+#else
 IFX_INLINE Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAnglePrivate(float32 valf)
 {
     uint32 vali;
@@ -64,6 +92,8 @@ IFX_INLINE float32 Ifx_LutAtan2F32_float32Private(float32 val)
 }
 
 
+#endif
+
 Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngle(float32 x, float32 y)
 {
     Ifx_Lut_FxpAngle angle;
@@ -182,3 +212,56 @@ float32 Ifx_LutAtan2F32_float32(float32 y, float32 x)
 
     return angle;
 }
+
+
+float32 Ifx_LutAtan2F32_sint16(sint16 y, sint16 x)
+{
+    /* Seed of 1/d for d = 32768 .. 65535, 32 intervals: inverse of the interval middle, relative error < 1/64 */
+#define IFX_LUTATAN2F32_RECIPROCAL(k) (1.0f / (float32)(32768 + 512 + (1024 * (k))))
+    static const float32 reciprocal[32] = {
+        IFX_LUTATAN2F32_RECIPROCAL(0),  IFX_LUTATAN2F32_RECIPROCAL(1),  IFX_LUTATAN2F32_RECIPROCAL(2),  IFX_LUTATAN2F32_RECIPROCAL(3),
+        IFX_LUTATAN2F32_RECIPROCAL(4),  IFX_LUTATAN2F32_RECIPROCAL(5),  IFX_LUTATAN2F32_RECIPROCAL(6),  IFX_LUTATAN2F32_RECIPROCAL(7),
+        IFX_LUTATAN2F32_RECIPROCAL(8),  IFX_LUTATAN2F32_RECIPROCAL(9),  IFX_LUTATAN2F32_RECIPROCAL(10), IFX_LUTATAN2F32_RECIPROCAL(11),
+        IFX_LUTATAN2F32_RECIPROCAL(12), IFX_LUTATAN2F32_RECIPROCAL(13), IFX_LUTATAN2F32_RECIPROCAL(14), IFX_LUTATAN2F32_RECIPROCAL(15),
+        IFX_LUTATAN2F32_RECIPROCAL(16), IFX_LUTATAN2F32_RECIPROCAL(17), IFX_LUTATAN2F32_RECIPROCAL(18), IFX_LUTATAN2F32_RECIPROCAL(19),
+        IFX_LUTATAN2F32_RECIPROCAL(20), IFX_LUTATAN2F32_RECIPROCAL(21), IFX_LUTATAN2F32_RECIPROCAL(22), IFX_LUTATAN2F32_RECIPROCAL(23),
+        IFX_LUTATAN2F32_RECIPROCAL(24), IFX_LUTATAN2F32_RECIPROCAL(25), IFX_LUTATAN2F32_RECIPROCAL(26), IFX_LUTATAN2F32_RECIPROCAL(27),
+        IFX_LUTATAN2F32_RECIPROCAL(28), IFX_LUTATAN2F32_RECIPROCAL(29), IFX_LUTATAN2F32_RECIPROCAL(30), IFX_LUTATAN2F32_RECIPROCAL(31)
+    };
+#undef IFX_LUTATAN2F32_RECIPROCAL
+
+    sint32  ax    = (x < 0) ? -(sint32)x : (sint32)x;
+    sint32  ay    = (y < 0) ? -(sint32)y : (sint32)y;
+    boolean swap  = ay > ax;
+    sint32  num   = swap ? ax : ay;
+    sint32  den   = swap ? ay : ax;
+    float32 angle = 0.0f;
+
+    if (den != 0)
+    {
+        /* normalise den to 32768 .. 65535, the quotient is unchanged */
+        sint32  shift = __clz(den) - 16;
+        sint32  dn    = den << shift;
+        float32 r     = reciprocal[(dn >> 10) & 0x1F];
+        float32 e     = 1.0f - ((float32)dn * r);
+        float32 t     = (float32)(num << shift) * r;
+        float32 u, u2;
+
+        /* t = num/den with Goldschmidt iterations: num/den = num * r / (1 - e) = num * r * (1 + e) * (1 + e^2) */
+        t     = t + (t * e);
+        e     = e * e;
+        t     = t + (t * e);
+
+        /* atan(t), t = 0 .. 1: minimax polynomial, Estrin evaluation */
+        u     = t * t;
+        u2    = u * u;
+        angle = t * ((0.99997722f + (u * -0.33262283f))
+                     + (u2 * ((0.19354040f + (u * -0.11642650f)) + (u2 * (0.05264735f + (u * -0.01171913f))))));
+
+        angle = swap ? ((IFX_PI / 2) - angle) : angle;
+        angle = (x < 0) ? (IFX_PI - angle) : angle;
+        angle = (y < 0) ? -angle : angle;
+    }
+
+    return angle;
+}
@@ -32,13 +32,31 @@
 
 //----------------------------------------------------------------------------------------
 
-#define IFX_LUTATAN2F32_SIZE (1024)           /**< \brief size of Ifx_LutAtan2F32 table */
+#ifndef IFX_LUTATAN2F32_BITS
+#define IFX_LUTATAN2F32_BITS          (10)    /**< \brief Resolution (in bits) of the Ifx_LutAtan2F32 tables, 8 .. 16 */
+#endif
+
+#ifndef IFX_LUTATAN2F32_INTERPOLATION
+/** \brief 0 = the nearest table entry is returned,
+ * 1 = the float32 table is linearly interpolated, Ifx_g_LutAtan2F32_FxpAngle_table is not used */
+#define IFX_LUTATAN2F32_INTERPOLATION (0)
+#endif
+
+#define IFX_LUTATAN2F32_SIZE          (1 << IFX_LUTATAN2F32_BITS) /**< \brief size of Ifx_LutAtan2F32 table */
+
+#if (IFX_LUTATAN2F32_BITS < 8) || (IFX_LUTATAN2F32_BITS > 16)
+#error IFX_LUTATAN2F32_BITS shall be in the range 8 .. 16
+#endif
 
 //----------------------------------------------------------------------------------------
 
-/** \brief Table I for Ifx_LutAtan2F32_fxpAngle() */
+#if IFX_LUTATAN2F32_INTERPOLATION == 0
+/** \brief Table atan(k/IFX_LUTATAN2F32_SIZE) as fixed-point angle, k = 0..IFX_LUTATAN2F32_SIZE, for Ifx_LutAtan2F32_fxpAngle() */
 IFX_EXTERN IFX_LUT_TABLE Ifx_Lut_FxpAngle Ifx_g_LutAtan2F32_FxpAngle_table[IFX_LUTATAN2F32_SIZE + 1];
-IFX_EXTERN IFX_LUT_TABLE float32          Ifx_g_LutAtan2F32_table[IFX_LUTATAN2F32_SIZE + 1];
+#endif
+
+/** \brief Table atan(k/IFX_LUTATAN2F32_SIZE) in radian, k = 0..IFX_LUTATAN2F32_SIZE */
+IFX_EXTERN IFX_LUT_TABLE float32 Ifx_g_LutAtan2F32_table[IFX_LUTATAN2F32_SIZE + 1];
 
 /** \brief Initialise the lookup tables
  * \ingroup library_srvsw_sysse_math_lut_atan2
@@ -53,4 +71,20 @@ IFX_EXTERN void Ifx_LutAtan2F32_init(void);
 IFX_EXTERN Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngle(float32 x, float32 y);
 IFX_EXTERN float32          Ifx_LutAtan2F32_float32(float32 y, float32 x);
 
+/**
+ * \brief Arcus tangent of y/x for integer inputs, e.g. the sin/cos results of a resolver DSADC.
+ *
+ * Division-free: the divisor max(|x|,|y|) is normalised to 32768 .. 65535, its reciprocal is seeded from
+ * a 32-entry table (relative error < 1/64), and the quotient min(|x|,|y|)/max(|x|,|y|) is refined with two
+ * Goldschmidt iterations. atan() of the quotient is computed with a minimax polynomial, and the octant is
+ * restored with conditional selects. The maximum error against atan2() is 2e-6 rad.
+ *
+ * Can be selected for the angle tracking observer with IFX_CFG_ANGLETRKF32_ATAN2F.
+ * \param y Sinus input
+ * \param x Cosinus input
+ * \return -IFX_PI .. IFX_PI, 0 if x = y = 0
+ * \ingroup library_srvsw_sysse_math_lut_atan2
+ */
+IFX_EXTERN float32 Ifx_LutAtan2F32_sint16(sint16 y, sint16 x);
+
 #endif
@@ -0,0 +1,240 @@
+/**
+ * \file Ifx_LutMapF32.c
+ * \brief 2-D and 3-D look-up tables (maps)
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_LutMapF32.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Return TRUE if the value is in the cell of a non-uniform axis
+ *
+ * The first and last cells extend to infinity (extrapolation). */
+IFX_INLINE boolean Ifx_LutMapF32_isInCell(const float32 *points, sint32 last, sint32 cell, float32 value)
+{
+    return (cell >= 0) && (cell <= last)
+           && ((cell == 0) || (value >= points[cell]))
+           && ((cell == last) || (value < points[cell + 1]));
+}
+
+
+/** \brief Find the cell of a value on an axis
+ *
+ * \param axis pointer to the axis
+ * \param cache last hit cell of the axis (non-uniform axis)
+ * \param value input
+ * \param fraction returns the position of the value in the cell, 0 .. 1 inside the cell
+ * \return cell index, 0 .. count - 2 */
+IFX_INLINE sint32 Ifx_LutMapF32_search(const Ifx_LutMapF32_Axis *axis, Ifx_LutMapF32_AxisCache *cache, float32 value, float32 *fraction)
+{
+    sint32 last = axis->count - 2;
+    sint32 cell;
+
+    if (axis->points == NULL_PTR)
+    {
+        float32 position = (value - axis->min) * axis->invStep;
+
+        cell      = (sint32)__maxf(0.0f, __minf(position, (float32)last));
+        *fraction = position - (float32)cell;
+    }
+    else
+    {
+        const float32 *points = axis->points;
+
+        cell = cache->cell;
+
+        if (!Ifx_LutMapF32_isInCell(points, last, cell, value))
+        {
+            if (Ifx_LutMapF32_isInCell(points, last, cell + 1, value))
+            {
+                cell = cell + 1;
+            }
+            else if (Ifx_LutMapF32_isInCell(points, last, cell - 1, value))
+            {
+                cell = cell - 1;
+            }
+            else
+            {   /* Binary search of the last breakpoint lower or equal to the value */
+                sint32 imin = 0;
+                sint32 imax = last;
+
+                while (imin < imax)
+                {
+                    sint32 imid = imin + ((imax - imin + 1) / 2);
+
+                    if (value >= points[imid])
+                    {
+                        imin = imid;
+                    }
+                    else
+                    {
+                        imax = imid - 1;
+                    }
+                }
+
+                cell = imin;
+            }
+
+            cache->cell     = (uint16)cell;
+            cache->invDelta = 1.0f / (points[cell + 1] - points[cell]);
+        }
+
+        *fraction = (value - points[cell]) * cache->invDelta;
+    }
+
+    return cell;
+}
+
+
+/** \brief Bi-linear interpolation of a map plane
+ * \param values values of the plane at the cell origin
+ * \param stride distance between 2 rows of the plane */
+IFX_INLINE float32 Ifx_LutMapF32_interpolate2d(const float32 *values, sint32 stride, float32 fx, float32 fy)
+{
+    float32 low  = values[0] + (fx * (values[1] - values[0]));
+    float32 high = values[stride] + (fx * (values[stride + 1] - values[stride]));
+
+    return low + (fy * (high - low));
+}
+
+
+IFX_INLINE float32 Ifx_LutMap2dF32_lookup(const Ifx_LutMap2dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y)
+{
+    float32 fx, fy;
+    sint32  ix     = Ifx_LutMapF32_search(&map->x, &cache->axis[0], x, &fx);
+    sint32  iy     = Ifx_LutMapF32_search(&map->y, &cache->axis[1], y, &fy);
+    sint32  stride = map->x.count;
+
+    return Ifx_LutMapF32_interpolate2d(&map->values[(iy * stride) + ix], stride, fx, fy);
+}
+
+
+IFX_INLINE float32 Ifx_LutMap3dF32_lookup(const Ifx_LutMap3dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y, float32 z)
+{
+    float32        fx, fy, fz, low, high;
+    sint32         ix     = Ifx_LutMapF32_search(&map->x, &cache->axis[0], x, &fx);
+    sint32         iy     = Ifx_LutMapF32_search(&map->y, &cache->axis[1], y, &fy);
+    sint32         iz     = Ifx_LutMapF32_search(&map->z, &cache->axis[2], z, &fz);
+    sint32         stride = map->x.count;
+    sint32         plane  = stride * map->y.count;
+    const float32 *values = &map->values[(iz * plane) + (iy * stride) + ix];
+
+    low  = Ifx_LutMapF32_interpolate2d(values, stride, fx, fy);
+    high = Ifx_LutMapF32_interpolate2d(&values[plane], stride, fx, fy);
+
+    return low + (fz * (high - low));
+}
+
+
+/** \brief Invalidate the cached cells
+ *
+ * Must be called before the first lookup, and when the cache is used with another map.
+ *
+ * \param cache pointer to the cache */
+void Ifx_LutMapF32_initCache(Ifx_LutMapF32_Cache *cache)
+{
+    uint8 i;
+
+    for (i = 0; i < 3; i++)
+    {
+        cache->axis[i].cell     = IFX_LUTMAPF32_CELL_INVALID;
+        cache->axis[i].invDelta = 0.0f;
+    }
+}
+
+
+/** \brief 2-D map lookup
+ *
+ * Value inside the map will be bi-linearly interpolated.
+ * Value outside the map will be linearly extrapolated.
+ *
+ * \param map pointer to the map
+ * \param cache pointer to the cache of the last hit cell
+ * \param x input of the x axis
+ * \param y input of the y axis
+ * \return interpolated value */
+float32 Ifx_LutMap2dF32_get(const Ifx_LutMap2dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y)
+{
+    return Ifx_LutMap2dF32_lookup(map, cache, x, y);
+}
+
+
+/** \brief 2-D map lookup of a block of inputs
+ *
+ * Same result as Ifx_LutMap2dF32_get() for each input pair.
+ *
+ * \param map pointer to the map
+ * \param cache pointer to the cache of the last hit cell
+ * \param x count inputs of the x axis
+ * \param y count inputs of the y axis
+ * \param output count interpolated values
+ * \param count number of lookups
+ * \return None */
+void Ifx_LutMap2dF32_getBlock(const Ifx_LutMap2dF32 *map, Ifx_LutMapF32_Cache *cache, const float32 *x, const float32 *y, float32 *output, sint32 count)
+{
+    sint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        output[i] = Ifx_LutMap2dF32_lookup(map, cache, x[i], y[i]);
+    }
+}
+
+
+/** \brief 3-D map lookup
+ *
+ * Value inside the map will be tri-linearly interpolated.
+ * Value outside the map will be linearly extrapolated.
+ *
+ * \param map pointer to the map
+ * \param cache pointer to the cache of the last hit cell
+ * \param x input of the x axis
+ * \param y input of the y axis
+ * \param z input of the z axis
+ * \return interpolated value */
+float32 Ifx_LutMap3dF32_get(const Ifx_LutMap3dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y, float32 z)
+{
+    return Ifx_LutMap3dF32_lookup(map, cache, x, y, z);
+}
+
+
+/** \brief 3-D map lookup of a block of inputs
+ *
+ * Same result as Ifx_LutMap3dF32_get() for each input triple.
+ *
+ * \param map pointer to the map
+ * \param cache pointer to the cache of the last hit cell
+ * \param x count inputs of the x axis
+ * \param y count inputs of the y axis
+ * \param z count inputs of the z axis
+ * \param output count interpolated values
+ * \param count number of lookups
+ * \return None */
+void Ifx_LutMap3dF32_getBlock(const Ifx_LutMap3dF32 *map, Ifx_LutMapF32_Cache *cache, const float32 *x, const float32 *y, const float32 *z, float32 *output, sint32 count)
+{
+    sint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        output[i] = Ifx_LutMap3dF32_lookup(map, cache, x[i], y[i], z[i]);
+    }
+}
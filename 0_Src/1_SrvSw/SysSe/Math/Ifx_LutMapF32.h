@@ -0,0 +1,131 @@
+/**
+ * \file Ifx_LutMapF32.h
+ * \brief 2-D and 3-D look-up tables (maps)
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_lut_map Map look-up table (with multi-linear interpolation)
+ * This module implements 2-D and 3-D maps (e.g. a flux map indexed by current and speed), with
+ * bi-linear or tri-linear interpolation of the grid values. As with Ifx_LutLinearF32, values
+ * outside the grid are linearly extrapolated from the border cells.
+ *
+ * Each axis is either uniform, defined by its first and last breakpoint, or given as a table of
+ * increasing breakpoints:
+ * - On a uniform axis, the cell index is computed from the input, without search.
+ * - On a non-uniform axis, the last hit cell is kept in a cache (Ifx_LutMapF32_Cache), and
+ *   checked first, then its neighbours, before a binary search. For inputs which change slowly
+ *   compared to the grid, e.g. the currents and speed in a control loop, the lookup is O(1).
+ *
+ * The map itself is constant and can be shared, each user (e.g. each motor) owns a cache.
+ *
+ * \code
+ *     static const float32 Id[4] = {-200, -100, -20, 0};
+ *     static const float32 flux[4 * 3] = {...};   // flux[(iq * 4) + id]
+ *     static const Ifx_LutMap2dF32 fluxMap = {
+ *         IFX_LUTMAPF32_AXIS(4, Id),
+ *         IFX_LUTMAPF32_AXIS_UNIFORM(3, 0, 200),
+ *         flux
+ *     };
+ *     Ifx_LutMapF32_Cache cache;
+ *
+ *     Ifx_LutMapF32_initCache(&cache);
+ *     ...
+ *     psi = Ifx_LutMap2dF32_get(&fluxMap, &cache, id, iq);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math_f32_lut
+ *
+ */
+
+#ifndef IFX_LUTMAPF32_H
+#define IFX_LUTMAPF32_H
+
+//________________________________________________________________________________________
+// INCLUDES
+#include "Cpu/Std/Ifx_Types.h"
+
+//________________________________________________________________________________________
+// MACROS
+
+/** \brief Uniform axis initializer: count breakpoints from min to max */
+#define IFX_LUTMAPF32_AXIS_UNIFORM(count, min, max) {(count), NULL_PTR, (min), (float32)((count) - 1) / ((max) - (min))}
+
+/** \brief Non-uniform axis initializer: count increasing breakpoints */
+#define IFX_LUTMAPF32_AXIS(count, points)           {(count), (points), 0.0f, 0.0f}
+
+/** \brief Cache value of an axis without valid cell */
+#define IFX_LUTMAPF32_CELL_INVALID                  (0xFFFFU)
+
+//________________________________________________________________________________________
+// DATA STRUCTURES
+
+/** \brief Map axis, see \ref IFX_LUTMAPF32_AXIS_UNIFORM and \ref IFX_LUTMAPF32_AXIS */
+typedef struct
+{
+    uint16         count;       /**< \brief Number of breakpoints, >= 2 */
+    const float32 *points;      /**< \brief Increasing breakpoints, NULL_PTR for a uniform axis */
+    float32        min;         /**< \brief First breakpoint (uniform axis) */
+    float32        invStep;     /**< \brief Inverse of the breakpoint distance (uniform axis) */
+} Ifx_LutMapF32_Axis;
+
+/** \brief Last hit cell of an axis */
+typedef struct
+{
+    uint16  cell;               /**< \brief Cell index, \ref IFX_LUTMAPF32_CELL_INVALID after init */
+    float32 invDelta;           /**< \brief Inverse of the cell width */
+} Ifx_LutMapF32_AxisCache;
+
+/** \brief Last hit cell of a map */
+typedef struct
+{
+    Ifx_LutMapF32_AxisCache axis[3];
+} Ifx_LutMapF32_Cache;
+
+/** \brief 2-D map */
+typedef struct
+{
+    Ifx_LutMapF32_Axis x;
+    Ifx_LutMapF32_Axis y;
+    const float32     *values;  /**< \brief x.count * y.count values: values[(iy * x.count) + ix] */
+} Ifx_LutMap2dF32;
+
+/** \brief 3-D map */
+typedef struct
+{
+    Ifx_LutMapF32_Axis x;
+    Ifx_LutMapF32_Axis y;
+    Ifx_LutMapF32_Axis z;
+    const float32     *values;  /**< \brief x.count * y.count * z.count values: values[(((iz * y.count) + iy) * x.count) + ix] */
+} Ifx_LutMap3dF32;
+
+//________________________________________________________________________________________
+// FUNCTION PROTOTYPES
+
+/** \addtogroup library_srvsw_sysse_math_f32_lut_map
+ * \{ */
+IFX_EXTERN void    Ifx_LutMapF32_initCache(Ifx_LutMapF32_Cache *cache);
+IFX_EXTERN float32 Ifx_LutMap2dF32_get(const Ifx_LutMap2dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y);
+IFX_EXTERN void    Ifx_LutMap2dF32_getBlock(const Ifx_LutMap2dF32 *map, Ifx_LutMapF32_Cache *cache, const float32 *x, const float32 *y, float32 *output, sint32 count);
+IFX_EXTERN float32 Ifx_LutMap3dF32_get(const Ifx_LutMap3dF32 *map, Ifx_LutMapF32_Cache *cache, float32 x, float32 y, float32 z);
+IFX_EXTERN void    Ifx_LutMap3dF32_getBlock(const Ifx_LutMap3dF32 *map, Ifx_LutMapF32_Cache *cache, const float32 *x, const float32 *y, const float32 *z, float32 *output, sint32 count);
+/** \} */
+
+#endif /* IFX_LUTMAPF32_H */
@@ -32,15 +32,38 @@ void Ifx_LutSincosF32_init(void)
     {   /* generate sin and cos table */
         sint32 k;
 
-        for (k = 0; k <= (IFX_LUT_ANGLE_PI / 2); k++)
+        for (k = 0; k <= (IFX_LUTSINCOSF32_PI / 2); k++)
         {
-            Ifx_g_LutSincosF32_table[k] = sinf((IFX_PI * 2 * k) / IFX_LUT_ANGLE_RESOLUTION);
+            Ifx_g_LutSincosF32_table[k] = sinf((IFX_PI * 2 * k) / IFX_LUTSINCOSF32_RESOLUTION);
         }
     }
 #endif
 }
 
 
+#if IFX_LUTSINCOSF32_BITS < IFX_LUT_ANGLE_BITS
+#define IFX_LUTSINCOSF32_SHIFT (IFX_LUT_ANGLE_BITS - IFX_LUTSINCOSF32_BITS)
+
+/** \brief Return sin(fxpAngle) for fxpAngle = 0 .. IFX_LUT_ANGLE_PI/2, interpolated between the table entries */
+IFX_INLINE float32 Ifx_LutSincosF32_lookup(Ifx_Lut_FxpAngle fxpAngle)
+{
+    sint32  index    = fxpAngle >> IFX_LUTSINCOSF32_SHIFT;
+    sint32  fraction = fxpAngle & ((1 << IFX_LUTSINCOSF32_SHIFT) - 1);
+    float32 result   = Ifx_g_LutSincosF32_table[index];
+
+    if (fraction != 0)
+    {   /* index + 1 is at most IFX_LUTSINCOSF32_PI / 2 */
+        result += (Ifx_g_LutSincosF32_table[index + 1] - result) * ((float32)fraction * (1.0f / (1 << IFX_LUTSINCOSF32_SHIFT)));
+    }
+
+    return result;
+}
+
+
+#else
+#define Ifx_LutSincosF32_lookup(fxpAngle) (Ifx_g_LutSincosF32_table[fxpAngle])
+#endif
+
 float32 Ifx_LutSincosF32_sin(Ifx_Lut_FxpAngle fxpAngle)
 {
     float32 result;
@@ -48,22 +71,22 @@ float32 Ifx_LutSincosF32_sin(Ifx_Lut_FxpAngle fxpAngle)
 
     if (fxpAngle < (IFX_LUT_ANGLE_PI / 2))
     {
-        result = Ifx_g_LutSincosF32_table[fxpAngle];
+        result = Ifx_LutSincosF32_lookup(fxpAngle);
     }
     else if (fxpAngle < IFX_LUT_ANGLE_PI)
     {
         fxpAngle = IFX_LUT_ANGLE_PI - fxpAngle;
-        result   = Ifx_g_LutSincosF32_table[fxpAngle];
+        result   = Ifx_LutSincosF32_lookup(fxpAngle);
     }
     else if (fxpAngle < (IFX_LUT_ANGLE_PI / 2 * 3))
     {
         fxpAngle = fxpAngle - IFX_LUT_ANGLE_PI;
-        result   = -Ifx_g_LutSincosF32_table[fxpAngle];
+        result   = -Ifx_LutSincosF32_lookup(fxpAngle);
     }
     else
     {
         fxpAngle = IFX_LUT_ANGLE_RESOLUTION - fxpAngle;
-        result   = -Ifx_g_LutSincosF32_table[fxpAngle];
+        result   = -Ifx_LutSincosF32_lookup(fxpAngle);
     }
 
     return result;
@@ -36,10 +36,29 @@
 #include "Ifx_Lut.h"
 //________________________________________________________________________________________
 
+#ifndef IFX_LUTSINCOSF32_BITS
+/** \brief Resolution (in bits) of the sinus table, 8 .. \ref IFX_LUT_ANGLE_BITS.
+ *
+ * If lower than \ref IFX_LUT_ANGLE_BITS, the lookup functions interpolate linearly between the table entries */
+#define IFX_LUTSINCOSF32_BITS       (IFX_LUT_ANGLE_BITS)
+#endif
+
+/** \brief Number of sinus table steps for a full wave */
+#define IFX_LUTSINCOSF32_RESOLUTION (1 << IFX_LUTSINCOSF32_BITS)
+
+/** \brief Number of sinus table steps for 180 degree */
+#define IFX_LUTSINCOSF32_PI         (IFX_LUTSINCOSF32_RESOLUTION / 2)
+
+#if (IFX_LUTSINCOSF32_BITS < 8) || (IFX_LUTSINCOSF32_BITS > IFX_LUT_ANGLE_BITS)
+#error IFX_LUTSINCOSF32_BITS shall be in the range 8 .. IFX_LUT_ANGLE_BITS
+#endif
+
+//________________________________________________________________________________________
+
 /**
- * \brief Look-up table for sin(IFX_PI*2*k/IFX_LUT_ANGLE_RESOLUTION),
- * where k = 0..IFX_LUT_ANGLE_RESOLUTION */
-IFX_EXTERN IFX_LUT_TABLE float32 Ifx_g_LutSincosF32_table[(IFX_LUT_ANGLE_PI / 2) + 1];
+ * \brief Look-up table for sin(IFX_PI*2*k/IFX_LUTSINCOSF32_RESOLUTION),
+ * where k = 0..IFX_LUTSINCOSF32_RESOLUTION/4 (quarter wave) */
+IFX_EXTERN IFX_LUT_TABLE float32 Ifx_g_LutSincosF32_table[(IFX_LUTSINCOSF32_PI / 2) + 1];
 
 /** \brief Initialise the lookup tables
  * \note This is not required if (\ref IFX_LUT_TABLE_CONST == 1)
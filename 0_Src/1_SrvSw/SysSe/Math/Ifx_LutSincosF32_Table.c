@@ -1,7 +1,9 @@
 /**
- * \file Ifx_LutSincosF32Table.c
+ * \file Ifx_LutSincosF32_Table.c
  * \brief Table data for Sin/Cos lookup functions
  *
+ * Generated by 1_ToolEnv/1_Host/Tools/Ifx_LutGenerate.c, do not edit.
+ * See \ref library_srvsw_sysse_math_lut_generate.
  *
  * \version disabled
  * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
@@ -21,22 +23,20 @@
  * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
  * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
  *
- *
  */
 
-#include "Ifx_Lut.h"
+#include "Ifx_LutSincosF32.h"
 
 #if IFX_LUT_TABLE_CONST == 0
-/* FIXME Table size not consistent  */
-IFX_LUT_TABLE float32 Ifx_g_LutSincosF32_table[IFX_LUT_ANGLE_RESOLUTION + (IFX_LUT_ANGLE_RESOLUTION / 4)];
+IFX_LUT_TABLE float32 Ifx_g_LutSincosF32_table[(IFX_LUTSINCOSF32_PI / 2) + 1];
 #else
 
-#if (IFX_LUT_ANGLE_RESOLUTION != 4096)
+#if (IFX_LUTSINCOSF32_BITS != 12)
 #error "Inconsistent between Lookup Table and configuration. Please regenerate."
 #endif
 
 /*lint -e915*/
-const float32 Ifx_g_LutSincosF32_table[1025] = {
+const float32 Ifx_g_LutSincosF32_table[1024 + 1] = {
     0,
     0.00153398018628477,
     0.00306795676296598,
@@ -985,7 +985,7 @@ const float32 Ifx_g_LutSincosF32_table[1025] = {
     0.992666142448948,
     0.992850414459865,
     0.993032350197851,
-    0.993211949234794,
+    0.993211949234795,
     0.993389211148081,
     0.993564135520595,
     0.993736721940725,
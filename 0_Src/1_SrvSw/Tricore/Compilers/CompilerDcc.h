@@ -75,6 +75,7 @@
 
 /* FXIME check how to pack structure members */
 #define IFX_PACKED
+#define IFX_RESTRICT       __restrict__
 
 #define COMPILER_NAME      "DCC"
 #define COMPILER_VERSION   __VERSION__
@@ -79,6 +79,7 @@
 /******************************************************************************/
 #define IFX_INLINE         static inline __attribute__ ((always_inline))            /*Makes the function always inlined */
 #define IFX_PACKED         __attribute__ ((packed))
+#define IFX_RESTRICT       __restrict__                                             /*Pointer does not alias the other pointer parameters */
 
 #define COMPILER_NAME      "GNUC"
 #define COMPILER_VERSION   __VERSION__
@@ -81,6 +81,7 @@
 
 /* FXIME check how to pack structure members */
 #define IFX_PACKED
+#define IFX_RESTRICT      restrict
 
 #define COMPILER_NAME     "TASKING"
 #define COMPILER_VERSION  __VERSION__
@@ -28,10 +28,309 @@
 
 #include "IfxAsclin_Asc.h"
 
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Move all the data of the Rx hardware FIFO to the software FIFO
+ * \param asclin module handler
+ * \return number of bytes moved
+ */
+static uint32 IfxAsclin_Asc_drainRxFifo(IfxAsclin_Asc *asclin);
+
+/** \brief Move the data written by the receive DMA channel since the previous call to the software FIFO
+ * \param asclin module handler
+ * \return number of bytes moved
+ */
+static uint32 IfxAsclin_Asc_drainRxDmaBuffer(IfxAsclin_Asc *asclin);
+
+/** \brief Fill the free space of the Tx hardware FIFO from the software FIFO
+ * \param asclin module handler
+ * \return number of bytes moved
+ */
+static uint32 IfxAsclin_Asc_fillTxFifo(IfxAsclin_Asc *asclin);
+
+/** \brief Initialise the receive and transmit DMA channels
+ * \param asclin module handler
+ * \param config configuration structure of the module
+ * \return None
+ */
+static void IfxAsclin_Asc_initDma(IfxAsclin_Asc *asclin, const IfxAsclin_Asc_Config *config);
+
+/** \brief Start a DMA transfer of the data available in the software FIFO
+ * Clears txInProgress if the software FIFO is empty. Must be called with the transmit interrupt disabled.
+ * \param asclin module handler
+ * \return None
+ */
+static void IfxAsclin_Asc_startDmaTransmission(IfxAsclin_Asc *asclin);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+static uint32 IfxAsclin_Asc_drainRxFifo(IfxAsclin_Asc *asclin)
+{
+    uint8  ascData[IFXASCLIN_FIFO_DEPTH];
+    uint32 count = __minu(IfxAsclin_getRxFifoFillLevel(asclin->asclin), IFXASCLIN_FIFO_DEPTH);
+
+    if (count != 0)
+    {
+        switch (asclin->dataBufferMode)
+        {
+        case Ifx_DataBufferMode_normal:
+        {
+            /* FIXME add support for data size != 8 bit */
+            IfxAsclin_read8(asclin->asclin, ascData, count);
+
+            if (Ifx_Fifo_write(asclin->rx, ascData, (Ifx_SizeT)count, TIME_NULL) != 0)
+            {
+                /* Receive buffer is full, data is discard */
+                asclin->rxSwFifoOverflow = TRUE;
+            }
+
+            break;
+        }
+        case Ifx_DataBufferMode_timeStampSingle:
+        {
+            Ifx_DataBufferMode_TimeStampSingle packedData;
+            uint32                             i;
+
+            packedData.timestamp = now();
+            IfxAsclin_read8(asclin->asclin, ascData, count);
+
+            for (i = 0; i < count; i++)
+            {
+                packedData.data = ascData[i];
+
+                if (Ifx_Fifo_write(asclin->rx, &packedData, sizeof(packedData), TIME_NULL) != 0)
+                {
+                    /* Receive buffer is full, data is discard */
+                    asclin->rxSwFifoOverflow = TRUE;
+                }
+            }
+        }
+        break;
+        }
+    }
+
+    return count;
+}
+
+
+static uint32 IfxAsclin_Asc_drainRxDmaBuffer(IfxAsclin_Asc *asclin)
+{
+    IfxAsclin_Asc_Dma *dma   = &asclin->dma;
+    uint32             mask  = (uint32)dma->rxBufferSize - 1;
+    uint32             write = (IfxDma_getChannelDestinationAddress(dma->rxDmaChannel.dma, dma->rxDmaChannel.channelId) - dma->rxBufferAddress) & mask;
+    uint32             read  = (uint32)dma->rxReadIndex;
+    uint32             count = (write - read) & mask;
+
+    if (count != 0)
+    {
+        /* The written part may wrap at the end of the circular buffer */
+        uint32    first = __minu(count, (uint32)dma->rxBufferSize - read);
+        Ifx_SizeT left  = Ifx_Fifo_write(asclin->rx, &dma->rxBuffer[read], (Ifx_SizeT)first, TIME_NULL);
+
+        if (count > first)
+        {
+            left += Ifx_Fifo_write(asclin->rx, dma->rxBuffer, (Ifx_SizeT)(count - first), TIME_NULL);
+        }
+
+        if (left != 0)
+        {
+            /* Receive buffer is full, data is discard */
+            asclin->rxSwFifoOverflow = TRUE;
+        }
+
+        dma->rxReadIndex = (Ifx_SizeT)write;
+    }
+
+    return count;
+}
+
+
+static uint32 IfxAsclin_Asc_fillTxFifo(IfxAsclin_Asc *asclin)
+{
+    uint8  ascData[IFXASCLIN_FIFO_DEPTH];
+    uint32 count = IFXASCLIN_FIFO_DEPTH - __minu(IfxAsclin_getTxFifoFillLevel(asclin->asclin), IFXASCLIN_FIFO_DEPTH);
+
+    switch (asclin->dataBufferMode)
+    {
+    case Ifx_DataBufferMode_normal:
+    {
+        count -= Ifx_Fifo_read(asclin->tx, ascData, (Ifx_SizeT)count, TIME_NULL);
+        break;
+    }
+    case Ifx_DataBufferMode_timeStampSingle:
+    {
+        Ifx_DataBufferMode_TimeStampSingle packedData;
+        uint32                             i = 0;
+
+        while ((i < count) && (Ifx_Fifo_read(asclin->tx, &packedData, sizeof(packedData), TIME_NULL) == 0))
+        {
+            ascData[i] = packedData.data;
+            i++;
+        }
+
+        count = i;
+    }
+    break;
+    }
+
+    if (count != 0)
+    {
+        /* FIXME add support for data size != 8 bit */
+        IfxAsclin_write8(asclin->asclin, ascData, count);
+    }
+
+    return count;
+}
+
+
+static void IfxAsclin_Asc_initDma(IfxAsclin_Asc *asclin, const IfxAsclin_Asc_Config *config)
+{
+    Ifx_ASCLIN              *asclinSFR = asclin->asclin;
+    Ifx_SizeT                size      = config->dma.rxBufferSize;
+    uint32                   coreId    = IfxCpu_getCoreId();
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+
+    /* the DMA moves raw bytes, and wraps the receive buffer on address boundaries */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, asclin->dataBufferMode == Ifx_DataBufferMode_normal);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size >= 32) && ((size & (size - 1)) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->dma.rxBuffer & (uint32)(size - 1)) == 0);
+
+    asclin->dma.rxBuffer        = (uint8 *)config->dma.rxBuffer;
+    asclin->dma.rxBufferAddress = IFXCPU_GLB_ADDR_DSPR(coreId, config->dma.rxBuffer);
+    asclin->dma.rxBufferSize    = size;
+    asclin->dma.rxReadIndex     = 0;
+    asclin->dma.txLinkedList    = config->dma.txLinkedList;
+    asclin->dma.txCount         = 0;
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    {
+        dmaCfg.channelId                     = config->dma.rxDmaChannelId;
+        dmaCfg.hardwareRequestEnabled        = TRUE; // triggered by each byte received
+        dmaCfg.channelInterruptEnabled       = TRUE; // trigger interrupt every half buffer
+        dmaCfg.channelInterruptPriority      = config->interrupt.rxPriority;
+        dmaCfg.channelInterruptTypeOfService = config->interrupt.typeOfService;
+
+        // source address is fixed; use circular mode to stay at this address for each move
+        dmaCfg.sourceAddress               = (uint32)&asclinSFR->RXDATA.U;
+        dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.sourceCircularBufferEnabled = TRUE;
+
+        // destination is the circular buffer, the transaction is restarted at its end
+        dmaCfg.destinationAddress               = asclin->dma.rxBufferAddress;
+        dmaCfg.destinationAddressCircularRange  = IfxDma_getCircularRangeCode((uint16)size);
+        dmaCfg.destinationCircularBufferEnabled = TRUE;
+        dmaCfg.transferCount                    = (uint32)size / 2;
+
+        dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+        dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_8bit;
+        dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+
+        IfxDma_Dma_initChannel(&asclin->dma.rxDmaChannel, &dmaCfg);
+    }
+
+    {
+        dmaCfg.channelId                     = config->dma.txDmaChannelId;
+        dmaCfg.hardwareRequestEnabled        = FALSE; // will be enabled by IfxAsclin_Asc_startDmaTransmission()
+        dmaCfg.channelInterruptEnabled       = TRUE;  // trigger interrupt after transaction
+        dmaCfg.channelInterruptPriority      = config->interrupt.txPriority;
+        dmaCfg.channelInterruptTypeOfService = config->interrupt.typeOfService;
+
+        // source address and transfer count will be configured during runtime
+        dmaCfg.sourceAddress               = 0;
+        dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.sourceCircularBufferEnabled = FALSE;
+        dmaCfg.transferCount               = 0;
+
+        // destination address is fixed; use circular mode to stay at this address for each move
+        dmaCfg.destinationAddress               = (uint32)&asclinSFR->TXDATA.U;
+        dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.destinationCircularBufferEnabled = TRUE;
+
+        dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_single;
+        dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_8bit;
+        dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+
+        IfxDma_Dma_initChannel(&asclin->dma.txDmaChannel, &dmaCfg);
+
+        if (asclin->dma.txLinkedList != NULL_PTR)
+        {
+            /* last transaction of a wrapped transfer, loaded at the end of the first one */
+            IfxDma_Dma_initLinkedListEntry((void *)asclin->dma.txLinkedList, &dmaCfg);
+        }
+    }
+}
+
+
+static void IfxAsclin_Asc_startDmaTransmission(IfxAsclin_Asc *asclin)
+{
+    Ifx_DMA         *dmaSFR    = asclin->dma.txDmaChannel.dma;
+    IfxDma_ChannelId channelId = asclin->dma.txDmaChannel.channelId;
+    uint32           coreId    = IfxCpu_getCoreId();
+    Ifx_Fifo_Span    span[2];
+    Ifx_SizeT        count     = Ifx_Fifo_peekRead(asclin->tx, span, IFXASCLIN_ASC_DMA_MAX_TRANSFER_COUNT);
+
+    if ((span[1].length != 0) && (asclin->dma.txLinkedList == NULL_PTR))
+    {
+        /* The wrapped part will be sent by the next transfer */
+        count          = span[0].length;
+        span[1].length = 0;
+    }
+
+    asclin->dma.txCount = count;
+
+    if (count != 0)
+    {
+        asclin->txInProgress = TRUE;
+
+        IfxDma_setChannelSourceAddress(dmaSFR, channelId, (void *)IFXCPU_GLB_ADDR_DSPR(coreId, span[0].data));
+        IfxDma_setChannelTransferCount(dmaSFR, channelId, (uint32)span[0].length);
+
+        if (span[1].length != 0)
+        {
+            /* Chain the wrapped part: the channel stays enabled and loads the linked transaction */
+            Ifx_DMA_CH *linkedList = asclin->dma.txLinkedList;
+            linkedList->SADR.U        = IFXCPU_GLB_ADDR_DSPR(coreId, span[1].data);
+            linkedList->CHCFGR.B.TREL = (uint32)span[1].length;
+
+            IfxDma_setChannelShadow(dmaSFR, channelId, IfxDma_ChannelShadow_linkedList);
+            dmaSFR->CH[channelId].SHADR.U = IFXCPU_GLB_ADDR_DSPR(coreId, linkedList);
+            IfxDma_setChannelContinuousMode(dmaSFR, channelId);
+            IfxDma_disableChannelInterrupt(dmaSFR, channelId);
+        }
+        else
+        {
+            IfxDma_setChannelShadow(dmaSFR, channelId, IfxDma_ChannelShadow_none);
+            IfxDma_setChannelSingleMode(dmaSFR, channelId);
+            IfxDma_enableChannelInterrupt(dmaSFR, channelId);
+        }
+
+        /* data and linked transaction must be in memory before the DMA reads them */
+        __dsync();
+        IfxDma_enableChannelTransaction(dmaSFR, channelId);
+
+        if (IfxAsclin_getTxFifoFillLevel(asclin->asclin) == 0)
+        {
+            /* No byte left in the hardware FIFO to raise the next request: move the first byte by software */
+            IfxDma_startChannelTransaction(dmaSFR, channelId);
+        }
+    }
+    else
+    {
+        /* Transmit buffer is empty */
+        asclin->txInProgress = FALSE;
+    }
+}
+
+
 uint8 IfxAsclin_Asc_blockingRead(IfxAsclin_Asc *asclin)
 {
     Ifx_SizeT count = 1;
@@ -67,13 +366,42 @@ boolean IfxAsclin_Asc_canWriteCount(IfxAsclin_Asc *asclin, Ifx_SizeT count, Ifx_
 void IfxAsclin_Asc_clearRx(IfxAsclin_Asc *asclin)
 {
     IfxAsclin_flushRxFifo(asclin->asclin);
+
+    if (asclin->dma.useDma)
+    {
+        /* Skip the data not yet copied from the DMA buffer */
+        IfxAsclin_Asc_Dma *dma    = &asclin->dma;
+        uint32             offset = IfxDma_getChannelDestinationAddress(dma->rxDmaChannel.dma, dma->rxDmaChannel.channelId) - dma->rxBufferAddress;
+        dma->rxReadIndex = (Ifx_SizeT)(offset & ((uint32)dma->rxBufferSize - 1));
+    }
+
     Ifx_Fifo_clear(asclin->rx);
 }
 
 
 void IfxAsclin_Asc_clearTx(IfxAsclin_Asc *asclin)
 {
-    Ifx_Fifo_clear(asclin->tx);
+    if (asclin->dma.useDma)
+    {
+        /* The DMA must not read the software FIFO while it is cleared */
+        boolean          interruptState = IfxCpu_disableInterrupts();
+        Ifx_DMA         *dmaSFR         = asclin->dma.txDmaChannel.dma;
+        IfxDma_ChannelId channelId      = asclin->dma.txDmaChannel.channelId;
+
+        IfxDma_disableChannelTransaction(dmaSFR, channelId);
+        IfxDma_clearChannelInterrupt(dmaSFR, channelId);
+        IfxSrc_clearRequest(IfxDma_getSrcPointer(dmaSFR, channelId));
+        asclin->dma.txCount  = 0;
+        asclin->txInProgress = FALSE;
+        Ifx_Fifo_clear(asclin->tx);
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+    else
+    {
+        Ifx_Fifo_clear(asclin->tx);
+    }
+
     IfxAsclin_flushTxFifo(asclin->asclin);
 }
 
@@ -109,6 +437,12 @@ boolean IfxAsclin_Asc_flushTx(IfxAsclin_Asc *asclin, Ifx_TickTime timeout)
 }
 
 
+void IfxAsclin_Asc_getIsrStatistics(IfxAsclin_Asc *asclin, IfxStdIf_DPipe_IsrStatistics *statistics)
+{
+    *statistics = asclin->isrStatistics;
+}
+
+
 sint32 IfxAsclin_Asc_getReadCount(IfxAsclin_Asc *asclin)
 {
     return Ifx_Fifo_readCount(asclin->rx);
@@ -174,7 +508,17 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
     IfxAsclin_setRxFifoOutletWidth(asclinSFR, config->fifo.outWidth);                /* setting Rx FIFO outlet width */
     IfxAsclin_setIdleDelay(asclinSFR, config->frame.idleDelay);                      /* setting idle delay */
     IfxAsclin_setTxFifoInterruptLevel(asclinSFR, config->fifo.txFifoInterruptLevel); /* setting Tx FIFO level at which a Tx interrupt will be triggered*/
-    IfxAsclin_setRxFifoInterruptLevel(asclinSFR, config->fifo.rxFifoInterruptLevel); /* setting Rx FIFO interrupt level at which a Rx interrupt will be triggered*/
+    if (config->dma.useDma)
+    {
+        /* one DMA request per byte moved */
+        IfxAsclin_setTxFifoInterruptLevel(asclinSFR, IfxAsclin_TxFifoInterruptLevel_15);
+        IfxAsclin_setRxFifoInterruptLevel(asclinSFR, IfxAsclin_RxFifoInterruptLevel_1);
+    }
+    else
+    {
+        IfxAsclin_setRxFifoInterruptLevel(asclinSFR, config->fifo.rxFifoInterruptLevel); /* setting Rx FIFO interrupt level at which a Rx interrupt will be triggered*/
+    }
+
     IfxAsclin_setFrameMode(asclinSFR, config->frame.frameMode);                      /* selecting the frame mode*/
 
     /* Pin mapping */
@@ -253,6 +597,8 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
     asclin->dataBufferMode = config->dataBufferMode;
     asclin->txTimestamp    = 0;
     asclin->sendCount      = 0;
+    asclin->rxIdleLevel    = 0;
+    memset(&asclin->isrStatistics, 0, sizeof(asclin->isrStatistics));
 
     switch (asclin->dataBufferMode)
     {
@@ -280,15 +626,36 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
 
     if (config->rxBuffer != NULL_PTR)
     {
-        asclin->rx = Ifx_Fifo_init(config->rxBuffer, config->rxBufferSize, elementSize);
+        asclin->rx = Ifx_Fifo_initMode(config->rxBuffer, config->rxBufferSize, elementSize, config->rxFifoMode);
     }
     else
     {
-        asclin->rx = Ifx_Fifo_create(config->rxBufferSize, elementSize);
+        asclin->rx = Ifx_Fifo_createMode(config->rxBufferSize, elementSize, config->rxFifoMode);
+    }
+
+    /* DMA transfers */
+    asclin->dma.useDma = config->dma.useDma;
+
+    if (config->dma.useDma)
+    {
+        volatile Ifx_SRC_SRCR *src;
+
+        /* the DMA channels interrupts use the rx and tx priorities */
+        IfxAsclin_Asc_initDma(asclin, config);
+
+        src = IfxAsclin_getSrcPointerRx(asclinSFR);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.rxDmaChannelId);
+        IfxAsclin_enableRxFifoFillLevelFlag(asclinSFR, TRUE);
+        IfxSrc_enable(src);
+
+        src = IfxAsclin_getSrcPointerTx(asclinSFR);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.txDmaChannelId);
+        IfxAsclin_enableTxFifoFillLevelFlag(asclinSFR, TRUE);
+        IfxSrc_enable(src);
     }
 
     /* initialising the interrupts */
-    if (config->interrupt.rxPriority > 0)
+    if ((config->interrupt.rxPriority > 0) && (config->dma.useDma == FALSE))
     {
         volatile Ifx_SRC_SRCR *src;
         src = IfxAsclin_getSrcPointerRx(asclinSFR);
@@ -297,7 +664,7 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
         IfxSrc_enable(src);
     }
 
-    if (config->interrupt.txPriority > 0)
+    if ((config->interrupt.txPriority > 0) && (config->dma.useDma == FALSE))
     {
         volatile Ifx_SRC_SRCR *src;
         src = IfxAsclin_getSrcPointerTx(asclinSFR);
@@ -354,7 +721,7 @@ void IfxAsclin_Asc_initModuleConfig(IfxAsclin_Asc_Config *config, Ifx_ASCLIN *as
     /* Default Values for Fifo Control */
     config->fifo.inWidth              = IfxAsclin_TxFifoInletWidth_1;          /* 8-bit wide write*/
     config->fifo.outWidth             = IfxAsclin_RxFifoOutletWidth_1;         /* 8-bit wide read*/
-    config->fifo.txFifoInterruptLevel = IfxAsclin_TxFifoInterruptLevel_15;
+    config->fifo.txFifoInterruptLevel = IfxAsclin_TxFifoInterruptLevel_4;     /* refill when 4 bytes are left in the HW FIFO*/
     config->fifo.rxFifoInterruptLevel = IfxAsclin_RxFifoInterruptLevel_1;
     config->fifo.buffMode             = IfxAsclin_ReceiveBufferMode_rxFifo;    /* RxFIFO*/
 
@@ -376,37 +743,38 @@ void IfxAsclin_Asc_initModuleConfig(IfxAsclin_Asc_Config *config, Ifx_ASCLIN *as
     config->rxBufferSize   = 0;                                                /* Rx Fifo buffer size*/
 
     config->dataBufferMode = Ifx_DataBufferMode_normal;
+    config->rxFifoMode     = Ifx_Fifo_Mode_locked;
+
+    /* DMA disabled */
+    config->dma.rxDmaChannelId = IfxDma_ChannelId_none;
+    config->dma.txDmaChannelId = IfxDma_ChannelId_none;
+    config->dma.useDma         = FALSE;
+    config->dma.rxBuffer       = NULL_PTR;
+    config->dma.rxBufferSize   = 0;
+    config->dma.txLinkedList   = NULL_PTR;
 }
 
 
 void IfxAsclin_Asc_initiateTransmission(IfxAsclin_Asc *asclin)
 {
-    if (asclin->txInProgress == FALSE)     /* Send first byte: send init */
+    if (asclin->txInProgress == FALSE)     /* Send first bytes: send init */
     {
         if (Ifx_Fifo_isEmpty(asclin->tx) == FALSE)
         {
-            uint8 data;
-            asclin->txInProgress = TRUE;
+            /* the transmit ISR must not interleave between the software FIFO read and the hardware FIFO write */
+            boolean interruptState = IfxCpu_disableInterrupts();
 
-            switch (asclin->dataBufferMode)
+            if (asclin->dma.useDma)
             {
-            case Ifx_DataBufferMode_normal:
-            {
-                Ifx_Fifo_read(asclin->tx, &data, 1, TIME_NULL);
-                /* FIXME optimize usage of HW fifo */
-                /* FIXME add support for data size != 8 bit */
+                IfxAsclin_Asc_startDmaTransmission(asclin);
             }
-            break;
-            case Ifx_DataBufferMode_timeStampSingle:
+            else
             {
-                Ifx_DataBufferMode_TimeStampSingle packedData;
-                Ifx_Fifo_read(asclin->tx, &packedData, sizeof(packedData), TIME_NULL);
-                data = packedData.data;
-            }
-            break;
+                asclin->txInProgress = TRUE;
+                asclin->sendCount   += IfxAsclin_Asc_fillTxFifo(asclin);
             }
 
-            IfxAsclin_write8(asclin->asclin, &data, 1);
+            IfxCpu_restoreInterrupts(interruptState);
         }
     }
 }
@@ -451,85 +819,91 @@ void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin)
 
 void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
 {
-    uint8 ascData;
+    uint32 count;
 
-    switch (asclin->dataBufferMode)
+    if (asclin->dma.useDma)
     {
-    case Ifx_DataBufferMode_normal:
+        IfxDma_clearChannelInterrupt(asclin->dma.rxDmaChannel.dma, asclin->dma.rxDmaChannel.channelId);
+        count = IfxAsclin_Asc_drainRxDmaBuffer(asclin);
+    }
+    else
     {
-        /* FIXME optimize usage of HW fifo */
-        /* FIXME add support for data size != 8 bit */
-        IfxAsclin_read8(asclin->asclin, &ascData, 1);
+        count = IfxAsclin_Asc_drainRxFifo(asclin);
+    }
+
+    asclin->isrStatistics.rxInterrupts++;
+    asclin->isrStatistics.rxBytes += count;
+}
+
+
+void IfxAsclin_Asc_isrReceiveTimeout(IfxAsclin_Asc *asclin)
+{
+    if (asclin->dma.useDma)
+    {
+        /* Get the data of the incomplete half buffer. The receive ISR must not interleave */
+        boolean interruptState = IfxCpu_disableInterrupts();
+        uint32  count          = IfxAsclin_Asc_drainRxDmaBuffer(asclin);
 
-        if (Ifx_Fifo_write(asclin->rx, &ascData, 1, TIME_NULL) != 0)
+        if (count != 0)
         {
-            /* Receive buffer is full, data is discard */
-            asclin->rxSwFifoOverflow = TRUE;
+            asclin->isrStatistics.rxInterrupts++;
+            asclin->isrStatistics.rxBytes += count;
         }
 
-        break;
+        IfxCpu_restoreInterrupts(interruptState);
     }
-    case Ifx_DataBufferMode_timeStampSingle:
+    else
     {
-        Ifx_DataBufferMode_TimeStampSingle packedData;
-
-        packedData.timestamp = now();
-        IfxAsclin_read8(asclin->asclin, &ascData, 1);
-        packedData.data      = ascData;
+        uint8 level = IfxAsclin_getRxFifoFillLevel(asclin->asclin);
 
-        if (Ifx_Fifo_write(asclin->rx, &packedData, sizeof(packedData), TIME_NULL) != 0)
+        if ((level != 0) && (level == asclin->rxIdleLevel))
         {
-            /* Receive buffer is full, data is discard */
-            asclin->rxSwFifoOverflow = TRUE;
+            /* No data received since the last call: the line is idle. The receive ISR must not interleave */
+            boolean interruptState = IfxCpu_disableInterrupts();
+            uint32  count          = IfxAsclin_Asc_drainRxFifo(asclin);
+
+            if (count != 0)
+            {
+                asclin->isrStatistics.rxInterrupts++;
+                asclin->isrStatistics.rxBytes += count;
+            }
+
+            IfxCpu_restoreInterrupts(interruptState);
+            level = 0;
         }
-    }
-    break;
+
+        asclin->rxIdleLevel = level;
     }
 }
 
 
 void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
 {
-    asclin->txTimestamp = now();
-    asclin->sendCount++;
+    uint32 count;
 
-    switch (asclin->dataBufferMode)
+    if (asclin->dma.useDma)
     {
-    case Ifx_DataBufferMode_normal:
+        /* The DMA transfer is complete: release the sent data and send the next ones */
+        IfxDma_clearChannelInterrupt(asclin->dma.txDmaChannel.dma, asclin->dma.txDmaChannel.channelId);
+        count = (uint32)asclin->dma.txCount;
+        Ifx_Fifo_consumeRead(asclin->tx, (Ifx_SizeT)count);
+        IfxAsclin_Asc_startDmaTransmission(asclin);
+    }
+    else
     {
-        uint8 ascData;
+        count = IfxAsclin_Asc_fillTxFifo(asclin);
 
-        if (Ifx_Fifo_read(asclin->tx, &ascData, 1, TIME_NULL) != 0)
+        if (count == 0)
         {
             /* Transmit buffer is empty */
             asclin->txInProgress = FALSE;
         }
-        else
-        {
-            /* FIXME optimize usage of HW fifo */
-            /* FIXME add support for data size != 8 bit */
-            IfxAsclin_write8(asclin->asclin, &ascData, 1);
-        }
-
-        break;
     }
-    case Ifx_DataBufferMode_timeStampSingle:
-    {
-        Ifx_DataBufferMode_TimeStampSingle packedData;
-        uint8                              ascData;
 
-        if (Ifx_Fifo_read(asclin->tx, &packedData, sizeof(packedData), TIME_NULL) != 0)
-        {       /* Transmit buffer is empty */
-            asclin->txInProgress = FALSE;
-        }
-        else
-        {
-            ascData = packedData.data;
-            IfxAsclin_write8(asclin->asclin, &ascData, 1);
-        }
-    }
-    break;
-    }
+    asclin->txTimestamp = now();
+    asclin->sendCount  += count;
+    asclin->isrStatistics.txInterrupts++;
+    asclin->isrStatistics.txBytes += count;
 }
 
 
@@ -555,25 +929,26 @@ boolean IfxAsclin_Asc_stdIfDPipeInit(IfxStdIf_DPipe *stdif, IfxAsclin_Asc *ascli
     memset(stdif, 0, sizeof(IfxStdIf_DPipe));
 
     /* Set the API link */
-    stdif->driver         = asclin;
-    stdif->write          = (IfxStdIf_DPipe_Write) & IfxAsclin_Asc_write;
-    stdif->read           = (IfxStdIf_DPipe_Read) & IfxAsclin_Asc_read;
-    stdif->getReadCount   = (IfxStdIf_DPipe_GetReadCount) & IfxAsclin_Asc_getReadCount;
-    stdif->getReadEvent   = (IfxStdIf_DPipe_GetReadEvent) & IfxAsclin_Asc_getReadEvent;
-    stdif->getWriteCount  = (IfxStdIf_DPipe_GetWriteCount) & IfxAsclin_Asc_getWriteCount;
-    stdif->getWriteEvent  = (IfxStdIf_DPipe_GetWriteEvent) & IfxAsclin_Asc_getWriteEvent;
-    stdif->canReadCount   = (IfxStdIf_DPipe_CanReadCount) & IfxAsclin_Asc_canReadCount;
-    stdif->canWriteCount  = (IfxStdIf_DPipe_CanWriteCount) & IfxAsclin_Asc_canWriteCount;
-    stdif->flushTx        = (IfxStdIf_DPipe_FlushTx) & IfxAsclin_Asc_flushTx;
-    stdif->clearTx        = (IfxStdIf_DPipe_ClearTx) & IfxAsclin_Asc_clearTx;
-    stdif->clearRx        = (IfxStdIf_DPipe_ClearRx) & IfxAsclin_Asc_clearRx;
-    stdif->onReceive      = (IfxStdIf_DPipe_OnReceive) & IfxAsclin_Asc_isrReceive;
-    stdif->onTransmit     = (IfxStdIf_DPipe_OnTransmit) & IfxAsclin_Asc_isrTransmit;
-    stdif->onError        = (IfxStdIf_DPipe_OnError) & IfxAsclin_Asc_isrError;
-    stdif->getSendCount   = (IfxStdIf_DPipe_GetSendCount) & IfxAsclin_Asc_getSendCount;
-    stdif->getTxTimeStamp = (IfxStdIf_DPipe_GetTxTimeStamp) & IfxAsclin_Asc_getTxTimeStamp;
-    stdif->resetSendCount = (IfxStdIf_DPipe_ResetSendCount) & IfxAsclin_Asc_resetSendCount;
-    stdif->txDisabled     = FALSE;
+    stdif->driver           = asclin;
+    stdif->write            = (IfxStdIf_DPipe_Write) & IfxAsclin_Asc_write;
+    stdif->read             = (IfxStdIf_DPipe_Read) & IfxAsclin_Asc_read;
+    stdif->getReadCount     = (IfxStdIf_DPipe_GetReadCount) & IfxAsclin_Asc_getReadCount;
+    stdif->getReadEvent     = (IfxStdIf_DPipe_GetReadEvent) & IfxAsclin_Asc_getReadEvent;
+    stdif->getWriteCount    = (IfxStdIf_DPipe_GetWriteCount) & IfxAsclin_Asc_getWriteCount;
+    stdif->getWriteEvent    = (IfxStdIf_DPipe_GetWriteEvent) & IfxAsclin_Asc_getWriteEvent;
+    stdif->canReadCount     = (IfxStdIf_DPipe_CanReadCount) & IfxAsclin_Asc_canReadCount;
+    stdif->canWriteCount    = (IfxStdIf_DPipe_CanWriteCount) & IfxAsclin_Asc_canWriteCount;
+    stdif->flushTx          = (IfxStdIf_DPipe_FlushTx) & IfxAsclin_Asc_flushTx;
+    stdif->clearTx          = (IfxStdIf_DPipe_ClearTx) & IfxAsclin_Asc_clearTx;
+    stdif->clearRx          = (IfxStdIf_DPipe_ClearRx) & IfxAsclin_Asc_clearRx;
+    stdif->onReceive        = (IfxStdIf_DPipe_OnReceive) & IfxAsclin_Asc_isrReceive;
+    stdif->onTransmit       = (IfxStdIf_DPipe_OnTransmit) & IfxAsclin_Asc_isrTransmit;
+    stdif->onError          = (IfxStdIf_DPipe_OnError) & IfxAsclin_Asc_isrError;
+    stdif->getSendCount     = (IfxStdIf_DPipe_GetSendCount) & IfxAsclin_Asc_getSendCount;
+    stdif->getTxTimeStamp   = (IfxStdIf_DPipe_GetTxTimeStamp) & IfxAsclin_Asc_getTxTimeStamp;
+    stdif->resetSendCount   = (IfxStdIf_DPipe_ResetSendCount) & IfxAsclin_Asc_resetSendCount;
+    stdif->getIsrStatistics = (IfxStdIf_DPipe_GetIsrStatistics) & IfxAsclin_Asc_getIsrStatistics;
+    stdif->txDisabled       = FALSE;
     return TRUE;
 }
 
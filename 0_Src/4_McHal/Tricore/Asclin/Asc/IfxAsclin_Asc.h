@@ -197,6 +197,47 @@
  *     }
  * \endcode
  *
+ * \subsection IfxLld_Asclin_Asc_InterruptLoad Interrupt Load
+ * The interrupt handlers move as many bytes as possible per interrupt: the receive handler empties the hardware FIFO,
+ * the transmit handler fills it. The number of interrupts per byte is set with the FIFO interrupt levels.
+ * A receive level above 1 requires IfxAsclin_Asc_isrReceiveTimeout() to be called periodically so that the last bytes
+ * of a message are not held back in the hardware FIFO:
+ * \code
+ *     ascConfig.fifo.rxFifoInterruptLevel = IfxAsclin_RxFifoInterruptLevel_8;
+ *
+ * IFX_INTERRUPT(stm0Sr0ISR, 0, IFX_INTPRIO_STM0_SR0)    // e.g. every 1 ms
+ * {
+ *     ...
+ *     IfxAsclin_Asc_isrReceiveTimeout(&asc);
+ * }
+ * \endcode
+ * The interrupt counters are available through IfxAsclin_Asc_getIsrStatistics() or IfxStdIf_DPipe_getIsrStatistics():
+ * \code
+ *     IfxStdIf_DPipe_IsrStatistics statistics;
+ *     IfxAsclin_Asc_getIsrStatistics(&asc, &statistics);
+ *     // bytes per receive interrupt: statistics.rxBytes / statistics.rxInterrupts
+ * \endcode
+ *
+ * \subsection IfxLld_Asclin_Asc_Dma DMA Transfers
+ * Optionally the data are moved by two DMA channels, the CPU is then only interrupted once per DMA transfer.
+ * The transmit channel sends the data directly out of the tx software FIFO, the receive channel writes into a
+ * circular buffer which is copied to the rx software FIFO every half buffer. The receive buffer must be aligned on its size:
+ * \code
+ * #define ASC_RX_DMA_BUFFER_SIZE 256
+ * static uint8 __attribute__ ((aligned(ASC_RX_DMA_BUFFER_SIZE))) ascRxDmaBuffer[ASC_RX_DMA_BUFFER_SIZE];
+ * static Ifx_DMA_CH __attribute__ ((aligned(32))) ascTxDmaLinkedList;
+ *
+ *     ascConfig.dma.useDma         = TRUE;
+ *     ascConfig.dma.txDmaChannelId = IfxDma_ChannelId_3;
+ *     ascConfig.dma.rxDmaChannelId = IfxDma_ChannelId_4;
+ *     ascConfig.dma.rxBuffer       = ascRxDmaBuffer;
+ *     ascConfig.dma.rxBufferSize   = ASC_RX_DMA_BUFFER_SIZE;
+ *     ascConfig.dma.txLinkedList   = &ascTxDmaLinkedList;
+ * \endcode
+ * The transmit and receive priorities are then used by the DMA channel interrupts, the interrupt handlers are
+ * installed as described in \ref IfxLld_Asclin_Asc_Interrupt with the DMA channel service requests.
+ * IfxAsclin_Asc_isrReceiveTimeout() must be called periodically to get the data of the incomplete half buffer.
+ * The standard interface is unchanged, only the data buffer mode Ifx_DataBufferMode_normal is supported.
  * \defgroup IfxLld_Asclin_Asc ASC
  * \ingroup IfxLld_Asclin
  * \defgroup IfxLld_Asclin_Asc_DataStructures Data Structures
@@ -219,11 +260,20 @@
 /******************************************************************************/
 
 #include "Asclin/Std/IfxAsclin.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 #include "_Lib/DataHandling/Ifx_Fifo.h"
 #include "SysSe/Bsp/Bsp.h"
 #include "StdIf/IfxStdIf_DPipe.h"
 #include "string.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximum number of bytes moved by one DMA transmit transaction (CHCFGR.TREL)
+ */
+#define IFXASCLIN_ASC_DMA_MAX_TRANSFER_COUNT (16383)
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -258,6 +308,19 @@ typedef struct
     IfxAsclin_SamplePointPosition samplePointPosition;     /**< \brief BITCON.SAMPLEPOINT, sample point position */
 } IfxAsclin_Asc_BitTimingControl;
 
+/** \brief Structure for DMA configuration
+ */
+typedef struct
+{
+    IfxDma_ChannelId rxDmaChannelId;     /**< \brief DMA channel no for the receive path */
+    IfxDma_ChannelId txDmaChannelId;     /**< \brief DMA channel no for the transmit path */
+    boolean          useDma;             /**< \brief use DMA for the data transfers instead of the Rx / Tx interrupts */
+    void            *rxBuffer;           /**< \brief Circular buffer written by the receive DMA channel. Must be aligned on rxBufferSize */
+    Ifx_SizeT        rxBufferSize;       /**< \brief Size of rxBuffer in bytes, a power of 2 from 32 to 16384 */
+    Ifx_DMA_CH      *txLinkedList;       /**< \brief Transaction control set used to send the wrapped part of the tx FIFO in the same DMA transfer, 32 byte aligned.
+                                          * If set to NULL_PTR, the wrapped part is sent by a second DMA transfer */
+} IfxAsclin_Asc_DmaConfig;
+
 /** \brief Structure for FIFO control
  */
 typedef struct
@@ -319,6 +382,21 @@ typedef union
 
 /** \addtogroup IfxLld_Asclin_Asc_DataStructures
  * \{ */
+/** \brief DMA handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel rxDmaChannel;        /**< \brief receive DMA channel handle */
+    IfxDma_Dma_Channel txDmaChannel;        /**< \brief transmit DMA channel handle */
+    boolean            useDma;              /**< \brief use DMA for the data transfers */
+    uint8             *rxBuffer;            /**< \brief Circular buffer written by the receive DMA channel */
+    uint32             rxBufferAddress;     /**< \brief Global address of rxBuffer, as seen by the DMA */
+    Ifx_SizeT          rxBufferSize;        /**< \brief Size of rxBuffer in bytes */
+    Ifx_SizeT          rxReadIndex;         /**< \brief Offset in rxBuffer of the first byte not yet moved to the rx FIFO */
+    Ifx_DMA_CH        *txLinkedList;        /**< \brief Transaction control set of the wrapped part of the tx FIFO, or NULL_PTR */
+    Ifx_SizeT          txCount;             /**< \brief Number of bytes of the ongoing DMA transmit transfer */
+} IfxAsclin_Asc_Dma;
+
 /** \brief Module Handle
  */
 typedef struct
@@ -332,6 +410,9 @@ typedef struct
     Ifx_DataBufferMode            dataBufferMode;       /**< \brief Rx buffer mode */
     volatile uint32               sendCount;            /**< \brief Number of byte that are send out, this value is reset with the function Asc_If_resetSendCount() */
     volatile Ifx_TickTime         txTimestamp;          /**< \brief Time stamp of the latest send byte */
+    IfxStdIf_DPipe_IsrStatistics  isrStatistics;        /**< \brief Interrupt load counters, \see IfxAsclin_Asc_getIsrStatistics */
+    uint8                         rxIdleLevel;          /**< \brief Rx hardware FIFO fill level seen by the last call to IfxAsclin_Asc_isrReceiveTimeout() */
+    IfxAsclin_Asc_Dma             dma;                  /**< \brief DMA handle */
 } IfxAsclin_Asc;
 
 /** \brief Configuration structure of the module
@@ -361,6 +442,9 @@ typedef struct
                                                         * If set to NULL, the buffer will be allocated dynamically according to rxBufferSize */
     boolean            loopBack;                       /**< \brief IOCR.LB, loop back mode selection, 0 for disable, 1 for enable */
     Ifx_DataBufferMode dataBufferMode;                 /**< \brief Rx buffer mode */
+    Ifx_Fifo_Mode      rxFifoMode;                     /**< \brief Rx buffer synchronisation mode. Ifx_Fifo_Mode_spsc avoids disabling the interrupts in the receive ISR.
+                                                        * The rx buffer must then only be read from a single context and IfxAsclin_Asc_clearRx() must be called from this context. */
+    IfxAsclin_Asc_DmaConfig dma;                       /**< \brief DMA configuration */
 } IfxAsclin_Asc_Config;
 
 /** \} */
@@ -384,13 +468,37 @@ IFX_EXTERN void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin);
 
 /** \brief ISR receive routine
  * \see IfxSdtIf_DPipe_OnReceive
+ * All the data present in the hardware FIFO are moved to the software FIFO.
+ * The interrupt is raised when the hardware FIFO reaches the level IfxAsclin_Asc_Config.fifo.rxFifoInterruptLevel.
+ * In DMA mode, the interrupt is raised by the receive DMA channel every half buffer and the data received
+ * since the previous call are copied from the DMA buffer to the software FIFO.
  * \param asclin module handler
  * \return None
  */
 IFX_EXTERN void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin);
 
+/** \brief Receive timeout routine
+ *
+ * With a rx FIFO interrupt level above 1, the last bytes of a message stay in the hardware FIFO until
+ * the level is reached. The ASC mode has no receive timeout event, therefore this function must be
+ * called from a periodic interrupt (e.g. a STM compare interrupt) with a period of at least one frame
+ * time. It moves the data from the hardware FIFO to the software FIFO when no byte has been received
+ * since the previous call, which bounds the receive latency to 2 periods.
+ *
+ * The function is not needed with the default interrupt level IfxAsclin_RxFifoInterruptLevel_1.
+ * In DMA mode, the function copies the data received since the previous call from the DMA buffer to
+ * the software FIFO, the period bounds the receive latency.
+ * \param asclin module handler
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_isrReceiveTimeout(IfxAsclin_Asc *asclin);
+
 /** \brief ISR transmit routine
  * \see IfxSdtIf_DPipe_OnTransmit
+ * The hardware FIFO is filled with as much data as available in the software FIFO.
+ * The interrupt is raised when the hardware FIFO level falls to IfxAsclin_Asc_Config.fifo.txFifoInterruptLevel.
+ * In DMA mode, the interrupt is raised at the end of the DMA transfer, the sent data are removed from the
+ * software FIFO and the next DMA transfer is started.
  * \param asclin module handler
  * \return None
  */
@@ -468,6 +576,13 @@ IFX_EXTERN void IfxAsclin_Asc_clearTx(IfxAsclin_Asc *asclin);
  */
 IFX_EXTERN boolean IfxAsclin_Asc_flushTx(IfxAsclin_Asc *asclin, Ifx_TickTime timeout);
 
+/** \brief \see IfxStdIf_DPipe_GetIsrStatistics
+ * \param asclin module handle
+ * \param statistics Pointer to the object where the counters are copied to
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_getIsrStatistics(IfxAsclin_Asc *asclin, IfxStdIf_DPipe_IsrStatistics *statistics);
+
 /** \brief \see IfxStdIf_DPipe_GetReadCount
  * \param asclin module handle
  * \return The number of bytes in the rx buffer
@@ -89,8 +89,13 @@ typedef signed char    sint8;               /*        -128 .. +127            */
 typedef unsigned char  uint8;               /*           0 .. 255             */
 typedef signed short   sint16;              /*      -32768 .. +32767          */
 typedef unsigned short uint16;              /*           0 .. 65535           */
+#if defined(__LP64__)                       /* 64 bit host build: long is 64 bit */
+typedef signed int     sint32;              /* -2147483648 .. +2147483647     */
+typedef unsigned int   uint32;              /*           0 .. 4294967295      */
+#else
 typedef signed long    sint32;              /* -2147483648 .. +2147483647     */
 typedef unsigned long  uint32;              /*           0 .. 4294967295      */
+#endif
 typedef float          float32;
 typedef double         float64;
 
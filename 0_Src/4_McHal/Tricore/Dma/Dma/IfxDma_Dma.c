@@ -97,6 +97,63 @@ static void IfxDma_Dma_configureTransactionSet(Ifx_DMA_CH *channel, IfxDma_Dma_C
 }
 
 
+void IfxDma_Dma_bulkCopy(void *channel, void *destination, const void *source, Ifx_SizeT count)
+{
+    IfxDma_Dma_copy((IfxDma_Dma_Channel *)channel, destination, source, count);
+}
+
+
+void IfxDma_Dma_copy(IfxDma_Dma_Channel *channel, void *destination, const void *source, Ifx_SizeT count)
+{
+    IfxCpu_ResourceCpu     cpu       = IfxCpu_getCoreIndex();
+    uint32                 dstAddr   = IFXCPU_GLB_ADDR_DSPR(cpu, destination);
+    uint32                 srcAddr   = IFXCPU_GLB_ADDR_DSPR(cpu, source);
+    uint32                 alignment = dstAddr | srcAddr | (uint32)count;
+    IfxDma_ChannelMoveSize moveSize;
+    uint32                 moveShift;
+    uint32                 moves;
+
+    if ((alignment & 3U) == 0)
+    {
+        moveSize  = IfxDma_ChannelMoveSize_32bit;
+        moveShift = 2;
+    }
+    else if ((alignment & 1U) == 0)
+    {
+        moveSize  = IfxDma_ChannelMoveSize_16bit;
+        moveShift = 1;
+    }
+    else
+    {
+        moveSize  = IfxDma_ChannelMoveSize_8bit;
+        moveShift = 0;
+    }
+
+    IfxDma_setChannelMoveSize(channel->dma, channel->channelId, moveSize);
+    moves = (uint32)count >> moveShift;
+
+    __dsync();                  /* source data written by the CPU are visible to the DMA */
+
+    while (moves != 0)
+    {
+        uint32 chunk = __minu(moves, IFXDMA_DMA_COPY_MAX_TRANSFER_COUNT);
+
+        IfxDma_Dma_setChannelSourceAddress(channel, srcAddr);
+        IfxDma_Dma_setChannelDestinationAddress(channel, dstAddr);
+        IfxDma_Dma_setChannelTransferCount(channel, chunk);
+        IfxDma_Dma_clearChannelInterrupt(channel);
+        IfxDma_Dma_startChannelTransaction(channel);
+
+        while (IfxDma_Dma_getAndClearChannelInterrupt(channel) == FALSE)
+        {}
+
+        srcAddr += chunk << moveShift;
+        dstAddr += chunk << moveShift;
+        moves   -= chunk;
+    }
+}
+
+
 void IfxDma_Dma_createModuleHandle(IfxDma_Dma *dmaHandle, Ifx_DMA *dma)
 {
     dmaHandle->dma = dma;
@@ -432,6 +432,14 @@
 #include "Dma/Std/IfxDma.h"
 #include "Cpu/Std/IfxCpu.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of moves of one transaction started by IfxDma_Dma_copy()
+ */
+#define IFXDMA_DMA_COPY_MAX_TRANSFER_COUNT (16383U)
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -690,6 +698,41 @@ IFX_INLINE void IfxDma_Dma_setChannelTransferCount(IfxDma_Dma_Channel *channel,
  */
 IFX_INLINE void IfxDma_Dma_startChannelTransaction(IfxDma_Dma_Channel *channel);
 
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Copy a memory block with the DMA channel and wait for the end of the copy
+ * \param channel pointer to the DMA base address and channel ID
+ * \param destination destination pointer (CPU local or global address)
+ * \param source source pointer (CPU local or global address)
+ * \param count number of bytes to be copied
+ * \return None
+ *
+ * The channel must be initialized with the defaults of IfxDma_Dma_initChannelConfig() (software
+ * request, increment step 1, interrupt flag set at the end of the transaction) and
+ * requestMode = IfxDma_ChannelRequestMode_completeTransactionPerRequest.
+ * The move size is selected by the function from the alignment of the pointers and of the count
+ * (32 bit, 16 bit or 8 bit), the transaction is split if the count exceeds the transfer count limit.
+ *
+ * The function polls the end of the transaction: it must not be called from an interrupt service routine.
+ * See IfxDma_Dma_bulkCopy() to use it as bulk copy handler of the circular buffers.
+ */
+IFX_EXTERN void IfxDma_Dma_copy(IfxDma_Dma_Channel *channel, void *destination, const void *source, Ifx_SizeT count);
+
+/** \brief Bulk copy handler of the circular buffers, calls IfxDma_Dma_copy()
+ * \param channel pointer to the DMA channel handle (IfxDma_Dma_Channel)
+ * \param destination destination pointer (CPU local or global address)
+ * \param source source pointer (CPU local or global address)
+ * \param count number of bytes to be copied
+ * \return None
+ *
+ * \code
+ * Ifx_CircularBuffer_setBulkCopy(&IfxDma_Dma_bulkCopy, &channel, IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD);
+ * \endcode
+ */
+IFX_EXTERN void IfxDma_Dma_bulkCopy(void *channel, void *destination, const void *source, Ifx_SizeT count);
+
 /** \} */
 
 /******************************************************************************/
@@ -97,7 +97,128 @@ float32 IfxDsadc_Rdc_calculateGroupDelay(IfxDsadc_Rdc *handle)
 }
 
 
+/** Initialise the DMA channels moving the SIN and COS results and the timestamp into the buffers */
+static void IfxDsadc_Rdc_initDma(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *config)
+{
+    const IfxDsadc_Rdc_ConfigHw  *configHw = &config->hardware;
+    const IfxDsadc_Rdc_DmaConfig *dmaConfig = &configHw->dma;
+    IfxDsadc_Rdc_Dma             *dmaHandle = &handle->dma;
+    Ifx_DSADC                    *dsadc     = handle->hardware.inputSin.module;
+    uint16                        size      = dmaConfig->bufferSize;
+    uint32                        coreId    = IfxCpu_getCoreId();
+    IfxDma_Dma                    dma;
+    IfxDma_Dma_ChannelConfig      dmaCfg;
+
+    /* the DMA wraps the buffers on address boundaries */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size >= 16) && (size <= 8192) && ((size & (size - 1)) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)dmaConfig->sinBuffer & (uint32)((size * sizeof(sint16)) - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)dmaConfig->cosBuffer & (uint32)((size * sizeof(sint16)) - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)dmaConfig->timestampBuffer & (uint32)((size * sizeof(uint32)) - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, dmaConfig->sinDmaChannelId >= 2);
+
+    dmaHandle->sinBuffer              = dmaConfig->sinBuffer;
+    dmaHandle->cosBuffer              = dmaConfig->cosBuffer;
+    dmaHandle->timestampBuffer        = dmaConfig->timestampBuffer;
+    dmaHandle->timestampBufferAddress = IFXCPU_GLB_ADDR_DSPR(coreId, dmaConfig->timestampBuffer);
+    dmaHandle->bufferSize             = size;
+    dmaHandle->readIndex              = 0;
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    /* common settings: one move per request from a fixed register into a circular buffer, restarted forever */
+    dmaCfg.hardwareRequestEnabled           = TRUE;
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.sourceCircularBufferEnabled      = TRUE;
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.transferCount                    = size;
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+    /* each transfer triggers the next channel of the chain, without CPU interrupt */
+    dmaCfg.channelInterruptEnabled          = TRUE;
+    dmaCfg.channelInterruptControl          = IfxDma_ChannelInterruptControl_transferCountDecremented;
+    dmaCfg.channelInterruptPriority         = 0;
+
+    /* SIN result, requested by the DSADC SIN channel */
+    dmaCfg.channelId                       = dmaConfig->sinDmaChannelId;
+    dmaCfg.requestSource                   = IfxDma_ChannelRequestSource_peripheral;
+    dmaCfg.sourceAddress                   = (uint32)&dsadc->CH[handle->hardware.inputSin.channelId].RESM.U;
+    dmaCfg.destinationAddress              = IFXCPU_GLB_ADDR_DSPR(coreId, dmaConfig->sinBuffer);
+    dmaCfg.destinationAddressCircularRange = IfxDma_getCircularRangeCode((uint16)(size * sizeof(sint16)));
+    dmaCfg.moveSize                        = IfxDma_ChannelMoveSize_16bit;
+    IfxDma_Dma_initChannel(&dmaHandle->sinChannel, &dmaCfg);
+
+    /* COS result, requested by the SIN channel */
+    dmaCfg.channelId                       = (IfxDma_ChannelId)(dmaConfig->sinDmaChannelId - 1);
+    dmaCfg.requestSource                   = IfxDma_ChannelRequestSource_daisyChain;
+    dmaCfg.sourceAddress                   = (uint32)&dsadc->CH[handle->hardware.inputCos.channelId].RESM.U;
+    dmaCfg.destinationAddress              = IFXCPU_GLB_ADDR_DSPR(coreId, dmaConfig->cosBuffer);
+    IfxDma_Dma_initChannel(&dmaHandle->cosChannel, &dmaCfg);
+
+    /* Timestamp of the DSADC result, requested by the COS channel */
+    dmaCfg.channelId                       = (IfxDma_ChannelId)(dmaConfig->sinDmaChannelId - 2);
+    dmaCfg.sourceAddress                   = (uint32)&handle->hardware.rdcTimCh->GPR0.U;
+    dmaCfg.destinationAddress              = dmaHandle->timestampBufferAddress;
+    dmaCfg.destinationAddressCircularRange = IfxDma_getCircularRangeCode((uint16)(size * sizeof(uint32)));
+    dmaCfg.moveSize                        = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.channelInterruptEnabled         = FALSE;
+    IfxDma_Dma_initChannel(&dmaHandle->timestampChannel, &dmaCfg);
+
+    /* route the DSADC SIN result service request to the DMA */
+    {
+        volatile Ifx_SRC_SRCR *srcr = &MODULE_SRC.DSADC.DSADC[handle->hardware.inputSin.channelId].SRM;
+        IfxSrc_init(srcr, IfxSrc_Tos_dma, (Ifx_Priority)dmaConfig->sinDmaChannelId);
+        IfxSrc_enable(srcr);
+    }
+}
+
+
+/** Step the tracking observer with the samples moved by the DMA since the previous call */
+static void IfxDsadc_Rdc_processDma(IfxDsadc_Rdc *handle)
+{
+    IfxDsadc_Rdc_Dma *dma   = &handle->dma;
+    uint32            mask  = (uint32)dma->bufferSize - 1;
+    uint32            read  = dma->readIndex;
+    /* the timestamp channel is the last of the chain: the results of all its samples are available */
+    uint32            write = ((IfxDma_getChannelDestinationAddress(dma->timestampChannel.dma, dma->timestampChannel.channelId)
+                                - dma->timestampBufferAddress) / sizeof(uint32)) & mask;
+    uint32            pending = (write - read) & mask;
+
+    if (pending != 0)
+    {
+        uint32 last = (write - 1) & mask;
+
+        while (pending != 0)
+        {
+            uint32 length = __minu(pending, dma->bufferSize - read);
+            Ifx_AngleTrkF32_stepBlock(&handle->angleTrk, &dma->sinBuffer[read], &dma->cosBuffer[read], NULL_PTR, (sint32)length);
+            read     = (read + length) & mask;
+            pending -= length;
+        }
+
+        handle->sinIn         = dma->sinBuffer[last];
+        handle->cosIn         = dma->cosBuffer[last];
+        handle->timestamp.rdc = dma->timestampBuffer[last] & 0x00FFFFFFU; /* GPR0 bit field */
+        dma->readIndex        = (uint16)write;
+    }
+}
+
+
 #else
+static void IfxDsadc_Rdc_initDma(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *config)
+{
+    (void)handle;
+    (void)config;
+}
+
+
+static void IfxDsadc_Rdc_processDma(IfxDsadc_Rdc *handle)
+{
+    (void)handle;
+}
+
+
 float32 IfxDsadc_Rdc_calculateGroupDelay(IfxDsadc_Rdc *handle);
 float32 IfxDsadc_Rdc_calculateTimestampPeriod(const IfxDsadc_Rdc_Config *config);
 float32 IfxDsadc_Rdc_getUpdatePeriod(IfxDsadc_Rdc *handle);
@@ -187,7 +308,11 @@ boolean IfxDsadc_Rdc_initHwChannels(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Con
 			};
             IfxDsadc_Dsadc_initChannel(&hwHandle->inputSin, &channelConfig);
 
-            if (configHw->servReqPriority != 0)
+            if (configHw->dma.useDma != FALSE)
+            {
+                /* the service request is routed to the DMA by IfxDsadc_Rdc_initDma() */
+            }
+            else if (configHw->servReqPriority != 0)
             {
                 IfxDsadc_ChannelId ch = channelConfig.channelId;
                 volatile Ifx_SRC_SRCR *srcr = &MODULE_SRC.DSADC.DSADC[ch].SRM;
@@ -245,6 +370,14 @@ boolean IfxDsadc_Rdc_init(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *confi
     /* Initialise the GTM timestamp hardware resources */
     IfxDsadc_Rdc_initHwTimestamp(handle, config);
 
+    /* Initialise the DMA transfers of the results and timestamps */
+    handle->dma.useDma = config->hardware.dma.useDma;
+
+    if (handle->dma.useDma != FALSE)
+    {
+        IfxDsadc_Rdc_initDma(handle, config);
+    }
+
     /* Initialise the software resources */
     {
         handle->updatePeriod          = IfxDsadc_Rdc_getUpdatePeriod(handle);
@@ -272,11 +405,14 @@ boolean IfxDsadc_Rdc_init(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *confi
         atoConfig.kd                = config->kd;
         atoConfig.resolution        = config->resolution;
 
-#if IFX_CFG_DSADC_RDC_PRE_OBSERVER_CORRECTION
-        Ifx_AngleTrkF32_init(&(handle->angleTrk), &atoConfig, config->userTs);
-#else
-        Ifx_AngleTrkF32_init(&(handle->angleTrk), &atoConfig, handle->updatePeriod);
-#endif
+        if ((IFX_CFG_DSADC_RDC_PRE_OBSERVER_CORRECTION != 0) && (handle->dma.useDma == FALSE))
+        {
+            Ifx_AngleTrkF32_init(&(handle->angleTrk), &atoConfig, config->userTs);
+        }
+        else
+        {   /* the observer is stepped with each DSADC result */
+            Ifx_AngleTrkF32_init(&(handle->angleTrk), &atoConfig, handle->updatePeriod);
+        }
     }
 
     /* Optional calibration init */
@@ -285,7 +421,7 @@ boolean IfxDsadc_Rdc_init(IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *confi
     return result;
 }
 
-void IfxDsadc_Rdc_iniConfig(IfxDsadc_Rdc_Config *config)
+void IfxDsadc_Rdc_initConfig(IfxDsadc_Rdc_Config *config)
 {
     config->kp = 0; /* Force to used default from Ifx_AngleTrkF32 */
     config->ki = 0;
@@ -314,15 +450,27 @@ void IfxDsadc_Rdc_iniConfig(IfxDsadc_Rdc_Config *config)
     config->hardware.servReqPriority = 0;
     config->hardware.servReqProvider = IfxSrc_Tos_cpu0;
     config->hardware.startScan = FALSE;
+    config->hardware.dma.useDma = FALSE;
+    config->hardware.dma.sinDmaChannelId = IfxDma_ChannelId_none;
+    config->hardware.dma.sinBuffer = NULL_PTR;
+    config->hardware.dma.cosBuffer = NULL_PTR;
+    config->hardware.dma.timestampBuffer = NULL_PTR;
+    config->hardware.dma.bufferSize = 0;
 
 }
 
 
 /** Function to be executed on DSADC channel interrupt.
+ * Not used if the results are moved by DMA.
  * \param handle Driver's handle, i.e. pointer to \ref IfxDsadc_Rdc RAM location
  */
 void IfxDsadc_Rdc_onEventA(IfxDsadc_Rdc *handle)
 {
+    if (handle->dma.useDma != FALSE)
+    {
+        return;
+    }
+
 #if IFXDSADC_HW_INIT
     handle->timestamp.rdc = handle->hardware.rdcTimCh->GPR0.B.GPR0;
 
@@ -348,6 +496,7 @@ void IfxDsadc_Rdc_onEventA(IfxDsadc_Rdc *handle)
 
 /** Function to be executed at user's application interrupt or task, e.g. motor control
  * task.
+ * If the results are moved by DMA, all the samples received since the previous call are processed.
  * \param handle Driver's handle, i.e. pointer to \ref IfxDsadc_Rdc RAM location
  * */
 void IfxDsadc_Rdc_update(IfxDsadc_Rdc *handle)
@@ -357,6 +506,12 @@ void IfxDsadc_Rdc_update(IfxDsadc_Rdc *handle)
     float32 angleOut;
     float32 speedEst;
     float32 angleCorrection;
+    boolean preObserverCorrection = (IFX_CFG_DSADC_RDC_PRE_OBSERVER_CORRECTION != 0) && (handle->dma.useDma == FALSE);
+
+    if (handle->dma.useDma != FALSE)
+    {
+        IfxDsadc_Rdc_processDma(handle);
+    }
 
     /* previous estimated speed */
     speedEst = Ifx_AngleTrkF32_getLoopSpeed(&(handle->angleTrk));
@@ -378,24 +533,24 @@ void IfxDsadc_Rdc_update(IfxDsadc_Rdc *handle)
     /* angle correction value */
     angleCorrection = groupDelayAngle + timeStampAngle;
 
-#if IFX_CFG_DSADC_RDC_PRE_OBSERVER_CORRECTION != 0
-    /*
-    handle->sinIn = (sint16)handle->hardware.inputSin.channel->TSTMP.B.RESULT;
-    handle->cosIn = (sint16)handle->hardware.inputCos.channel->TSTMP.B.RESULT;
-    */
-
+    if (preObserverCorrection != FALSE)
     {
+        /*
+        handle->sinIn = (sint16)handle->hardware.inputSin.channel->TSTMP.B.RESULT;
+        handle->cosIn = (sint16)handle->hardware.inputCos.channel->TSTMP.B.RESULT;
+        */
         sint16 sinIn = handle->sinIn;
         sint16 cosIn = handle->cosIn;
 
         /* tracking observer (note: atan2 lookup function is available inside) */
         Ifx_AngleTrkF32_step(&(handle->angleTrk), sinIn, cosIn, angleCorrection);
         Ifx_AngleTrkF32_updateStatus(&(handle->angleTrk), sinIn, cosIn);
+        angleOut = handle->angleTrk.angleEst;
+    }
+    else
+    {
+        angleOut = handle->angleTrk.angleEst + angleCorrection;
     }
-    angleOut = handle->angleTrk.angleEst;
-#else
-    angleOut = handle->angleTrk.angleEst + angleCorrection;
-#endif
 
     /* final output estimation */
     {
@@ -50,6 +50,7 @@
 #include "Dsadc/Dsadc/IfxDsadc_Dsadc.h"
 
 #include "Gtm/Std/IfxGtm_Tim.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 #include "_PinMap/IfxGtm_PinMap.h"
 #include "Ifx_Cfg.h"
 
@@ -86,6 +87,17 @@ typedef struct
     Ifx_GTM_TIM_CH        *rdcTimCh;    /**< \brief TIM channel for DSADC timestamp */
 } IfxDsadc_Rdc_Hw;
 
+/** DSADC RDC DMA configuration, see \ref IfxLld_Dsadc_rdc_dma */
+typedef struct
+{
+    boolean           useDma;           /**< \brief TRUE: the results and timestamps are moved by DMA into the buffers, FALSE: IfxDsadc_Rdc_onEventA() is called by the DSADC interrupt */
+    IfxDma_ChannelId  sinDmaChannelId;  /**< \brief DMA channel requested by the SIN channel result. The channels sinDmaChannelId - 1 (COS result) and sinDmaChannelId - 2 (timestamp) are daisy chained */
+    sint16           *sinBuffer;        /**< \brief SIN results, bufferSize samples, aligned on bufferSize * 2 */
+    sint16           *cosBuffer;        /**< \brief COS results, bufferSize samples, aligned on bufferSize * 2 */
+    uint32           *timestampBuffer;  /**< \brief TIM GPR0 timestamps, bufferSize samples, aligned on bufferSize * 4 */
+    uint16            bufferSize;       /**< \brief Number of samples of each buffer, a power of 2 from 16 to 8192 */
+} IfxDsadc_Rdc_DmaConfig;
+
 /** DSADC RDC hardware configuration */
 typedef struct
 {
@@ -106,6 +118,7 @@ typedef struct
 
     IfxDsadc_Cout_Out      *outputClock;    /**< \brief if not NULL_PTR, modulator clock output pin from inputSin channel will be configured */
     IfxDsadc_GtmTimestamp   gtmTimestamp;   /**< \brief Timestamp helper using GTM */
+    IfxDsadc_Rdc_DmaConfig  dma;            /**< \brief DMA transfer of the results and timestamps */
 } IfxDsadc_Rdc_ConfigHw;
 
 typedef struct
@@ -123,6 +136,21 @@ typedef struct
     float32       clockPeriod;        /**< \brief Period of absolute time clock (in second) */
 } IfxDsadc_Rdc_Ts;
 
+/** DSADC RDC DMA data structure */
+typedef struct
+{
+    boolean            useDma;                  /**< \brief TRUE: the results and timestamps are moved by DMA */
+    IfxDma_Dma_Channel sinChannel;              /**< \brief DMA channel moving the SIN results */
+    IfxDma_Dma_Channel cosChannel;              /**< \brief DMA channel moving the COS results */
+    IfxDma_Dma_Channel timestampChannel;        /**< \brief DMA channel moving the timestamps, last of the chain */
+    sint16            *sinBuffer;               /**< \brief SIN results */
+    sint16            *cosBuffer;               /**< \brief COS results */
+    uint32            *timestampBuffer;         /**< \brief TIM GPR0 timestamps */
+    uint32             timestampBufferAddress;  /**< \brief Global address of timestampBuffer, as seen by the DMA */
+    uint16             bufferSize;              /**< \brief Number of samples of each buffer */
+    uint16             readIndex;               /**< \brief Index of the first sample not yet processed */
+} IfxDsadc_Rdc_Dma;
+
 /** DSADC RDC data structure */
 typedef struct
 {
@@ -133,6 +161,7 @@ typedef struct
     float32         groupDelay;
     IfxDsadc_Rdc_Hw hardware;
     IfxDsadc_Rdc_Ts timestamp;
+    IfxDsadc_Rdc_Dma dma;
 } IfxDsadc_Rdc;
 
 /** DSADC RDC configuration structure
@@ -179,6 +208,28 @@ typedef struct
  * or interrupt context for updating the final outputs (position and speed),
  * (e.g. running inside motor PWM interrupt context)
  *
+ * \anchor IfxLld_Dsadc_rdc_dma
+ * Alternatively, the results are moved by DMA and no DSADC interrupt is required: each SIN result requests a DMA
+ * channel which moves it into a ring buffer, and triggers through the DMA daisy chain the moves of the COS result and
+ * of the TIM GPR0 timestamp into their own ring buffers. IfxDsadc_Rdc_update() steps the tracking observer with all
+ * the samples received since the previous call (see Ifx_AngleTrkF32_stepBlock()), then applies the group delay
+ * and timestamp corrections of the last sample to the output, as with IFX_CFG_DSADC_RDC_PRE_OBSERVER_CORRECTION = 0.
+ * IfxDsadc_Rdc_update() must be called at least once per bufferSize DSADC results.
+ * The buffers must be in the DSPR of the CPU executing IfxDsadc_Rdc_init() and aligned on their size:
+ * \code
+ * #define RDC_DMA_BUFFER_SIZE 64
+ * static sint16 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 2))) rdcSin[RDC_DMA_BUFFER_SIZE];
+ * static sint16 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 2))) rdcCos[RDC_DMA_BUFFER_SIZE];
+ * static uint32 __attribute__ ((aligned(RDC_DMA_BUFFER_SIZE * 4))) rdcTimestamp[RDC_DMA_BUFFER_SIZE];
+ *
+ *     rdcConfig.hardware.dma.useDma          = TRUE;
+ *     rdcConfig.hardware.dma.sinDmaChannelId = IfxDma_ChannelId_12; // COS: channel 11, timestamp: channel 10
+ *     rdcConfig.hardware.dma.sinBuffer       = rdcSin;
+ *     rdcConfig.hardware.dma.cosBuffer       = rdcCos;
+ *     rdcConfig.hardware.dma.timestampBuffer = rdcTimestamp;
+ *     rdcConfig.hardware.dma.bufferSize      = RDC_DMA_BUFFER_SIZE;
+ * \endcode
+ *
  * Prototypes:
  * \{ */
 IFX_EXTERN boolean   IfxDsadc_Rdc_init              (IfxDsadc_Rdc *handle, const IfxDsadc_Rdc_Config *config);
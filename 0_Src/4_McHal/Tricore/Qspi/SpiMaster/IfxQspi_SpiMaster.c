@@ -68,6 +68,12 @@ static void IfxQspi_SpiMaster_autoSlso(IfxQspi_SpiMaster_Channel *chHandle);
  */
 static void IfxQspi_SpiMaster_deactivateSlso(IfxQspi_SpiMaster_Channel *chHandle);
 
+/** \brief Ends the transfer of the active channel, then starts the next queued job or unlocks the transfers.
+ * \param chHandle Module Channel handle
+ * \return None
+ */
+static void IfxQspi_SpiMaster_endTransfer(IfxQspi_SpiMaster_Channel *chHandle);
+
 /** \brief Locks the transfer and gets the current status of it.
  * \param handle Module handle
  * \return SpiIf_Status_ok if sending is done otherwise SpiIf_Status_busy.
@@ -80,6 +86,25 @@ static SpiIf_Status IfxQspi_SpiMaster_lock(IfxQspi_SpiMaster *handle);
  */
 static void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle);
 
+/** \brief Starts the DMA channels configured for a transfer: clears the FIFOs and the pending requests, enables the
+ * DMA channels and writes the BACON. The DMA moves all data but the last one, which is written with the end-of-stream
+ * BACON; a single data is written here. Interrupts must be disabled or the transfers locked.
+ * \param chHandle Module Channel handle
+ * \param src Source of data, NULL_PTR: all-1 are sent
+ * \param count Number of data
+ * \return None
+ */
+static void IfxQspi_SpiMaster_startDma(IfxQspi_SpiMaster_Channel *chHandle, const void *src, Ifx_SizeT count);
+
+/** \brief Starts a transfer. The transfers must be locked.
+ * \param chHandle Module Channel handle
+ * \param src Source of data
+ * \param dest Destination of data
+ * \param count Number of data
+ * \return None
+ */
+static void IfxQspi_SpiMaster_startTransfer(IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count);
+
 /** \brief Unlocks the transfers
  * \param handle Module handle
  * \return None
@@ -138,6 +163,97 @@ static void IfxQspi_SpiMaster_deactivateSlso(IfxQspi_SpiMaster_Channel *chHandle
 }
 
 
+static void IfxQspi_SpiMaster_endTransfer(IfxQspi_SpiMaster_Channel *chHandle)
+{
+    IfxQspi_SpiMaster          *handle = (IfxQspi_SpiMaster *)chHandle->base.driver;
+    IfxQspi_SpiMaster_JobQueue *queue  = &handle->jobs;
+    IfxQspi_SpiMaster_Job      *job    = queue->current;
+
+    if (chHandle->deactivateSlso != NULL_PTR)
+    {
+        chHandle->deactivateSlso(chHandle);
+    }
+
+    chHandle->base.flags.onTransfer = 0;
+
+    /* chain the next job without releasing the lock */
+    queue->current = queue->head;
+
+    if (queue->head != NULL_PTR)
+    {
+        IfxQspi_SpiMaster_Job *next = queue->head;
+        queue->head = next->next;
+        IfxQspi_SpiMaster_startTransfer(next->channel, next->src, next->dest, next->count);
+    }
+    else
+    {
+        IfxQspi_SpiMaster_unlock(handle);
+    }
+
+    if (job != NULL_PTR)
+    {
+        job->done = TRUE;
+
+        if (job->onEnd != NULL_PTR)
+        {
+            job->onEnd(job->callbackData);
+        }
+    }
+}
+
+
+boolean IfxQspi_SpiMaster_enqueue(IfxQspi_SpiMaster *handle, IfxQspi_SpiMaster_Job *jobs, Ifx_SizeT count)
+{
+    IfxQspi_SpiMaster_JobQueue *queue  = &handle->jobs;
+    boolean                     result = count > 0;
+    Ifx_SizeT                   i;
+
+    /* a job without data would never get its receive interrupt, and would stall the queue */
+    for (i = 0; result && (i < count); i++)
+    {
+        result = (jobs[i].channel != NULL_PTR) && (jobs[i].count >= 1);
+    }
+
+    if (result)
+    {
+        for (i = 0; i < count; i++)
+        {
+            jobs[i].done = FALSE;
+            jobs[i].next = &jobs[i + 1];
+        }
+
+        jobs[count - 1].next = NULL_PTR;
+
+        /* the queue is shared with the receive interrupt */
+        boolean interruptState = IfxCpu_disableInterrupts();
+
+        if (queue->head == NULL_PTR)
+        {
+            queue->head = jobs;
+        }
+        else
+        {
+            queue->tail->next = jobs;
+        }
+
+        queue->tail = &jobs[count - 1];
+
+        /* else the transfer on going starts the job at its end */
+        if (IfxQspi_SpiMaster_lock(handle) == SpiIf_Status_ok)
+        {
+            IfxQspi_SpiMaster_Job *job = queue->head;
+            queue->head    = job->next;
+            queue->current = job;
+            IfxQspi_SpiMaster_startTransfer(job->channel, job->src, job->dest, job->count);
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    return result;
+}
+
+
 SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count)
 {
     IfxQspi_SpiMaster *handle = (IfxQspi_SpiMaster *)chHandle->base.driver;
@@ -146,20 +262,20 @@ SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *chHandle, con
     if (status == SpiIf_Status_ok)
     {
         /* initiate transfer when resource is free */
-        handle->base.activeChannel      = &chHandle->base;
-        chHandle->base.flags.onTransfer = 1;
-        chHandle->base.tx.data          = (void *)src;
-        chHandle->base.tx.remaining     = count;
-        chHandle->firstWrite            = TRUE;
-        chHandle->base.rx.data          = dest;
-        chHandle->base.rx.remaining     = count;
+        IfxQspi_SpiMaster_startTransfer(chHandle, src, dest, count);
+    }
 
-        if (chHandle->activateSlso != NULL_PTR)
-        {
-            chHandle->activateSlso(chHandle);
-        }
+    return status;
+}
 
-        chHandle->base.txHandler(handle->base.activeChannel);
+
+SpiIf_Status IfxQspi_SpiMaster_getQueueStatus(IfxQspi_SpiMaster *handle)
+{
+    SpiIf_Status status = SpiIf_Status_ok;
+
+    if ((handle->jobs.current != NULL_PTR) || (handle->jobs.head != NULL_PTR))
+    {
+        status = SpiIf_Status_busy;
     }
 
     return status;
@@ -334,6 +450,9 @@ void IfxQspi_SpiMaster_initModule(IfxQspi_SpiMaster *handle, const IfxQspi_SpiMa
     handle->base.driver              = handle;
     handle->base.sending             = 0U;
     handle->base.activeChannel       = NULL_PTR;
+    handle->jobs.current             = NULL_PTR;
+    handle->jobs.head                = NULL_PTR;
+    handle->jobs.tail                = NULL_PTR;
 
     handle->base.functions.exchange  = (SpiIf_Exchange) & IfxQspi_SpiMaster_exchange;
     handle->base.functions.getStatus = (SpiIf_GetStatus) & IfxQspi_SpiMaster_getStatus;
@@ -481,13 +600,7 @@ void IfxQspi_SpiMaster_isrDmaReceive(IfxQspi_SpiMaster *qspiHandle)
 
     if (IfxDma_getAndClearChannelInterrupt(dmaSFR, rxDmaChannelId))
     {
-        if (chHandle->deactivateSlso != NULL_PTR)
-        {
-            chHandle->deactivateSlso(chHandle);
-        }
-
-        chHandle->base.flags.onTransfer = 0;
-        IfxQspi_SpiMaster_unlock((IfxQspi_SpiMaster *)chHandle->base.driver);
+        IfxQspi_SpiMaster_endTransfer(chHandle);
     }
 
     IfxDma_getAndClearChannelPatternDetectionInterrupt(dmaSFR, rxDmaChannelId);
@@ -570,6 +683,99 @@ static SpiIf_Status IfxQspi_SpiMaster_lock(IfxQspi_SpiMaster *handle)
 }
 
 
+boolean IfxQspi_SpiMaster_prepareTransfer(IfxQspi_SpiMaster_PreparedTransfer *prepared, IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count)
+{
+    IfxQspi_SpiMaster       *handle = (IfxQspi_SpiMaster *)chHandle->base.driver;
+    IfxCpu_ResourceCpu       cpu    = IfxCpu_getCoreId();
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+    IfxDma_ChannelMoveSize   moveSize;
+
+    if ((handle->dma.useDma == FALSE) || (count < 1) || (count > IFXDMA_DMA_COPY_MAX_TRANSFER_COUNT))
+    {
+        return FALSE;
+    }
+
+    prepared->channel = chHandle;
+    prepared->src     = src;
+    prepared->dest    = dest;
+    prepared->count   = count;
+
+    if (chHandle->dataWidth <= 8)
+    {
+        moveSize = IfxDma_ChannelMoveSize_8bit;
+    }
+    else if (chHandle->dataWidth <= 16)
+    {
+        moveSize = IfxDma_ChannelMoveSize_16bit;
+    }
+    else
+    {
+        moveSize = IfxDma_ChannelMoveSize_32bit;
+    }
+
+    /* same transfer settings as IfxQspi_SpiMaster_write() */
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+    dmaCfg.requestMode             = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode           = IfxDma_ChannelOperationMode_single;
+    dmaCfg.blockMode               = IfxDma_ChannelMove_1;
+    dmaCfg.moveSize                = moveSize;
+    dmaCfg.channelInterruptEnabled = TRUE;
+
+    {   /* transmit: all data but the last one, which is written with the end-of-stream BACON */
+        dmaCfg.channelId     = handle->dma.txDmaChannelId;
+        dmaCfg.transferCount = (uint16)(count - 1);
+
+        if (src == NULL_PTR)
+        {
+            dmaCfg.sourceAddress               = IFXCPU_GLB_ADDR_DSPR(cpu, &IfxQspi_SpiMaster_dummyTxValue);
+            dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_4;
+            dmaCfg.sourceCircularBufferEnabled = TRUE;
+        }
+        else
+        {
+            dmaCfg.sourceAddress               = IFXCPU_GLB_ADDR_DSPR(cpu, src);
+            dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+            dmaCfg.sourceCircularBufferEnabled = FALSE;
+        }
+
+        /* unused: the tx destination is not copied by IfxQspi_SpiMaster_startPreparedTransfer(), the one configured
+         * by the driver is kept, as by IfxQspi_SpiMaster_write() */
+        dmaCfg.destinationAddress               = (uint32)&handle->qspi->DATAENTRY[0].U;
+        dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.destinationCircularBufferEnabled = TRUE;
+
+        IfxDma_Dma_initLinkedListEntry((void *)&prepared->txSet, &dmaCfg);
+    }
+
+    {   /* receive: all data */
+        dmaCfg.channelId                   = handle->dma.rxDmaChannelId;
+        dmaCfg.transferCount               = (uint16)count;
+        dmaCfg.sourceAddress               = (uint32)&handle->qspi->RXEXIT.U;
+        dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.sourceCircularBufferEnabled = TRUE;
+
+        if (dest == NULL_PTR)
+        {
+            dmaCfg.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(cpu, &IfxQspi_SpiMaster_dummyRxValue);
+            dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_4;
+            dmaCfg.destinationCircularBufferEnabled = TRUE;
+        }
+        else
+        {
+            dmaCfg.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(cpu, dest);
+            dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+            dmaCfg.destinationCircularBufferEnabled = FALSE;
+        }
+
+        IfxDma_Dma_initLinkedListEntry((void *)&prepared->rxSet, &dmaCfg);
+    }
+
+    return TRUE;
+}
+
+
 static void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle)
 {
     IfxQspi_SpiMaster *handle  = chHandle->base.driver->driver;
@@ -612,14 +818,131 @@ static void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle)
 
     if (job->remaining == 0)
     {
-        if (chHandle->deactivateSlso != NULL_PTR)
+        IfxQspi_SpiMaster_endTransfer(chHandle);
+    }
+}
+
+
+SpiIf_Status IfxQspi_SpiMaster_startPreparedTransfer(IfxQspi_SpiMaster_PreparedTransfer *prepared)
+{
+    IfxQspi_SpiMaster_Channel *chHandle = prepared->channel;
+    IfxQspi_SpiMaster         *handle   = (IfxQspi_SpiMaster *)chHandle->base.driver;
+    SpiIf_Status               status   = IfxQspi_SpiMaster_lock(handle);
+
+    if (status == SpiIf_Status_ok)
+    {
+        Ifx_DMA         *dmaSFR         = &MODULE_DMA;
+        IfxDma_ChannelId txDmaChannelId = handle->dma.txDmaChannelId;
+        IfxDma_ChannelId rxDmaChannelId = handle->dma.rxDmaChannelId;
+        Ifx_DMA_CH      *txSFR          = &dmaSFR->CH[txDmaChannelId];
+        Ifx_DMA_CH      *rxSFR          = &dmaSFR->CH[rxDmaChannelId];
+        Ifx_SizeT        count          = prepared->count;
+
+        handle->base.activeChannel      = &chHandle->base;
+        chHandle->base.flags.onTransfer = 1;
+        chHandle->base.tx.data          = (void *)prepared->src;
+        chHandle->base.tx.remaining     = count;
+        chHandle->base.rx.data          = prepared->dest;
+        chHandle->base.rx.remaining     = count;
+
+        if (chHandle->activateSlso != NULL_PTR)
         {
-            chHandle->deactivateSlso(chHandle);
+            chHandle->activateSlso(chHandle);
+        }
+
+        /* the DMA channels are idle while the transfers are locked, the sets are copied without interrupt lock.
+         * The addresses configured by the driver initialisation (tx destination, rx source) are not copied */
+        rxSFR->CHCFGR.U = prepared->rxSet.CHCFGR.U;
+        rxSFR->ADICR.U  = prepared->rxSet.ADICR.U;
+        rxSFR->DADR.U   = prepared->rxSet.DADR.U;
+
+        if (count > 1)
+        {
+            txSFR->CHCFGR.U = prepared->txSet.CHCFGR.U;
+            txSFR->ADICR.U  = prepared->txSet.ADICR.U;
+            txSFR->SADR.U   = prepared->txSet.SADR.U;
         }
 
-        chHandle->base.flags.onTransfer = 0;
-        IfxQspi_SpiMaster_unlock((IfxQspi_SpiMaster *)chHandle->base.driver);
+        IfxQspi_SpiMaster_startDma(chHandle, prepared->src, count);
     }
+
+    return status;
+}
+
+
+static void IfxQspi_SpiMaster_startDma(IfxQspi_SpiMaster_Channel *chHandle, const void *src, Ifx_SizeT count)
+{
+    IfxQspi_SpiMaster *handle         = chHandle->base.driver->driver;
+    Ifx_DMA           *dmaSFR         = &MODULE_DMA;
+    Ifx_QSPI          *qspiSFR        = handle->qspi;
+    IfxDma_ChannelId   txDmaChannelId = handle->dma.txDmaChannelId;
+    IfxDma_ChannelId   rxDmaChannelId = handle->dma.rxDmaChannelId;
+
+    IfxQspi_flushTransmitFifo(qspiSFR);
+    IfxQspi_flushReceiveFifo(qspiSFR);
+    IfxQspi_clearAllEventFlags(qspiSFR);
+    IfxSrc_clearRequest(IfxQspi_getTransmitSrc(qspiSFR));
+    IfxSrc_clearRequest(IfxQspi_getReceiveSrc(qspiSFR));
+    IfxSrc_clearRequest(IfxQspi_getErrorSrc(qspiSFR));
+    IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
+    IfxDma_enableChannelTransaction(dmaSFR, rxDmaChannelId);
+
+    if (count > 1)
+    {
+        IfxDma_clearChannelInterrupt(dmaSFR, txDmaChannelId);
+        IfxDma_enableChannelTransaction(dmaSFR, txDmaChannelId);
+
+        if (chHandle->channelBasedCs == IfxQspi_SpiMaster_ChannelBasedCs_disabled)
+        {
+            IfxQspi_writeBasicConfigurationBeginStream(qspiSFR, chHandle->bacon.U);
+        }
+        else
+        {
+            IfxQspi_writeBasicConfigurationEndStream(qspiSFR, chHandle->bacon.U);
+        }
+    }
+    else
+    {
+        IfxQspi_writeBasicConfigurationEndStream(qspiSFR, chHandle->bacon.U);
+
+        if (src == NULL_PTR)
+        {
+            IfxQspi_writeTransmitFifo(qspiSFR, ~0);
+        }
+        else if (chHandle->dataWidth <= 8)
+        {
+            IfxQspi_writeTransmitFifo(qspiSFR, ((const uint8 *)src)[count - 1]);
+        }
+        else if (chHandle->dataWidth <= 16)
+        {
+            IfxQspi_writeTransmitFifo(qspiSFR, ((const uint16 *)src)[count - 1]);
+        }
+        else
+        {
+            IfxQspi_writeTransmitFifo(qspiSFR, ((const uint32 *)src)[count - 1]);
+        }
+    }
+}
+
+
+static void IfxQspi_SpiMaster_startTransfer(IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count)
+{
+    IfxQspi_SpiMaster *handle = (IfxQspi_SpiMaster *)chHandle->base.driver;
+
+    handle->base.activeChannel      = &chHandle->base;
+    chHandle->base.flags.onTransfer = 1;
+    chHandle->base.tx.data          = (void *)src;
+    chHandle->base.tx.remaining     = count;
+    chHandle->firstWrite            = TRUE;
+    chHandle->base.rx.data          = dest;
+    chHandle->base.rx.remaining     = count;
+
+    if (chHandle->activateSlso != NULL_PTR)
+    {
+        chHandle->activateSlso(chHandle);
+    }
+
+    chHandle->base.txHandler(handle->base.activeChannel);
 }
 
 
@@ -636,15 +959,12 @@ static void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
 
     if (handle->dma.useDma)
     {
-        Ifx_DMA               *dmaSFR         = &MODULE_DMA;
+        Ifx_DMA         *dmaSFR         = &MODULE_DMA;
 
-        Ifx_QSPI              *qspiSFR        = handle->qspi;
-        volatile Ifx_SRC_SRCR *src            = IfxQspi_getTransmitSrc(qspiSFR);
+        IfxDma_ChannelId txDmaChannelId = handle->dma.txDmaChannelId;
+        IfxDma_ChannelId rxDmaChannelId = handle->dma.rxDmaChannelId;
 
-        IfxDma_ChannelId       txDmaChannelId = handle->dma.txDmaChannelId;
-        IfxDma_ChannelId       rxDmaChannelId = handle->dma.rxDmaChannelId;
-
-        boolean                interruptState = IfxCpu_disableInterrupts();
+        boolean          interruptState = IfxCpu_disableInterrupts();
 
         if (job->remaining > 1)
         {
@@ -720,58 +1040,7 @@ static void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
             dmaSFR->CH[rxDmaChannelId].ADICR.B.DCBE = FALSE;
         }
 
-        IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
-        IfxQspi_flushTransmitFifo(qspiSFR);
-        IfxQspi_flushReceiveFifo(qspiSFR);
-        IfxQspi_clearAllEventFlags(qspiSFR);
-        src = IfxQspi_getTransmitSrc(qspiSFR);
-        IfxSrc_clearRequest(src);
-        src = IfxQspi_getReceiveSrc(qspiSFR);
-        IfxSrc_clearRequest(src);
-        src = IfxQspi_getErrorSrc(qspiSFR);
-        IfxSrc_clearRequest(src);
-        IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
-        IfxDma_enableChannelTransaction(dmaSFR, rxDmaChannelId);
-
-        if (job->remaining > 1)
-        {
-            IfxDma_clearChannelInterrupt(dmaSFR, txDmaChannelId);
-            IfxDma_enableChannelTransaction(dmaSFR, txDmaChannelId);
-
-            if (chHandle->channelBasedCs == IfxQspi_SpiMaster_ChannelBasedCs_disabled)
-            {
-                IfxQspi_writeBasicConfigurationBeginStream(qspiSFR, chHandle->bacon.U);
-            }
-            else
-            {
-                IfxQspi_writeBasicConfigurationEndStream(qspiSFR, chHandle->bacon.U);
-            }
-        }
-        else
-        {
-            if (job->data == NULL_PTR)
-            {
-                IfxQspi_writeBasicConfigurationEndStream(qspiSFR, chHandle->bacon.U);
-                IfxQspi_writeTransmitFifo(qspiSFR, ~0);
-            }
-            else
-            {
-                IfxQspi_writeBasicConfigurationEndStream(qspiSFR, chHandle->bacon.U);
-
-                if (chHandle->dataWidth <= 8)
-                {
-                    IfxQspi_writeTransmitFifo(qspiSFR, ((uint8 *)job->data)[job->remaining - 1]);
-                }
-                else if (chHandle->dataWidth <= 16)
-                {
-                    IfxQspi_writeTransmitFifo(qspiSFR, ((uint16 *)job->data)[job->remaining - 1]);
-                }
-                else
-                {
-                    IfxQspi_writeTransmitFifo(qspiSFR, ((uint32 *)job->data)[job->remaining - 1]);
-                }
-            }
-        }
+        IfxQspi_SpiMaster_startDma(chHandle, job->data, job->remaining);
 
         IfxCpu_restoreInterrupts(interruptState);
     }
@@ -281,6 +281,49 @@
  *     IfxQspi_SpiMaster_exchange(&spiChannel, NULL_PTR, &spiRxBuffer[i], SPI_BUFFER_SIZE);
  * \endcode
  *
+ * \subsection IfxLld_Qspi_SpiMaster_JobQueue Job Queue
+ *
+ * Several transfers, e.g. to the sensors read once per control period, can be issued in one call.
+ * They are chained by the interrupts without task involvement, the CPU can compute meanwhile:
+ * \code
+ * // declared somewhere globally
+ * IfxQspi_SpiMaster_Channel spiChannelAdc, spiChannelEncoder;
+ * uint16 adcCmd[2] = { 0x8300, 0x8700 };
+ * uint16 adcResult[2];
+ * uint8  encoderResult[4];
+ * IfxQspi_SpiMaster_Job spiJobs[2];
+ *
+ * void sensorsStart(void)
+ * {
+ *     spiJobs[0].channel      = &spiChannelAdc;
+ *     spiJobs[0].src          = adcCmd;
+ *     spiJobs[0].dest         = adcResult;
+ *     spiJobs[0].count        = 2;
+ *     spiJobs[0].onEnd        = NULL_PTR;
+ *     spiJobs[1].channel      = &spiChannelEncoder;
+ *     spiJobs[1].src          = NULL_PTR;
+ *     spiJobs[1].dest         = encoderResult;
+ *     spiJobs[1].count        = 4;
+ *     spiJobs[1].onEnd        = &sensorsDone;   // called from the receive interrupt
+ *     spiJobs[1].callbackData = NULL_PTR;
+ *     IfxQspi_SpiMaster_enqueue(&spi, spiJobs, 2);
+ * }
+ * \endcode
+ *
+ * \subsection IfxLld_Qspi_SpiMaster_PreparedTransfer Prepared Transfers (with dma use)
+ *
+ * A frame sent each period from the same buffers can be prepared once, so that each start only
+ * copies the precomputed DMA transaction sets:
+ * \code
+ *     IfxQspi_SpiMaster_PreparedTransfer spiFrame; // defined globally
+ *
+ *     // initialisation
+ *     IfxQspi_SpiMaster_prepareTransfer(&spiFrame, &spiChannel, spiTxBuffer, spiRxBuffer, SPI_BUFFER_SIZE);
+ *
+ *     // each period
+ *     IfxQspi_SpiMaster_startPreparedTransfer(&spiFrame);
+ * \endcode
+ *
  * \defgroup IfxLld_Qspi_SpiMaster SPI Master Driver
  * \ingroup IfxLld_Qspi
  * \defgroup IfxLld_Qspi_SpiMaster_DataStructures Data Structures
@@ -317,6 +360,8 @@
 
 typedef struct IfxQspi_SpiMaster_Channel_s IfxQspi_SpiMaster_Channel;
 
+typedef struct IfxQspi_SpiMaster_Job_s     IfxQspi_SpiMaster_Job;
+
 typedef void                             (*IfxQspi_SpiMaster_AutoSlso)(IfxQspi_SpiMaster_Channel *chHandle);
 
 /******************************************************************************/
@@ -401,13 +446,23 @@ typedef struct
 
 /** \addtogroup IfxLld_Qspi_SpiMaster_DataStructures
  * \{ */
+/** \brief Job queue of the module
+ */
+typedef struct
+{
+    IfxQspi_SpiMaster_Job *current;     /**< \brief Job on transfer, NULL_PTR if none */
+    IfxQspi_SpiMaster_Job *head;        /**< \brief Next job to be transferred, NULL_PTR if the queue is empty */
+    IfxQspi_SpiMaster_Job *tail;        /**< \brief Last job of the queue */
+} IfxQspi_SpiMaster_JobQueue;
+
 /** \brief Module handle data structure
  */
 typedef struct
 {
-    SpiIf                 base;     /**< \brief Module SPI interface handle */
-    Ifx_QSPI             *qspi;     /**< \brief Pointer to QSPI module registers */
-    IfxQspi_SpiMaster_Dma dma;      /**< \brief dma handle */
+    SpiIf                      base;      /**< \brief Module SPI interface handle */
+    Ifx_QSPI                  *qspi;      /**< \brief Pointer to QSPI module registers */
+    IfxQspi_SpiMaster_Dma      dma;       /**< \brief dma handle */
+    IfxQspi_SpiMaster_JobQueue jobs;      /**< \brief Queued transfers, chained from the interrupts */
 } IfxQspi_SpiMaster;
 
 /** \brief Module Channel configuration structure
@@ -435,6 +490,34 @@ struct IfxQspi_SpiMaster_Channel_s
     IfxQspi_SpiMaster_ChannelBasedCs channelBasedCs;      /**< \brief define the slso behaviour */
 };
 
+/** \brief Transfer job of the module job queue
+ *
+ * The job is owned by the caller and must not be modified until it is done.
+ */
+struct IfxQspi_SpiMaster_Job_s
+{
+    IfxQspi_SpiMaster_Channel *channel;          /**< \brief Channel of the transfer, gives the chip select and the data width */
+    const void                *src;              /**< \brief Data to be sent. NULL_PTR: all-1 are sent */
+    void                      *dest;             /**< \brief Buffer for the received data. NULL_PTR: received data is discarded */
+    Ifx_SizeT                  count;            /**< \brief Number of data, at least 1 */
+    SpiIf_Cbk                  onEnd;            /**< \brief Called from the interrupt at the end of the transfer with callbackData. NULL_PTR: no callback */
+    void                      *callbackData;     /**< \brief Parameter of onEnd */
+    volatile boolean           done;             /**< \brief Set to TRUE at the end of the transfer */
+    IfxQspi_SpiMaster_Job     *next;             /**< \brief Next job of the queue, for internal use */
+};
+
+/** \brief DMA transfer prepared once by IfxQspi_SpiMaster_prepareTransfer(), then started each period
+ */
+typedef struct
+{
+    Ifx_DMA_CH                 txSet;       /**< \brief Transaction set of the transmit DMA channel */
+    Ifx_DMA_CH                 rxSet;       /**< \brief Transaction set of the receive DMA channel */
+    IfxQspi_SpiMaster_Channel *channel;     /**< \brief Channel of the transfer */
+    const void                *src;         /**< \brief Data to be sent. NULL_PTR: all-1 are sent */
+    void                      *dest;        /**< \brief Buffer for the received data. NULL_PTR: received data is discarded */
+    Ifx_SizeT                  count;       /**< \brief Number of data */
+} IfxQspi_SpiMaster_PreparedTransfer;
+
 /** \brief Module configuration structure
  */
 typedef struct
@@ -529,7 +612,34 @@ IFX_EXTERN void IfxQspi_SpiMaster_initChannelConfig(IfxQspi_SpiMaster_ChannelCon
  */
 IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count);
 
+/** \brief Appends transfer jobs to the job queue of the module
+ *
+ * The jobs are transferred in order, back-to-back: the next job is started by the receive interrupt
+ * (or the DMA receive interrupt) which ends the previous transfer. The transfer of the first job is started
+ * immediately if the module is idle, else after the transfer in progress, which may have been started by
+ * IfxQspi_SpiMaster_exchange(). While the queue is not empty, IfxQspi_SpiMaster_exchange() returns SpiIf_Status_busy.
+ *
+ * The callback of a job is called after the next job is started, it may enqueue new jobs.
+ *
+ * The queue is protected from the receive interrupts by disabling the interrupts of the calling CPU only:
+ * IfxQspi_SpiMaster_enqueue() must be called on the CPU which services the QSPI and DMA interrupts of the module
+ * (from a task or from a callback).
+ * \param handle Module handle
+ * \param jobs Array of jobs, each one with channel, src, dest, count, onEnd and callbackData set
+ * \param count Number of jobs
+ * \return TRUE if the jobs are queued. FALSE if count is 0, or a job has no channel or a count of 0:
+ * none of the jobs is queued
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiMaster_JobQueue
+ *
+ */
+IFX_EXTERN boolean IfxQspi_SpiMaster_enqueue(IfxQspi_SpiMaster *handle, IfxQspi_SpiMaster_Job *jobs, Ifx_SizeT count);
+
 /** \brief Gets the transmission status
+ *
+ * The transfers are locked for the whole module until the job queue is empty: while jobs are queued or on
+ * transfer (see IfxQspi_SpiMaster_getQueueStatus()), SpiIf_Status_busy is returned for every channel, also
+ * after the end of the last IfxQspi_SpiMaster_exchange() of the channel.
  * \param chHandle Module Channel handle
  * \return Transmission status
  *
@@ -538,6 +648,42 @@ IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *ch
  */
 IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_getStatus(IfxQspi_SpiMaster_Channel *chHandle);
 
+/** \brief Gets the status of the job queue
+ * \param handle Module handle
+ * \return SpiIf_Status_busy if a job is on transfer or queued, else SpiIf_Status_ok
+ */
+IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_getQueueStatus(IfxQspi_SpiMaster *handle);
+
+/** \brief Prepares a DMA transfer which is started repeatedly with the same buffers, e.g. a cyclic frame of fixed format
+ *
+ * The transaction sets of the transmit and receive DMA channels are computed once here, with
+ * IfxDma_Dma_initLinkedListEntry(). The content of the buffers may change between two starts, their address not.
+ * The buffers are addressed from the CPU calling this function.
+ * \param prepared Prepared transfer
+ * \param chHandle Module Channel handle
+ * \param src Source of data. Can be set to NULL_PTR if nothing to transmit (receive only) - in this case, all-1 will be sent.
+ * \param dest Destination of data. Can be set to NULL_PTR if nothing to receive (transmit only)
+ * \param count Number of data, 1 .. 16383
+ * \return TRUE on success, FALSE if the module does not use the DMA or count is out of range
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiMaster_PreparedTransfer
+ *
+ */
+IFX_EXTERN boolean IfxQspi_SpiMaster_prepareTransfer(IfxQspi_SpiMaster_PreparedTransfer *prepared, IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count);
+
+/** \brief Starts a prepared transfer
+ *
+ * The transaction sets are copied into the DMA channels with word writes, without the register
+ * read-modify-writes and the interrupt lock of IfxQspi_SpiMaster_exchange(). The end of the transfer is
+ * handled by the DMA interrupts as for IfxQspi_SpiMaster_exchange().
+ * \param prepared Prepared transfer
+ * \return SpiIf_Status_ok if the transfer is started, SpiIf_Status_busy if another transfer is in progress
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiMaster_PreparedTransfer
+ *
+ */
+IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_startPreparedTransfer(IfxQspi_SpiMaster_PreparedTransfer *prepared);
+
 /** \} */
 
 /** \addtogroup IfxLld_Qspi_SpiMaster_InterruptFunctions
@@ -0,0 +1,222 @@
+/**
+ * \file IfxVadc_Acq.c
+ * \brief VADC acquisition with DMA ring buffers
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxVadc_Acq.h"
+#include "Cpu/Std/IfxCpu.h"
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void IfxVadc_Acq_initConfig(IfxVadc_Acq_Config *config, IfxVadc_Adc_Group *group)
+{
+    config->group           = group;
+    config->channels        = NULL_PTR;
+    config->channelCount    = 0;
+    config->bufferSize      = 64;
+    config->samplingTime    = 1.0e-4;
+    config->cutOffFrequency = 2 * IFX_PI * 100;
+    config->trigger.gtm     = NULL_PTR;
+    config->trigger.adcTrig = IfxGtm_Trig_AdcTrig_0;
+    config->trigger.source  = IfxGtm_Trig_AdcTrigSource_atom0;
+    config->trigger.channel = IfxGtm_Trig_AdcTrigChannel_4;
+    config->trigger.input   = IfxVadc_TriggerSource_0;
+    config->trigger.mode    = IfxVadc_TriggerMode_uponRisingEdge;
+}
+
+
+void IfxVadc_Acq_initChannelConfig(IfxVadc_Acq_ChannelConfig *config, IfxVadc_Adc_Group *group)
+{
+    IfxVadc_Adc_initChannelConfig(&config->adc, group);
+    config->dmaChannelId = IfxDma_ChannelId_0;
+    config->buffer       = NULL_PTR;
+}
+
+
+boolean IfxVadc_Acq_init(IfxVadc_Acq *acq, const IfxVadc_Acq_Config *config)
+{
+    Ifx_VADC_G              *vadcG  = config->group->group;
+    uint16                   size   = config->bufferSize;
+    uint32                   coreId = IfxCpu_getCoreId();
+    uint32                   scan   = 0;
+    boolean                  result = (config->channelCount >= 1) && (config->channelCount <= IFX_CFG_VADC_ACQ_MAX_CHANNELS)
+                                      && (size >= 16) && (size <= 8192) && ((size & (size - 1)) == 0);
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+    Ifx_LowPassPt1F32_Config filterConfig;
+    uint8                    i;
+    uint16                   j;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result);
+
+    acq->group        = config->group;
+    acq->triggered    = (config->trigger.gtm != NULL_PTR);
+    acq->channelCount = result ? config->channelCount : 0;
+
+    filterConfig.cutOffFrequency = config->cutOffFrequency;
+    filterConfig.gain            = 1.0;
+    filterConfig.samplingTime    = config->samplingTime;
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    /* one 16 bit move per result from the result register into the ring buffer, restarted forever, no interrupt */
+    dmaCfg.hardwareRequestEnabled           = TRUE;
+    dmaCfg.requestSource                    = IfxDma_ChannelRequestSource_peripheral;
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.sourceCircularBufferEnabled      = TRUE;
+    dmaCfg.destinationAddressCircularRange  = IfxDma_getCircularRangeCode((uint16)(size * sizeof(uint16)));
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.transferCount                    = size;
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_16bit;
+    dmaCfg.channelInterruptEnabled          = FALSE;
+
+    for (i = 0; i < acq->channelCount; i++)
+    {
+        const IfxVadc_Acq_ChannelConfig *channelConfig = &config->channels[i];
+        IfxVadc_Acq_Channel             *channel       = &acq->channel[i];
+        IfxVadc_Adc_ChannelConfig        adcConfig     = channelConfig->adc;
+
+        /* the DMA wraps the buffer on an address boundary */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)channelConfig->buffer & (uint32)((size * sizeof(uint16)) - 1)) == 0);
+
+        channel->buffer        = channelConfig->buffer;
+        channel->bufferAddress = IFXCPU_GLB_ADDR_DSPR(coreId, channelConfig->buffer);
+        channel->mask          = (uint16)(size - 1);
+        channel->filterIndex   = 0;
+        Ifx_LowPassPt1F32_init(&channel->filter, &filterConfig);
+
+        /* no stale result before the first conversion */
+        for (j = 0; j < size; j++)
+        {
+            channel->buffer[j] = 0;
+        }
+
+        /* the DMA is ready before the first service request */
+        dmaCfg.channelId          = channelConfig->dmaChannelId;
+        dmaCfg.sourceAddress      = (uint32)&vadcG->RES[adcConfig.resultRegister].U;
+        dmaCfg.destinationAddress = channel->bufferAddress;
+        IfxDma_Dma_initChannel(&channel->dma, &dmaCfg);
+
+        /* the result event of the channel requests the DMA channel */
+        adcConfig.resultPriority     = (Ifx_Priority)channelConfig->dmaChannelId;
+        adcConfig.resultServProvider = IfxSrc_Tos_dma;
+        adcConfig.backgroundChannel  = FALSE;
+        result                      &= (IfxVadc_Adc_initChannel(&channel->adc, &adcConfig) == IfxVadc_Status_noError);
+
+        scan |= 1U << adcConfig.channelId;
+    }
+
+    /* scan request source: the channels are converted one after the other, once per trigger or continuously */
+    IfxVadc_enableAccess(config->group->module.vadc, (IfxVadc_Protection)(IfxVadc_Protection_initGroup0 + config->group->groupId));
+    IfxVadc_disableScanSlotExternalTrigger(vadcG);
+    IfxVadc_setScanSlotGatingConfig(vadcG, IfxVadc_GatingSource_0, IfxVadc_GatingMode_always);
+
+    if (acq->triggered != FALSE)
+    {
+        result &= IfxGtm_Trig_toVadc(config->trigger.gtm, (IfxGtm_Trig_AdcGroup)config->group->groupId,
+            config->trigger.adcTrig, config->trigger.source, config->trigger.channel);
+        IfxVadc_setScanSlotTriggerConfig(vadcG, config->trigger.mode, config->trigger.input);
+        IfxVadc_setAutoScan(vadcG, FALSE);
+    }
+    else
+    {
+        IfxVadc_setAutoScan(vadcG, TRUE);
+    }
+
+    IfxVadc_disableAccess(config->group->module.vadc, (IfxVadc_Protection)(IfxVadc_Protection_initGroup0 + config->group->groupId));
+
+    IfxVadc_Adc_setScan(config->group, scan, scan);
+
+    return result;
+}
+
+
+void IfxVadc_Acq_start(IfxVadc_Acq *acq)
+{
+    Ifx_VADC_G *vadcG = acq->group->group;
+
+    if (acq->triggered != FALSE)
+    {
+        /* each trigger loads the channels of the scan */
+        IfxVadc_enableScanSlotExternalTrigger(vadcG);
+    }
+    else
+    {
+        IfxVadc_Adc_startScan(acq->group);
+    }
+}
+
+
+void IfxVadc_Acq_stop(IfxVadc_Acq *acq)
+{
+    Ifx_VADC_G *vadcG = acq->group->group;
+
+    IfxVadc_disableScanSlotExternalTrigger(vadcG);
+    vadcG->ASMR.B.CLRPND = 1;   /* cancel the pending conversions */
+}
+
+
+uint32 IfxVadc_Acq_getBlock(const IfxVadc_Acq_Channel *channel, uint16 *samples, uint32 count)
+{
+    uint32 mask  = channel->mask;
+    uint32 index;
+    uint32 i;
+
+    count = __minu(count, (mask + 1) / 2);
+    index = IfxVadc_Acq_getWriteIndex(channel) - count;
+
+    for (i = 0; i < count; i++)
+    {
+        samples[i] = channel->buffer[(index + i) & mask];
+    }
+
+    return count;
+}
+
+
+float32 IfxVadc_Acq_getFiltered(IfxVadc_Acq_Channel *channel)
+{
+    uint32  mask  = channel->mask;
+    uint32  write = IfxVadc_Acq_getWriteIndex(channel);
+    uint32  read  = channel->filterIndex;
+    float32 output = channel->filter.out;
+
+    while (read != write)
+    {
+        output = Ifx_LowPassPt1F32_do(&channel->filter, (float32)channel->buffer[read]);
+        read   = (read + 1) & mask;
+    }
+
+    channel->filterIndex = (uint16)write;
+
+    return output;
+}
@@ -0,0 +1,271 @@
+/**
+ * \file IfxVadc_Acq.h
+ * \brief VADC acquisition with DMA ring buffers
+ * \ingroup IfxLld_Vadc
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Vadc_Acq_Usage How to use the VADC acquisition driver?
+ * \ingroup IfxLld_Vadc
+ *
+ * The acquisition driver converts a set of channels of a VADC group with the scan request source,
+ * either continuously (autoscan) or once per GTM trigger, e.g. synchronised to the PWM period.
+ *
+ * The result register of each channel raises a service request routed to its own DMA channel,
+ * which moves the result into a ring buffer in RAM. The CPU is not involved in the sampling path:
+ * no interrupt, no polling of the valid flag. The consumer functions only read the ring buffer and
+ * the destination address of the DMA channel, not the VADC registers:
+ * - IfxVadc_Acq_getLatest() returns the last result
+ * - IfxVadc_Acq_getBlock() returns the last N results, oldest first
+ * - IfxVadc_Acq_getFiltered() runs a PT1 low-pass over the results received since the previous call
+ *
+ * Each channel uses its own result register, service request node (resultSrcNr) and DMA channel.
+ * The ring buffers are written by the DMA: they must be in a RAM reachable by the DMA, accessed by the CPU
+ * without data cache (e.g. the DSPR of the CPU, or the LMU through its non-cached address range), else the
+ * consumer functions may return stale results.
+ *
+ * \section IfxLld_Vadc_Acq_Example Example
+ * Three phase currents of group 7, converted once per PWM period triggered by the GTM ATOM0 channel 4:
+ * \code
+ * #include <Vadc/Acq/IfxVadc_Acq.h>
+ *
+ * #define CURRENT_BUFFER_SIZE 64
+ * static uint16 __attribute__ ((aligned(CURRENT_BUFFER_SIZE * 2))) currentBuffer[3][CURRENT_BUFFER_SIZE];
+ * static IfxVadc_Acq acq;
+ *
+ * IfxVadc_Acq_Config        acqConfig;
+ * IfxVadc_Acq_ChannelConfig channelConfig[3];
+ * uint8                     i;
+ *
+ * for (i = 0; i < 3; i++)
+ * {
+ *     IfxVadc_Acq_initChannelConfig(&channelConfig[i], &adcGroup);
+ *     channelConfig[i].adc.channelId      = (IfxVadc_ChannelId)i;
+ *     channelConfig[i].adc.resultRegister = (IfxVadc_ChannelResult)i;
+ *     channelConfig[i].adc.resultSrcNr    = (IfxVadc_SrcNr)i;
+ *     channelConfig[i].dmaChannelId       = (IfxDma_ChannelId)(10 + i);
+ *     channelConfig[i].buffer             = currentBuffer[i];
+ * }
+ *
+ * IfxVadc_Acq_initConfig(&acqConfig, &adcGroup);
+ * acqConfig.channels          = channelConfig;
+ * acqConfig.channelCount      = 3;
+ * acqConfig.bufferSize        = CURRENT_BUFFER_SIZE;
+ * acqConfig.samplingTime      = 1.0 / 20000;
+ * acqConfig.cutOffFrequency   = 2 * IFX_PI * 1000;
+ * acqConfig.trigger.gtm       = &MODULE_GTM;
+ * acqConfig.trigger.adcTrig   = IfxGtm_Trig_AdcTrig_0;
+ * acqConfig.trigger.source    = IfxGtm_Trig_AdcTrigSource_atom0;
+ * acqConfig.trigger.channel   = IfxGtm_Trig_AdcTrigChannel_4;
+ * acqConfig.trigger.input     = IfxVadc_TriggerSource_9; // REQTR input of the group connected to the GTM trigger, see the user manual
+ * IfxVadc_Acq_init(&acq, &acqConfig);
+ * IfxVadc_Acq_start(&acq);
+ *
+ * // control loop
+ * ia = IfxVadc_Acq_getLatest(&acq.channel[0]);
+ * ib = IfxVadc_Acq_getFiltered(&acq.channel[1]);
+ * \endcode
+ *
+ * \defgroup IfxLld_Vadc_Acq Acquisition Driver
+ * \ingroup IfxLld_Vadc
+ * \defgroup IfxLld_Vadc_Acq_DataStructures Data Structures
+ * \ingroup IfxLld_Vadc_Acq
+ * \defgroup IfxLld_Vadc_Acq_Functions Functions
+ * \ingroup IfxLld_Vadc_Acq
+ */
+
+#ifndef IFXVADC_ACQ_H
+#define IFXVADC_ACQ_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Vadc/Adc/IfxVadc_Adc.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Gtm/Trig/IfxGtm_Trig.h"
+#include "SysSe/Math/Ifx_LowPassPt1F32.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of channels of an acquisition object. A group has 4 service request nodes, plus 4 shared nodes */
+#ifndef IFX_CFG_VADC_ACQ_MAX_CHANNELS
+#define IFX_CFG_VADC_ACQ_MAX_CHANNELS (4)
+#endif
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Vadc_Acq_DataStructures
+ * \{ */
+/** \brief GTM trigger of the scan request source
+ */
+typedef struct
+{
+    Ifx_GTM                   *gtm;         /**< \brief Pointer to the GTM module, NULL_PTR: the channels are converted continuously (autoscan) */
+    IfxGtm_Trig_AdcTrig        adcTrig;     /**< \brief GTM ADC trigger output of the group */
+    IfxGtm_Trig_AdcTrigSource  source;      /**< \brief GTM timer sourcing the trigger */
+    IfxGtm_Trig_AdcTrigChannel channel;     /**< \brief Channel of the GTM timer */
+    IfxVadc_TriggerSource      input;       /**< \brief Trigger input (REQTR) of the group connected to the GTM ADC trigger */
+    IfxVadc_TriggerMode        mode;        /**< \brief Trigger edge */
+} IfxVadc_Acq_TriggerConfig;
+
+/** \brief Channel configuration
+ */
+typedef struct
+{
+    IfxVadc_Adc_ChannelConfig adc;              /**< \brief VADC channel configuration. resultRegister and resultSrcNr must be used by this channel only. The result interrupt settings are overwritten */
+    IfxDma_ChannelId          dmaChannelId;     /**< \brief DMA channel moving the results, requested by the result service request node */
+    uint16                   *buffer;           /**< \brief Ring buffer of IfxVadc_Acq_Config.bufferSize results, aligned on bufferSize * 2 bytes, in DMA reachable, non-cached RAM. Cleared by IfxVadc_Acq_init() */
+} IfxVadc_Acq_ChannelConfig;
+
+/** \brief Acquisition configuration
+ */
+typedef struct
+{
+    IfxVadc_Adc_Group               *group;             /**< \brief Initialised group, with the scan request slot enabled */
+    const IfxVadc_Acq_ChannelConfig *channels;          /**< \brief Configuration of the channels */
+    uint8                            channelCount;      /**< \brief Number of channels, 1 .. IFX_CFG_VADC_ACQ_MAX_CHANNELS */
+    uint16                           bufferSize;        /**< \brief Number of results of each ring buffer, a power of 2 from 16 to 8192 */
+    float32                          samplingTime;      /**< \brief Period of the conversions, used by the filter */
+    float32                          cutOffFrequency;   /**< \brief Cut-off frequency of the filter in rad/s */
+    IfxVadc_Acq_TriggerConfig        trigger;           /**< \brief Start of the conversions */
+} IfxVadc_Acq_Config;
+
+/** \brief Channel handle
+ */
+typedef struct
+{
+    IfxVadc_Adc_Channel adc;                /**< \brief VADC channel handle */
+    IfxDma_Dma_Channel  dma;                /**< \brief DMA channel handle */
+    uint16             *buffer;             /**< \brief Ring buffer */
+    uint32              bufferAddress;      /**< \brief Global address of the buffer, as seen by the DMA */
+    uint16              mask;               /**< \brief Buffer size - 1 */
+    uint16              filterIndex;        /**< \brief Index of the first result not yet filtered */
+    Ifx_LowPassPt1F32   filter;             /**< \brief Filter of the results */
+} IfxVadc_Acq_Channel;
+
+/** \brief Acquisition handle
+ */
+typedef struct
+{
+    IfxVadc_Adc_Group  *group;                                      /**< \brief VADC group */
+    boolean             triggered;                                  /**< \brief TRUE: conversions started by the GTM trigger */
+    uint8               channelCount;                               /**< \brief Number of channels */
+    IfxVadc_Acq_Channel channel[IFX_CFG_VADC_ACQ_MAX_CHANNELS];     /**< \brief Channels */
+} IfxVadc_Acq;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Vadc_Acq_Functions
+ * \{ */
+
+/** \brief Return the index of the next result written by the DMA
+ * \param channel pointer to the acquisition channel
+ * \return Index in the ring buffer
+ */
+IFX_INLINE uint32 IfxVadc_Acq_getWriteIndex(const IfxVadc_Acq_Channel *channel);
+
+/** \brief Return the last result
+ * \param channel pointer to the acquisition channel
+ * \return Last result, 0 before the first conversion
+ */
+IFX_INLINE uint16 IfxVadc_Acq_getLatest(const IfxVadc_Acq_Channel *channel);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the default acquisition configuration: continuous conversion, 64 results per buffer
+ * \param config pointer to the configuration
+ * \param group pointer to the initialised group
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Acq_initConfig(IfxVadc_Acq_Config *config, IfxVadc_Adc_Group *group);
+
+/** \brief Initialise the default channel configuration
+ * \param config pointer to the channel configuration
+ * \param group pointer to the initialised group
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Acq_initChannelConfig(IfxVadc_Acq_ChannelConfig *config, IfxVadc_Adc_Group *group);
+
+/** \brief Initialise the channels, their DMA channels and the scan request source. The conversions are started by IfxVadc_Acq_start()
+ * \param acq pointer to the acquisition handle
+ * \param config pointer to the configuration
+ * \return TRUE on success
+ */
+IFX_EXTERN boolean IfxVadc_Acq_init(IfxVadc_Acq *acq, const IfxVadc_Acq_Config *config);
+
+/** \brief Start the conversions: the continuous scan, or the conversion on each GTM trigger
+ * \param acq pointer to the acquisition handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Acq_start(IfxVadc_Acq *acq);
+
+/** \brief Stop the conversions. The ring buffers keep their content
+ * \param acq pointer to the acquisition handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Acq_stop(IfxVadc_Acq *acq);
+
+/** \brief Copy the last results, oldest first
+ * \param channel pointer to the acquisition channel
+ * \param samples buffer for count results
+ * \param count number of results, at most half of the buffer size so that the DMA does not overwrite them during the copy
+ * \return Number of results copied
+ */
+IFX_EXTERN uint32 IfxVadc_Acq_getBlock(const IfxVadc_Acq_Channel *channel, uint16 *samples, uint32 count);
+
+/** \brief Filter the results received since the previous call and return the filter output
+ *
+ * To be called at least once per buffer size results, older results are not filtered.
+ * \param channel pointer to the acquisition channel
+ * \return Filtered result
+ */
+IFX_EXTERN float32 IfxVadc_Acq_getFiltered(IfxVadc_Acq_Channel *channel);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE uint32 IfxVadc_Acq_getWriteIndex(const IfxVadc_Acq_Channel *channel)
+{
+    uint32 address = IfxDma_getChannelDestinationAddress(channel->dma.dma, channel->dma.channelId);
+
+    return ((address - channel->bufferAddress) / sizeof(uint16)) & channel->mask;
+}
+
+
+IFX_INLINE uint16 IfxVadc_Acq_getLatest(const IfxVadc_Acq_Channel *channel)
+{
+    return channel->buffer[(IfxVadc_Acq_getWriteIndex(channel) - 1) & channel->mask];
+}
+
+
+#endif /* IFXVADC_ACQ_H */
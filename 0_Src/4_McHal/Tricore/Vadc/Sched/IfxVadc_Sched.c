@@ -0,0 +1,483 @@
+/**
+ * \file IfxVadc_Sched.c
+ * \brief VADC conversion scheduler with synchronized multi-group conversions
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxVadc_Sched.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Group index inside of the kernel meaning "no master group" */
+#define IFXVADC_SCHED_NO_MASTER (IFXVADC_SCHED_KERNEL_SIZE)
+
+/** \brief Signal index meaning "no signal" */
+#define IFXVADC_SCHED_NO_SIGNAL (0xFFU)
+
+/******************************************************************************/
+/*------------------------Inline Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Return the ready input (SYNCTR.EVALR index) of the master group connected to a slave group of the same kernel
+ * \param master Master group
+ * \param slave Slave group
+ * \return Ready input 1 .. 3
+ */
+IFX_INLINE uint8 IfxVadc_Sched_getReadyInput(IfxVadc_GroupId master, IfxVadc_GroupId slave);
+
+/******************************************************************************/
+/*------------------------Private Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Return the shortest and the longest sample time requested in a group
+ * \param config pointer to the configuration
+ * \param group Group
+ * \param shortest returns the shortest sample time
+ * \param longest returns the longest sample time
+ * \return None
+ */
+static void IfxVadc_Sched_getSampleTimes(const IfxVadc_Sched_Config *config, IfxVadc_GroupId group, float32 *shortest, float32 *longest);
+
+/** \brief Initialise a group with the queue request source and the sample times of its requests
+ * \param sched pointer to the scheduler handle
+ * \param config pointer to the configuration
+ * \param group Group
+ * \param master Master group, the group itself for a stand-alone group
+ * \return IfxVadc_Status
+ */
+static IfxVadc_Status IfxVadc_Sched_initGroup(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config, IfxVadc_GroupId group, IfxVadc_GroupId master);
+
+/** \brief Initialise the channel of a request
+ * \param sched pointer to the scheduler handle
+ * \param config pointer to the configuration
+ * \param index Index of the request
+ * \param synchronize TRUE: the conversions of the channel start the parallel conversion of the slave groups
+ * \return IfxVadc_Status
+ */
+static IfxVadc_Status IfxVadc_Sched_initChannel(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config, uint8 index, boolean synchronize);
+
+/** \brief Lay out the signals of a kernel for a given master group and slave groups
+ *
+ * Each slave converts every synchronized channel of the master: a parallel slot is formed only for a channel of
+ * the master which is requested in all the slave groups. The parallel slots are converted first, in the order of
+ * the requests, the other signals follow in the order of the requests. The start, end, order and synchronized
+ * fields of the signals are updated.
+ * \param sched pointer to the scheduler handle
+ * \param requests Requests
+ * \param kernel Kernel index
+ * \param master Master group index inside of the kernel, IFXVADC_SCHED_NO_MASTER for no parallel conversion
+ * \param slaves Slave groups (bit n: group n of the kernel), not including the master
+ * \param synchronized returns the number of signals converted in parallel slots
+ * \return Time from the trigger to the last result of the kernel
+ */
+static float32 IfxVadc_Sched_layout(IfxVadc_Sched *sched, const IfxVadc_Sched_Request *requests, uint8 kernel, uint8 master, uint8 slaves, uint8 *synchronized);
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE uint8 IfxVadc_Sched_getReadyInput(IfxVadc_GroupId master, IfxVadc_GroupId slave)
+{
+    /* the ready inputs 1 .. 3 are the other groups of the kernel, in ascending order */
+    uint8 m = (uint8)master % IFXVADC_SCHED_KERNEL_SIZE;
+    uint8 s = (uint8)slave % IFXVADC_SCHED_KERNEL_SIZE;
+
+    return (s < m) ? (s + 1) : s;
+}
+
+
+/******************************************************************************/
+/*-------------------------Private Function Implementations-------------------*/
+/******************************************************************************/
+
+static void IfxVadc_Sched_getSampleTimes(const IfxVadc_Sched_Config *config, IfxVadc_GroupId group, float32 *shortest, float32 *longest)
+{
+    uint8 i;
+
+    *shortest = 0.0;
+    *longest  = 0.0;
+
+    for (i = 0; i < config->requestCount; i++)
+    {
+        if (config->requests[i].group == group)
+        {
+            float32 sampleTime = config->requests[i].sampleTime;
+
+            *shortest = (*longest == 0.0) ? sampleTime : __minf(*shortest, sampleTime);
+            *longest  = __maxf(*longest, sampleTime);
+        }
+    }
+}
+
+
+static IfxVadc_Status IfxVadc_Sched_initGroup(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config, IfxVadc_GroupId group, IfxVadc_GroupId master)
+{
+    IfxVadc_Adc_GroupConfig groupConfig;
+    float32                 shortest, longest;
+
+    IfxVadc_Sched_getSampleTimes(config, group, &shortest, &longest);
+
+    IfxVadc_Adc_initGroupConfig(&groupConfig, config->vadc);
+    groupConfig.groupId                                  = group;
+    groupConfig.master                                   = master;
+    groupConfig.inputClass[0].sampleTime                 = longest;
+    groupConfig.inputClass[0].resolution                 = config->resolution;
+    groupConfig.inputClass[1].sampleTime                 = shortest;
+    groupConfig.inputClass[1].resolution                 = config->resolution;
+
+    /* the queue is the only request source: the sequence is defined by the order of the entries */
+    groupConfig.arbiter.requestSlotQueueEnabled          = TRUE;
+    groupConfig.arbiter.requestSlotScanEnabled           = FALSE;
+    groupConfig.arbiter.requestSlotBackgroundScanEnabled = FALSE;
+    groupConfig.queueRequest.flushQueueAfterInit         = TRUE;
+    groupConfig.queueRequest.triggerConfig.triggerSource = config->triggerSource;
+    groupConfig.queueRequest.triggerConfig.triggerMode   = config->triggerMode;
+    groupConfig.queueRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+
+    return IfxVadc_Adc_initGroup(&sched->group[group], &groupConfig);
+}
+
+
+static IfxVadc_Status IfxVadc_Sched_initChannel(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config, uint8 index, boolean synchronize)
+{
+    const IfxVadc_Sched_Request *request = &config->requests[index];
+    IfxVadc_Adc_ChannelConfig    channelConfig;
+    float32                      shortest, longest;
+
+    IfxVadc_Sched_getSampleTimes(config, request->group, &shortest, &longest);
+
+    IfxVadc_Adc_initChannelConfig(&channelConfig, &sched->group[request->group]);
+    channelConfig.channelId      = request->channel;
+    channelConfig.resultRegister = request->resultRegister;
+    channelConfig.synchonize     = synchronize;
+    channelConfig.inputClass     = (request->sampleTime > shortest) ? IfxVadc_InputClasses_group0 : IfxVadc_InputClasses_group1;
+
+    return IfxVadc_Adc_initChannel(&sched->signal[index].adc, &channelConfig);
+}
+
+
+static float32 IfxVadc_Sched_layout(IfxVadc_Sched *sched, const IfxVadc_Sched_Request *requests, uint8 kernel, uint8 master, uint8 slaves, uint8 *synchronized)
+{
+    float32 time[IFXVADC_SCHED_KERNEL_SIZE];
+    uint8   position[IFXVADC_SCHED_KERNEL_SIZE];
+    uint8   partner[IFXVADC_SCHED_KERNEL_SIZE];
+    float32 latency = 0.0;
+    uint8   i, j, g;
+
+    *synchronized = 0;
+
+    for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+    {
+        time[g]     = 0.0;
+        position[g] = 0;
+    }
+
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        sched->signal[i].synchronized = FALSE;
+    }
+
+    /* parallel slots: a channel of the master with the same channel number in each slave group */
+    for (i = 0; (master != IFXVADC_SCHED_NO_MASTER) && (slaves != 0) && (i < sched->signalCount); i++)
+    {
+        boolean complete = TRUE;
+
+        if ((uint8)requests[i].group != ((kernel * IFXVADC_SCHED_KERNEL_SIZE) + master))
+        {
+            continue;
+        }
+
+        for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+        {
+            partner[g] = IFXVADC_SCHED_NO_SIGNAL;
+        }
+
+        partner[master] = i;
+
+        for (j = 0; j < sched->signalCount; j++)
+        {
+            g = (uint8)requests[j].group % IFXVADC_SCHED_KERNEL_SIZE;
+
+            if (((requests[j].group / IFXVADC_SCHED_KERNEL_SIZE) == kernel) && ((slaves & (1U << g)) != 0)
+                && (requests[j].channel == requests[i].channel))
+            {
+                partner[g] = j;
+            }
+        }
+
+        for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+        {
+            if (((slaves & (1U << g)) != 0) && (partner[g] == IFXVADC_SCHED_NO_SIGNAL))
+            {
+                complete = FALSE;
+            }
+        }
+
+        if (complete != FALSE)
+        {
+            float32 start    = 0.0;
+            float32 duration = 0.0;
+
+            /* the parallel conversion starts when all groups of the slot are ready, and lasts for the slowest one */
+            for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+            {
+                if (partner[g] != IFXVADC_SCHED_NO_SIGNAL)
+                {
+                    start    = __maxf(start, time[g]);
+                    duration = __maxf(duration, sched->signal[partner[g]].conversionTime);
+                }
+            }
+
+            for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+            {
+                if (partner[g] != IFXVADC_SCHED_NO_SIGNAL)
+                {
+                    IfxVadc_Sched_Signal *signal = &sched->signal[partner[g]];
+
+                    signal->start        = start;
+                    signal->end          = start + signal->conversionTime;
+                    signal->order        = position[g]++;
+                    signal->synchronized = TRUE;
+                    time[g]              = start + duration;
+                    (*synchronized)++;
+                }
+            }
+        }
+    }
+
+    /* the other signals, one after the other in each group */
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        IfxVadc_Sched_Signal *signal = &sched->signal[i];
+
+        if (((requests[i].group / IFXVADC_SCHED_KERNEL_SIZE) == kernel) && (signal->synchronized == FALSE))
+        {
+            g             = (uint8)requests[i].group % IFXVADC_SCHED_KERNEL_SIZE;
+            signal->start = time[g];
+            signal->end   = time[g] + signal->conversionTime;
+            signal->order = position[g]++;
+            time[g]       = signal->end;
+        }
+    }
+
+    for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+    {
+        latency = __maxf(latency, time[g]);
+    }
+
+    return latency;
+}
+
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void IfxVadc_Sched_initConfig(IfxVadc_Sched_Config *config, IfxVadc_Adc *vadc)
+{
+    config->vadc          = vadc;
+    config->requests      = NULL_PTR;
+    config->requestCount  = 0;
+    config->resolution    = IfxVadc_ChannelResolution_12bit;
+    config->triggerSource = IfxVadc_TriggerSource_0;
+    config->triggerMode   = IfxVadc_TriggerMode_noExternalTrigger;
+}
+
+
+boolean IfxVadc_Sched_init(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config)
+{
+    const IfxVadc_Sched_Request *requests = config->requests;
+    Ifx_VADC                    *vadc     = config->vadc->vadc;
+    boolean                      result   = (config->requestCount >= 1) && (config->requestCount <= IFX_CFG_VADC_SCHED_MAX_REQUESTS);
+    uint8                        queued[IFXVADC_NUM_ADC_GROUPS];
+    uint8                        i, k, g;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result);
+
+    sched->signalCount = result ? config->requestCount : 0;
+    sched->groups      = 0;
+    sched->latency     = 0.0;
+
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        sched->groups |= 1U << requests[i].group;
+    }
+
+    /* stand-alone groups and channels first, to get the conversion times */
+    for (g = 0; g < IFXVADC_NUM_ADC_GROUPS; g++)
+    {
+        if ((sched->groups & (1U << g)) != 0)
+        {
+            result &= (IfxVadc_Sched_initGroup(sched, config, (IfxVadc_GroupId)g, (IfxVadc_GroupId)g) == IfxVadc_Status_noError);
+        }
+    }
+
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        result                          &= (IfxVadc_Sched_initChannel(sched, config, i, FALSE) == IfxVadc_Status_noError);
+        sched->signal[i].conversionTime  = IfxVadc_Adc_getChannelConversionTime(&sched->signal[i].adc, IfxVadc_ConversionType_Compatible);
+    }
+
+    /* master and slave groups of each kernel: the most signals in parallel slots first, then the shortest latency */
+    for (k = 0; k < IFXVADC_SCHED_NUM_KERNELS; k++)
+    {
+        uint8   used             = (uint8)((sched->groups >> (k * IFXVADC_SCHED_KERNEL_SIZE)) & ((1U << IFXVADC_SCHED_KERNEL_SIZE) - 1));
+        uint8   bestMaster       = IFXVADC_SCHED_NO_MASTER;
+        uint8   bestSlaves       = 0;
+        uint8   bestSynchronized = 0;
+        uint8   slaves, synchronized;
+        float32 bestLatency      = IfxVadc_Sched_layout(sched, requests, k, IFXVADC_SCHED_NO_MASTER, 0, &synchronized);
+        float32 latency;
+
+        for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+        {
+            /* every non-empty set of the other used groups of the kernel */
+            for (slaves = 1; ((used & (1U << g)) != 0) && (slaves < (1U << IFXVADC_SCHED_KERNEL_SIZE)); slaves++)
+            {
+                if (((slaves & ~used) == 0) && ((slaves & (1U << g)) == 0))
+                {
+                    latency = IfxVadc_Sched_layout(sched, requests, k, g, slaves, &synchronized);
+
+                    if ((synchronized > bestSynchronized) || ((synchronized == bestSynchronized) && (synchronized != 0) && (latency < bestLatency)))
+                    {
+                        bestMaster       = g;
+                        bestSlaves       = slaves;
+                        bestSynchronized = synchronized;
+                        bestLatency      = latency;
+                    }
+                }
+            }
+        }
+
+        latency                 = IfxVadc_Sched_layout(sched, requests, k, bestMaster, bestSlaves, &synchronized);
+        sched->latency          = __maxf(sched->latency, latency);
+        sched->kernel[k].master = (IfxVadc_GroupId)((k * IFXVADC_SCHED_KERNEL_SIZE) + ((bestMaster != IFXVADC_SCHED_NO_MASTER) ? bestMaster : 0));
+        sched->kernel[k].slaves = bestSlaves;
+    }
+
+    /* the queue of a group holds its own signals, the parallel slots are requested by the master only */
+    for (g = 0; g < IFXVADC_NUM_ADC_GROUPS; g++)
+    {
+        queued[g] = 0;
+    }
+
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        g = (uint8)requests[i].group;
+
+        if ((sched->signal[i].synchronized == FALSE) || (sched->kernel[g / IFXVADC_SCHED_KERNEL_SIZE].master == requests[i].group))
+        {
+            queued[g]++;
+            result &= (queued[g] <= IFXVADC_SCHED_QUEUE_SIZE);
+        }
+    }
+
+    if (result == FALSE)
+    {
+        return FALSE;
+    }
+
+    /* synchronization of the kernels: the slave groups are initialised first, then the master group */
+    for (k = 0; k < IFXVADC_SCHED_NUM_KERNELS; k++)
+    {
+        IfxVadc_Sched_Kernel *kernel = &sched->kernel[k];
+
+        if (kernel->slaves != 0)
+        {
+            for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+            {
+                if ((kernel->slaves & (1U << g)) != 0)
+                {
+                    result &= (IfxVadc_Sched_initGroup(sched, config, (IfxVadc_GroupId)((k * IFXVADC_SCHED_KERNEL_SIZE) + g), kernel->master) == IfxVadc_Status_noError);
+                }
+            }
+
+            result &= (IfxVadc_Sched_initGroup(sched, config, kernel->master, kernel->master) == IfxVadc_Status_noError);
+
+            /* the master waits for the slaves to be ready before a parallel conversion */
+            IfxVadc_enableAccess(vadc, (IfxVadc_Protection)(IfxVadc_Protection_initGroup0 + kernel->master));
+
+            for (g = 0; g < IFXVADC_SCHED_KERNEL_SIZE; g++)
+            {
+                if ((kernel->slaves & (1U << g)) != 0)
+                {
+                    IfxVadc_GroupId slave = (IfxVadc_GroupId)((k * IFXVADC_SCHED_KERNEL_SIZE) + g);
+                    vadc->G[kernel->master].SYNCTR.U |= 0x00000008U << IfxVadc_Sched_getReadyInput(kernel->master, slave);
+                }
+            }
+
+            IfxVadc_disableAccess(vadc, (IfxVadc_Protection)(IfxVadc_Protection_initGroup0 + kernel->master));
+        }
+    }
+
+    for (i = 0; i < sched->signalCount; i++)
+    {
+        if ((sched->signal[i].synchronized != FALSE) && (sched->kernel[requests[i].group / IFXVADC_SCHED_KERNEL_SIZE].master == requests[i].group))
+        {
+            result &= (IfxVadc_Sched_initChannel(sched, config, i, TRUE) == IfxVadc_Status_noError);
+        }
+    }
+
+    /* queues in the scheduled order, refilled after conversion. The first entry waits for the trigger */
+    for (g = 0; g < IFXVADC_NUM_ADC_GROUPS; g++)
+    {
+        uint8 order;
+        uint8 entries = 0;
+
+        for (order = 0; order < IFX_CFG_VADC_SCHED_MAX_REQUESTS; order++)
+        {
+            for (i = 0; i < sched->signalCount; i++)
+            {
+                IfxVadc_Sched_Signal *signal = &sched->signal[i];
+
+                if ((requests[i].group == g) && (signal->order == order)
+                    && ((signal->synchronized == FALSE) || (sched->kernel[g / IFXVADC_SCHED_KERNEL_SIZE].master == g)))
+                {
+                    IfxVadc_Adc_addToQueue(&signal->adc, IFXVADC_QUEUE_REFILL | ((entries == 0) ? IFXVADC_QUEUE_EXTERNAL_TRIGGER : 0));
+                    entries++;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+
+void IfxVadc_Sched_start(IfxVadc_Sched *sched)
+{
+    uint8 g;
+
+    for (g = 0; g < IFXVADC_NUM_ADC_GROUPS; g++)
+    {
+        if ((sched->groups & (1U << g)) != 0)
+        {
+            IfxVadc_Adc_startQueue(&sched->group[g]);
+        }
+    }
+}
@@ -0,0 +1,206 @@
+/**
+ * \file IfxVadc_Sched.h
+ * \brief VADC conversion scheduler with synchronized multi-group conversions
+ * \ingroup IfxLld_Vadc
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Vadc_Sched_Usage How to use the VADC conversion scheduler?
+ * \ingroup IfxLld_Vadc
+ *
+ * The scheduler takes the list of the signals to be sampled once per period (e.g. per PWM period), each given
+ * by its group, channel, result register and minimal sample time, and lays them out over the VADC groups.
+ *
+ * The groups of a synchronization kernel (groups 0 .. 3 and groups 4 .. 7) can convert in parallel: when
+ * the master group converts a channel marked as synchronized, the slave groups convert the channel with the
+ * same number at the same time. Every slave group converts every synchronized channel of the master, so a parallel
+ * slot is formed only for a channel requested in the master and in all the slave groups. The scheduler selects
+ * for each kernel the master group and the slave groups which give the most signals sampled in parallel
+ * conversion slots, then the shortest sampling window:
+ * - the parallel slots are converted first, in the order of the requests
+ * - the other signals of each group are converted afterwards, in the order of the requests
+ *
+ * Each group converts its signals with the queue request source, refilled after each conversion, so that the
+ * whole sequence is converted once per trigger. The timing of each signal and the total latency from the
+ * trigger to the last result are computed with IfxVadc_Adc_getChannelConversionTime().
+ *
+ * The group sample times are set from the requests: input class 0 gets the longest, input class 1 the shortest
+ * sample time of the group. The signals of a parallel slot should be wired to inputs requiring the same sample time.
+ *
+ * \section IfxLld_Vadc_Sched_Example Example
+ * Phase currents and phase voltages sampled on the same channel number of groups 0, 1 and 2:
+ * \code
+ * #include <Vadc/Sched/IfxVadc_Sched.h>
+ *
+ * static const IfxVadc_Sched_Request requests[] = {
+ *     {IfxVadc_GroupId_0, IfxVadc_ChannelId_0, IfxVadc_ChannelResult_0, 0.2e-6},   // ia
+ *     {IfxVadc_GroupId_1, IfxVadc_ChannelId_0, IfxVadc_ChannelResult_0, 0.2e-6},   // ib
+ *     {IfxVadc_GroupId_2, IfxVadc_ChannelId_0, IfxVadc_ChannelResult_0, 0.2e-6},   // ic
+ *     {IfxVadc_GroupId_0, IfxVadc_ChannelId_1, IfxVadc_ChannelResult_1, 0.5e-6},   // va
+ *     {IfxVadc_GroupId_1, IfxVadc_ChannelId_1, IfxVadc_ChannelResult_1, 0.5e-6},   // vb
+ *     {IfxVadc_GroupId_2, IfxVadc_ChannelId_1, IfxVadc_ChannelResult_1, 0.5e-6},   // vc
+ *     {IfxVadc_GroupId_3, IfxVadc_ChannelId_5, IfxVadc_ChannelResult_0, 1.0e-6},   // vdc
+ * };
+ * static IfxVadc_Sched sched;
+ *
+ * IfxVadc_Sched_Config schedConfig;
+ *
+ * IfxVadc_Sched_initConfig(&schedConfig, &vadc);
+ * schedConfig.requests      = requests;
+ * schedConfig.requestCount  = sizeof(requests) / sizeof(requests[0]);
+ * schedConfig.triggerSource = IfxVadc_TriggerSource_9;     // REQTR input connected to the PWM trigger
+ * schedConfig.triggerMode   = IfxVadc_TriggerMode_uponRisingEdge;
+ * IfxVadc_Sched_init(&sched, &schedConfig);
+ *
+ * // sched.latency: time from the trigger to the last result
+ * // sched.signal[i].end: time from the trigger to the result of requests[i]
+ *
+ * // control loop, after sched.latency
+ * ia = IfxVadc_Adc_getResult(&sched.signal[0].adc);
+ * \endcode
+ *
+ * \defgroup IfxLld_Vadc_Sched Conversion Scheduler
+ * \ingroup IfxLld_Vadc
+ * \defgroup IfxLld_Vadc_Sched_DataStructures Data Structures
+ * \ingroup IfxLld_Vadc_Sched
+ * \defgroup IfxLld_Vadc_Sched_Functions Functions
+ * \ingroup IfxLld_Vadc_Sched
+ */
+
+#ifndef IFXVADC_SCHED_H
+#define IFXVADC_SCHED_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Vadc/Adc/IfxVadc_Adc.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of signals of a scheduler */
+#ifndef IFX_CFG_VADC_SCHED_MAX_REQUESTS
+#define IFX_CFG_VADC_SCHED_MAX_REQUESTS (16)
+#endif
+
+/** \brief Number of groups of a synchronization kernel */
+#define IFXVADC_SCHED_KERNEL_SIZE       (4)
+
+/** \brief Number of synchronization kernels */
+#define IFXVADC_SCHED_NUM_KERNELS       (IFXVADC_NUM_ADC_GROUPS / IFXVADC_SCHED_KERNEL_SIZE)
+
+/** \brief Number of entries of the queue of a group */
+#define IFXVADC_SCHED_QUEUE_SIZE        (8)
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Vadc_Sched_DataStructures
+ * \{ */
+/** \brief Conversion request of one signal
+ */
+typedef struct
+{
+    IfxVadc_GroupId       group;              /**< \brief Group of the input */
+    IfxVadc_ChannelId     channel;            /**< \brief Channel of the input */
+    IfxVadc_ChannelResult resultRegister;     /**< \brief Result register of the group, used by this signal only */
+    float32               sampleTime;         /**< \brief Minimal sample time in s */
+} IfxVadc_Sched_Request;
+
+/** \brief Scheduler configuration
+ */
+typedef struct
+{
+    IfxVadc_Adc                 *vadc;              /**< \brief Initialised VADC module */
+    const IfxVadc_Sched_Request *requests;          /**< \brief Signals to be converted once per trigger. (group, channel) must be unique */
+    uint8                        requestCount;      /**< \brief Number of signals, 1 .. IFX_CFG_VADC_SCHED_MAX_REQUESTS */
+    IfxVadc_ChannelResolution    resolution;        /**< \brief Resolution of all signals */
+    IfxVadc_TriggerSource        triggerSource;     /**< \brief Trigger input (REQTR) of the queue of the groups */
+    IfxVadc_TriggerMode          triggerMode;       /**< \brief Trigger edge. IfxVadc_TriggerMode_noExternalTrigger: the conversions are started by IfxVadc_Sched_start() */
+} IfxVadc_Sched_Config;
+
+/** \brief Scheduled signal
+ */
+typedef struct
+{
+    IfxVadc_Adc_Channel adc;                /**< \brief VADC channel handle, to read the result */
+    float32             conversionTime;     /**< \brief Conversion time in s */
+    float32             start;              /**< \brief Start of the conversion after the trigger in s */
+    float32             end;                /**< \brief Result available after the trigger in s */
+    uint8               order;              /**< \brief Position of the conversion in the sequence of the group */
+    boolean             synchronized;       /**< \brief TRUE: converted in a parallel slot of the kernel */
+} IfxVadc_Sched_Signal;
+
+/** \brief Synchronization kernel
+ */
+typedef struct
+{
+    IfxVadc_GroupId master;     /**< \brief Master group, valid if slaves != 0 */
+    uint8           slaves;     /**< \brief Slave groups (bit n: group n of the kernel). 0: no parallel conversion in the kernel */
+} IfxVadc_Sched_Kernel;
+
+/** \brief Scheduler handle
+ */
+typedef struct
+{
+    IfxVadc_Adc_Group    group[IFXVADC_NUM_ADC_GROUPS];                 /**< \brief Group handles */
+    uint32               groups;                                        /**< \brief Groups used (bit n: group n) */
+    IfxVadc_Sched_Kernel kernel[IFXVADC_SCHED_NUM_KERNELS];             /**< \brief Synchronization of the kernels */
+    uint8                signalCount;                                   /**< \brief Number of signals */
+    IfxVadc_Sched_Signal signal[IFX_CFG_VADC_SCHED_MAX_REQUESTS];       /**< \brief Signals, in the order of the requests */
+    float32              latency;                                       /**< \brief Time from the trigger to the last result in s */
+} IfxVadc_Sched;
+
+/** \} */
+
+/** \addtogroup IfxLld_Vadc_Sched_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the default scheduler configuration: 12 bit results, software start
+ * \param config pointer to the configuration
+ * \param vadc pointer to the initialised VADC module
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Sched_initConfig(IfxVadc_Sched_Config *config, IfxVadc_Adc *vadc);
+
+/** \brief Lay out the signals over the groups, then initialise the groups, the channels and the queues
+ *
+ * The groups used by the requests are initialised by this function, with the queue request source only.
+ * \param sched pointer to the scheduler handle
+ * \param config pointer to the configuration
+ * \return TRUE on success, FALSE if the requests do not fit (count, queue size of a group)
+ */
+IFX_EXTERN boolean IfxVadc_Sched_init(IfxVadc_Sched *sched, const IfxVadc_Sched_Config *config);
+
+/** \brief Start one conversion sequence by software in all the groups
+ * \param sched pointer to the scheduler handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Sched_start(IfxVadc_Sched *sched);
+
+/** \} */
+
+#endif /* IFXVADC_SCHED_H */
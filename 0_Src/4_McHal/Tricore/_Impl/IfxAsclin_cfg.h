@@ -42,4 +42,6 @@
 
 #define IFXASCLIN_NUM_MODULES (4)
 
+#define IFXASCLIN_FIFO_DEPTH  (16)   /**< \brief Number of entries of the Tx and Rx hardware FIFOs */
+
 #endif /* IFXASCLIN_CFG_H */
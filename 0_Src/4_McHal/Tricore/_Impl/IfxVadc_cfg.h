@@ -76,6 +76,8 @@
 
 #define IFXVADC_QUEUE_REFILL                           (1 << IFX_VADC_G_QBUR0_RF_OFF)
 
+#define IFXVADC_QUEUE_EXTERNAL_TRIGGER                 (1 << IFX_VADC_G_QINR0_EXTR_OFF)
+
 /** \brief Number of ADC group input classes.
  */
 #define IFXVADC_NUM_GLOBAL_INPUTCLASSES                (2)
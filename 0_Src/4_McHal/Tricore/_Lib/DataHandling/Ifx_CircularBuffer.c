@@ -23,6 +23,9 @@
  */
 
 #include "Ifx_CircularBuffer.h"
+#include "Cpu/Std/IfxCpu.h"
+#include <stddef.h>
+#include <string.h>
 
 #if (IFX_CFG_CIRCULARBUFFER_C)
 
@@ -164,3 +167,226 @@ const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *d
 
 
 #endif
+
+
+/** \brief Handler used by the bulk copy functions for large blocks */
+static struct
+{
+    Ifx_CircularBuffer_BulkCopy copy;          /**< \brief Handler, NULL_PTR if not used */
+    void                       *object;        /**< \brief Handler object */
+    Ifx_SizeT                   threshold;     /**< \brief Block size in bytes from which the handler is used */
+    volatile uint32             busy;          /**< \brief 1 while the handler is in use */
+} Ifx_CircularBuffer_bulkCopy = {NULL_PTR, NULL_PTR, IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD, 0};
+
+
+void Ifx_CircularBuffer_setBulkCopy(Ifx_CircularBuffer_BulkCopy copy, void *object, Ifx_SizeT threshold)
+{
+    Ifx_CircularBuffer_bulkCopy.copy      = copy;
+    Ifx_CircularBuffer_bulkCopy.object    = object;
+    Ifx_CircularBuffer_bulkCopy.threshold = threshold;
+}
+
+
+/** \brief Load a 32 bit word from a 32 bit aligned address, without type punning */
+IFX_INLINE uint32 Ifx_CircularBuffer_load32(const uint8 *address)
+{
+    uint32 value;
+#if defined(__GNUC__)
+    address = (const uint8 *)__builtin_assume_aligned(address, 4);
+#endif
+    memcpy(&value, address, 4);
+    return value;
+}
+
+
+/** \brief Store a 32 bit word to a 32 bit aligned address, without type punning */
+IFX_INLINE void Ifx_CircularBuffer_store32(uint8 *address, uint32 value)
+{
+#if defined(__GNUC__)
+    address = (uint8 *)__builtin_assume_aligned(address, 4);
+#endif
+    memcpy(address, &value, 4);
+}
+
+
+/** \brief Copy a 64 bit word between 64 bit aligned addresses, without type punning */
+IFX_INLINE void Ifx_CircularBuffer_copy64(uint8 *destination, const uint8 *source)
+{
+    uint64 value;
+#if defined(__GNUC__)
+    destination = (uint8 *)__builtin_assume_aligned(destination, 8);
+    source      = (const uint8 *)__builtin_assume_aligned(source, 8);
+#endif
+    memcpy(&value, source, 8);
+    memcpy(destination, &value, 8);
+}
+
+
+void Ifx_CircularBuffer_copy(void *destination, const void *source, Ifx_SizeT count)
+{
+    uint8       *Dest   = (uint8 *)destination;
+    const uint8 *Src    = (const uint8 *)source;
+    uint32       Offset = (uint32)(size_t)Dest ^ (uint32)(size_t)Src;
+
+    if ((Offset & 7U) == 0)
+    {
+        /* head: bytes up to the 64 bit boundary */
+        while ((count > 0) && ((((uint32)(size_t)Dest) & 7U) != 0))
+        {
+            *Dest = *Src;
+            Dest  = &Dest[1];
+            Src   = &Src[1];
+            count--;
+        }
+
+        while (count >= 8)
+        {
+            Ifx_CircularBuffer_copy64(Dest, Src);
+            Dest   = &Dest[8];
+            Src    = &Src[8];
+            count -= 8;
+        }
+    }
+    else
+    {
+        /* head: bytes up to the 32 bit boundary of the destination */
+        while ((count > 0) && ((((uint32)(size_t)Dest) & 3U) != 0))
+        {
+            *Dest = *Src;
+            Dest  = &Dest[1];
+            Src   = &Src[1];
+            count--;
+        }
+
+        if ((Offset & 3U) == 0)
+        {
+            while (count >= 4)
+            {
+                Ifx_CircularBuffer_store32(Dest, Ifx_CircularBuffer_load32(Src));
+                Dest   = &Dest[4];
+                Src    = &Src[4];
+                count -= 4;
+            }
+        }
+        else if (count >= 8)
+        {
+            /* the source is read with aligned words, each destination word merges 2 source words (little endian).
+             * The bytes of the first source word which precede the block are not read */
+            uint32       offset = ((uint32)(size_t)Src) & 3U;
+            uint32       shift  = offset * 8U;
+            const uint8 *Src32  = &Src[-(sint32)offset];
+            uint32       low    = 0;
+            uint32       high;
+            uint32       i;
+
+            for (i = 0; i < (4U - offset); i++)
+            {
+                low |= (uint32)Src[i] << (shift + (i * 8U));
+            }
+
+            do
+            {
+                Src32 = &Src32[4];
+                high  = Ifx_CircularBuffer_load32(Src32);
+                Ifx_CircularBuffer_store32(Dest, (low >> shift) | (high << (32U - shift)));
+                low    = high;
+                Dest   = &Dest[4];
+                Src    = &Src[4];
+                count -= 4;
+            } while (count >= 8);
+        }
+    }
+
+    /* tail: remaining bytes */
+    while (count > 0)
+    {
+        *Dest = *Src;
+        Dest  = &Dest[1];
+        Src   = &Src[1];
+        count--;
+    }
+}
+
+
+/** \brief Copy one linear block, delegate to the registered handler if the block is large enough
+ *
+ * The handler is only used with the interrupts enabled, i.e. not from an interrupt service routine nor
+ * from a critical section, and by one caller at a time: an interrupted or concurrent bulk copy uses the CPU.
+ */
+IFX_INLINE void Ifx_CircularBuffer_copyBlock(void *destination, const void *source, Ifx_SizeT count)
+{
+    boolean delegated = FALSE;
+
+    if ((Ifx_CircularBuffer_bulkCopy.copy != NULL_PTR) && (count >= Ifx_CircularBuffer_bulkCopy.threshold)
+        && (IfxCpu_areInterruptsEnabled() != FALSE))
+    {
+        if (__swap((void *)&Ifx_CircularBuffer_bulkCopy.busy, 1U) == 0)
+        {
+            Ifx_CircularBuffer_BulkCopy copy = Ifx_CircularBuffer_bulkCopy.copy;
+
+            if (copy != NULL_PTR)
+            {
+                copy(Ifx_CircularBuffer_bulkCopy.object, destination, source, count);
+                delegated = TRUE;
+            }
+
+            __dsync();
+            Ifx_CircularBuffer_bulkCopy.busy = 0;
+        }
+    }
+
+    if (delegated == FALSE)
+    {
+        Ifx_CircularBuffer_copy(destination, source, count);
+    }
+}
+
+
+void *Ifx_CircularBuffer_readBulk(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
+{
+    uint8    *Dest = (uint8 *)data;
+    uint8    *base = (uint8 *)buffer->base;
+    Ifx_SizeT blockSize;
+
+    do
+    {
+        blockSize = __min(count, (Ifx_SizeT)(buffer->length - buffer->index));
+        Ifx_CircularBuffer_copyBlock(Dest, &base[buffer->index], blockSize);
+        Dest          = &Dest[blockSize];
+        buffer->index = (uint16)(buffer->index + blockSize);
+
+        if (buffer->index >= buffer->length)
+        {
+            buffer->index = 0;
+        }
+
+        count -= blockSize;
+    } while (count > 0);
+
+    return Dest;
+}
+
+
+const void *Ifx_CircularBuffer_writeBulk(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
+{
+    const uint8 *source = (const uint8 *)data;
+    uint8       *base   = (uint8 *)buffer->base;
+    Ifx_SizeT    blockSize;
+
+    do
+    {
+        blockSize = __min(count, (Ifx_SizeT)(buffer->length - buffer->index));
+        Ifx_CircularBuffer_copyBlock(&base[buffer->index], source, blockSize);
+        source        = &source[blockSize];
+        buffer->index = (uint16)(buffer->index + blockSize);
+
+        if (buffer->index >= buffer->length)
+        {
+            buffer->index = 0;
+        }
+
+        count -= blockSize;
+    } while (count > 0);
+
+    return source;
+}
@@ -37,6 +37,24 @@
 #define IFX_CFG_CIRCULARBUFFER_C (1)
 #endif
 
+/** \brief Default size in bytes from which a bulk copy is delegated to the \ref Ifx_CircularBuffer_BulkCopy handler
+ * \see Ifx_CircularBuffer_setBulkCopy()
+ */
+#ifndef IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD
+#define IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD (1024)
+#endif
+
+/** \brief Linear copy handler used by the bulk copy functions for large blocks, for example IfxDma_Dma_bulkCopy()
+ *
+ * \param object Specifies the handler object, for example the DMA channel.
+ * \param destination Specifies destination pointer.
+ * \param source Specifies source pointer.
+ * \param count Specifies number of bytes to be copied.
+ *
+ * The handler must return when the copy is completed.
+ */
+typedef void (*Ifx_CircularBuffer_BulkCopy)(void *object, void *destination, const void *source, Ifx_SizeT count);
+
 /** \addtogroup IfxLld_lib_datahandling_circularbuffer
  * \{
  */
@@ -96,6 +114,69 @@ const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *da
  */
 const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count);
 
+/** \brief Copy count bytes from the source to the destination, for any alignment
+ *
+ * When source and destination have the same alignment modulo 8, the bytes up to the
+ * next 64 bit boundary are copied first, then 64 bit words, then the remaining bytes.
+ * When they only share the alignment modulo 4, 32 bit words are used instead.
+ * Otherwise the source is read with aligned 32 bit words, which are shifted and merged into
+ * aligned 32 bit words of the destination.
+ *
+ * \param destination Specifies destination pointer.
+ * \param source Specifies source pointer.
+ * \param count Specifies number of bytes to be copied.
+ *
+ * \return None.
+ */
+void Ifx_CircularBuffer_copy(void *destination, const void *source, Ifx_SizeT count);
+
+/** \brief Copy count bytes from the circular buffer to the data array, for any alignment
+ *
+ * The copy is split at the end of the circular buffer into at most 2 linear blocks.
+ * Each block is copied with Ifx_CircularBuffer_copy(), or with the handler registered with
+ * Ifx_CircularBuffer_setBulkCopy() when the block size reaches the threshold.
+ *
+ * \param buffer Specifies circular buffer.
+ * \param data Specifies destination pointer.
+ * \param count Specifies number of bytes to be copied. count MUST be >= 1.
+ *
+ * \return Returns the updated data pointer data = ((uint8*)data) + count
+ */
+void *Ifx_CircularBuffer_readBulk(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count);
+
+/** \brief Copy count bytes from the data array to the circular buffer, for any alignment
+ *
+ * See Ifx_CircularBuffer_readBulk().
+ *
+ * \param buffer Specifies circular buffer.
+ * \param data Specifies source pointer.
+ * \param count Specifies number of bytes to be copied. count MUST be >= 1.
+ *
+ * \return Returns the updated data pointer data = ((uint8*)data) + count
+ */
+const void *Ifx_CircularBuffer_writeBulk(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count);
+
+/** \brief Register the handler used by the bulk copy functions for large blocks
+ *
+ * \param copy Specifies the handler. NULL_PTR disables the delegation.
+ * \param object Specifies the object passed to the handler.
+ * \param threshold Specifies the block size in bytes from which the handler is used.
+ *
+ * \return None.
+ *
+ * The handler is global: it is shared by all circular buffers, and so by all FIFOs, on all CPUs.
+ * It is only called with the interrupts enabled, so never from an interrupt service routine nor from
+ * a critical section, and by one caller at a time. A bulk copy which interrupts or runs concurrently
+ * with the handler is done by the CPU. The handler must not be changed while a bulk copy is on-going.
+ *
+ * \code
+ * IfxDma_Dma_Channel dmaCopyChannel;  // configured for software requests, see IfxDma_Dma_copy()
+ *
+ * Ifx_CircularBuffer_setBulkCopy(&IfxDma_Dma_bulkCopy, &dmaCopyChannel, IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD);
+ * \endcode
+ */
+void Ifx_CircularBuffer_setBulkCopy(Ifx_CircularBuffer_BulkCopy copy, void *object, Ifx_SizeT threshold);
+
 /** \} */
 //---------------------------------------------------------------------------
 #endif
@@ -45,10 +45,21 @@
  * Implementation note: as an interrupt runs at a higher cpu level than the thread
  * the interrupt is not disabled in the IntfifoXXX() functions
  * This is valid is an OS is used.
+ * *
+ * In Ifx_Fifo_Mode_spsc mode the interrupts are not disabled: the writer only
+ * modifies the head, the reader only modifies the tail. The data are copied
+ * before the index is published, a DSYNC orders the buffer access and the index
+ * update.
  *
  */
 //------------------------------------------------------------------------------
 Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    return Ifx_Fifo_createMode(size, elementSize, Ifx_Fifo_Mode_locked);
+}
+
+
+Ifx_Fifo *Ifx_Fifo_createMode(Ifx_SizeT size, Ifx_SizeT elementSize, Ifx_Fifo_Mode mode)
 {
     Ifx_Fifo *fifo = NULL_PTR;
 
@@ -58,7 +69,7 @@ Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize)
 
     if (IFX_VALIDATE(IFX_VERBOSE_LEVEL_ERROR, (fifo != NULL_PTR)))
     {
-        fifo = Ifx_Fifo_init(fifo, size, elementSize);
+        fifo = Ifx_Fifo_initMode(fifo, size, elementSize, mode);
     }
 
     return fifo;
@@ -72,6 +83,12 @@ void Ifx_Fifo_destroy(Ifx_Fifo *fifo)
 
 
 Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    return Ifx_Fifo_initMode(buffer, size, elementSize, Ifx_Fifo_Mode_locked);
+}
+
+
+Ifx_Fifo *Ifx_Fifo_initMode(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize, Ifx_Fifo_Mode mode)
 {
     Ifx_Fifo *fifo = NULL_PTR;
 
@@ -84,19 +101,129 @@ Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
         fifo                     = (Ifx_Fifo *)buffer;
         fifo->eventReader        = FALSE;
         fifo->eventWriter        = TRUE;
-        fifo->buffer             = (uint8 *)Ifx_AlignOn64(((uint32)fifo) + sizeof(Ifx_Fifo));
+        fifo->buffer             = (uint8 *)Ifx_AlignOn64(((size_t)fifo) + sizeof(Ifx_Fifo));
         fifo->shared.count       = 0;
         fifo->shared.maxcount    = 0;
         fifo->shared.readerWaitx = fifo->shared.writerWaitx = 0;
         fifo->startIndex         = fifo->endIndex = 0;
         fifo->size               = size;
         fifo->elementSize        = elementSize;
+        fifo->mode               = mode;
+        fifo->spsc.head          = fifo->spsc.tail = 0;
     }
 
     return fifo;
 }
 
 
+/**
+ * \brief Wait until the reader (reader = TRUE) or the writer can transfer count bytes, Ifx_Fifo_Mode_spsc only
+ * \param count in bytes
+ */
+static boolean Ifx_Fifo_waitSpsc(Ifx_Fifo *fifo, boolean reader, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime DeadLine = getDeadLine(timeout);
+    boolean      result;
+
+    do
+    {
+        Ifx_SizeT available = (reader != FALSE) ? Ifx_Fifo_readCount(fifo) : Ifx_Fifo_writeCount(fifo);
+        result = available >= count;
+    } while ((result == FALSE) && (isDeadLine(DeadLine) == FALSE));
+
+    return result;
+}
+
+
+static Ifx_SizeT Ifx_Fifo_readSpsc(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    uint32             tail = fifo->spsc.tail;
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;
+    buffer.index  = (uint16)fifo->startIndex;
+    DeadLine      = getDeadLine(timeout);
+
+    do
+    {
+        blockSize  = __min(count, (Ifx_SizeT)(fifo->spsc.head - tail));
+        blockSize -= blockSize % fifo->elementSize;
+
+        if (blockSize != 0)
+        {
+            __dsync();          /* the data written before the head are visible */
+            data              = Ifx_CircularBuffer_readBulk(&buffer, data, blockSize);
+            fifo->startIndex  = buffer.index;
+            __dsync();          /* the data are read before the space is released to the writer */
+            tail             += blockSize;
+            fifo->spsc.tail   = tail;
+            fifo->eventWriter = TRUE;
+            count            -= blockSize;
+        }
+    } while ((count != 0) && (isDeadLine(DeadLine) == FALSE));
+
+    return count;
+}
+
+
+static Ifx_SizeT Ifx_Fifo_writeSpsc(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    uint32             head = fifo->spsc.head;
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;
+    buffer.index  = (uint16)fifo->endIndex;
+    DeadLine      = getDeadLine(timeout);
+
+    do
+    {
+        Ifx_SizeT used = (Ifx_SizeT)(head - fifo->spsc.tail);
+        blockSize  = __min(count, fifo->size - used);
+        blockSize -= blockSize % fifo->elementSize;
+
+        if (blockSize != 0)
+        {
+            __dsync();          /* the space released by the reader is not read anymore */
+            data                  = Ifx_CircularBuffer_writeBulk(&buffer, data, blockSize);
+            fifo->endIndex        = buffer.index;
+            __dsync();          /* the data are written before the head is published */
+            head                 += blockSize;
+            fifo->spsc.head       = head;
+            fifo->shared.maxcount = __max(fifo->shared.maxcount, used + blockSize);
+            fifo->eventReader     = TRUE;
+            count                -= blockSize;
+        }
+    } while ((count != 0) && (isDeadLine(DeadLine) == FALSE));
+
+    return count;
+}
+
+
+static void Ifx_Fifo_clearSpsc(Ifx_Fifo *fifo)
+{
+    uint32    head  = fifo->spsc.head;
+    Ifx_SizeT count = (Ifx_SizeT)(head - fifo->spsc.tail);
+
+    fifo->startIndex += count;
+
+    if (fifo->startIndex >= fifo->size)
+    {
+        fifo->startIndex -= fifo->size;
+    }
+
+    __dsync();
+    fifo->spsc.tail   = head;
+    fifo->eventReader = FALSE;
+    fifo->eventWriter = TRUE;
+}
+
+
 /**
  * \param count in bytes
  */
@@ -126,6 +253,10 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
     {                           /* Only complete elements can be read from the buffer */
         result = FALSE;
     }
+    else if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        result = Ifx_Fifo_waitSpsc(fifo, TRUE, __min(count, fifo->size), timeout);
+    }
     else
     {
         boolean interruptState;
@@ -198,7 +329,11 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
 
-    if (count != 0)
+    if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_spsc))
+    {
+        count = Ifx_Fifo_readSpsc(fifo, data, count, timeout);
+    }
+    else if (count != 0)
     {
         buffer.base   = fifo->buffer;
         buffer.length = (uint16)fifo->size;         /* size always fit into 16 bit */
@@ -212,7 +347,7 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
             if (blockSize != 0)
             {
                 /* read element from the buffer */
-                data  = Ifx_CircularBuffer_read8(&buffer, data, blockSize);
+                data  = Ifx_CircularBuffer_readBulk(&buffer, data, blockSize);
                 count = Ifx_Fifo_readEnd(fifo, count, blockSize);
             }
 
@@ -241,20 +376,27 @@ void Ifx_Fifo_clear(Ifx_Fifo *fifo)
 {
     boolean interruptState;
 
-    interruptState = IfxCpu_disableInterrupts();
-
-    if (fifo->shared.writerWaitx != 0)
+    if (fifo->mode == Ifx_Fifo_Mode_spsc)
     {
-        fifo->shared.writerWaitx = 0;
-        fifo->eventWriter        = TRUE; /* Signal the writer */
+        Ifx_Fifo_clearSpsc(fifo);
     }
+    else
+    {
+        interruptState = IfxCpu_disableInterrupts();
 
-    fifo->eventReader        = FALSE;
-    fifo->shared.readerWaitx = 0;
-    fifo->shared.count       = 0;
-    fifo->shared.maxcount    = 0;
-    fifo->startIndex         = fifo->endIndex;
-    IfxCpu_restoreInterrupts(interruptState);
+        if (fifo->shared.writerWaitx != 0)
+        {
+            fifo->shared.writerWaitx = 0;
+            fifo->eventWriter        = TRUE; /* Signal the writer */
+        }
+
+        fifo->eventReader        = FALSE;
+        fifo->shared.readerWaitx = 0;
+        fifo->shared.count       = 0;
+        fifo->shared.maxcount    = 0;
+        fifo->startIndex         = fifo->endIndex;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
 }
 
 
@@ -285,6 +427,10 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
     {                           /* Only complete elements can be written to the buffer */
         result = FALSE;
     }
+    else if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        result = Ifx_Fifo_waitSpsc(fifo, FALSE, count, timeout);
+    }
     else
     {
         boolean interruptState;
@@ -352,7 +498,11 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
 
-    if (count != 0)
+    if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_spsc))
+    {
+        count = Ifx_Fifo_writeSpsc(fifo, data, count, timeout);
+    }
+    else if (count != 0)
     {
         buffer.base   = fifo->buffer;
         buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
@@ -366,7 +516,7 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
             if (blockSize != 0)
             {
                 /* write element to the buffer */
-                data  = Ifx_CircularBuffer_write8(&buffer, data, blockSize);
+                data  = Ifx_CircularBuffer_writeBulk(&buffer, data, blockSize);
                 count = Ifx_Fifo_endWrite(fifo, count, blockSize);
             }
 
@@ -391,4 +541,109 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
 }
 
 
+/** \brief Split count bytes starting at index into the parts before and after the buffer end
+ */
+static Ifx_SizeT Ifx_Fifo_getSpans(Ifx_Fifo *fifo, Ifx_SizeT index, Ifx_SizeT count, Ifx_Fifo_Span *span)
+{
+    Ifx_SizeT first = __min(count, fifo->size - index);
+
+    span[0].data   = &((uint8 *)fifo->buffer)[index];
+    span[0].length = first;
+    span[1].data   = fifo->buffer;
+    span[1].length = count - first;
+
+    return count;
+}
+
+
+/** \brief Return index advanced by count bytes in the ring buffer
+ */
+IFX_INLINE Ifx_SizeT Ifx_Fifo_advanceIndex(Ifx_Fifo *fifo, Ifx_SizeT index, Ifx_SizeT count)
+{
+    index += count;
+
+    if (index >= fifo->size)
+    {
+        index -= fifo->size;
+    }
+
+    return index;
+}
+
+
+Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, Ifx_Fifo_Span *span, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    count  = __min(count, Ifx_Fifo_writeCount(fifo));
+    count -= count % fifo->elementSize;
+
+    return Ifx_Fifo_getSpans(fifo, fifo->endIndex, count, span);
+}
+
+
+void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count <= Ifx_Fifo_writeCount(fifo));
+
+    if (count != 0)
+    {
+        fifo->endIndex = Ifx_Fifo_advanceIndex(fifo, fifo->endIndex, count);
+
+        if (fifo->mode == Ifx_Fifo_Mode_spsc)
+        {
+            Ifx_SizeT used = Ifx_Fifo_readCount(fifo);
+            __dsync();          /* the data are written before the head is published */
+            fifo->spsc.head      += count;
+            fifo->shared.maxcount = __max(fifo->shared.maxcount, used + count);
+            fifo->eventReader     = TRUE;
+        }
+        else
+        {
+            Ifx_Fifo_endWrite(fifo, count, count);
+        }
+    }
+}
+
+
+Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, Ifx_Fifo_Span *span, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    count  = __min(count, Ifx_Fifo_readCount(fifo));
+    count -= count % fifo->elementSize;
+
+    if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        __dsync();              /* the data written before the head are visible */
+    }
+
+    return Ifx_Fifo_getSpans(fifo, fifo->startIndex, count, span);
+}
+
+
+void Ifx_Fifo_consumeRead(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count <= Ifx_Fifo_readCount(fifo));
+
+    if (count != 0)
+    {
+        fifo->startIndex = Ifx_Fifo_advanceIndex(fifo, fifo->startIndex, count);
+
+        if (fifo->mode == Ifx_Fifo_Mode_spsc)
+        {
+            __dsync();          /* the data are read before the space is released to the writer */
+            fifo->spsc.tail  += count;
+            fifo->eventWriter = TRUE;
+        }
+        else
+        {
+            Ifx_Fifo_readEnd(fifo, count, count);
+        }
+    }
+}
+
+
 //------------------------------------------------------------------------------
@@ -34,6 +34,14 @@
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
 //------------------------------------------------------------------------------
 
+/** \brief Synchronisation mode between the reader and the writer of the FIFO
+ */
+typedef enum
+{
+    Ifx_Fifo_Mode_locked = 0,   /**< \brief shared data protected by disabling the interrupts, blocking reader / writer are woken up by events */
+    Ifx_Fifo_Mode_spsc   = 1    /**< \brief single producer / single consumer, lock free. The reader owns the tail, the writer owns the head */
+} Ifx_Fifo_Mode;
+
 /** Shared data of the FIFO
  *
  */
@@ -45,6 +53,26 @@ typedef struct
     Ifx_SizeT maxcount;         /**< \brief Highest value seen in the count */
 } Ifx_Fifo_Shared;
 
+/** Head / tail indices of a FIFO in \ref Ifx_Fifo_Mode_spsc mode
+ *
+ * Both are free running byte counters, their difference is the number of bytes in
+ * the buffer. The head is only modified by the writer, the tail only by the reader.
+ */
+typedef struct
+{
+    volatile uint32 head;       /**< \brief Number of bytes written since the initialisation */
+    volatile uint32 tail;       /**< \brief Number of bytes read since the initialisation */
+} Ifx_Fifo_Spsc;
+
+/** Contiguous part of the FIFO buffer, see Ifx_Fifo_reserveWrite() and Ifx_Fifo_peekRead()
+ *
+ */
+typedef struct
+{
+    void     *data;             /**< \brief start of the part */
+    Ifx_SizeT length;           /**< \brief length of the part in bytes, may be 0 */
+} Ifx_Fifo_Span;
+
 /** \addtogroup IfxLld_lib_datahandling_fifo
  * \{ */
 /** Fifo object
@@ -60,6 +88,8 @@ typedef struct _Fifo
     Ifx_SizeT        elementSize;           /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
     volatile boolean eventReader;           /**< \brief event set by the writer to signal the reader that the required data are available in the buffer */
     volatile boolean eventWriter;           /**< \brief event set by the reader to signal the writer that the required free space are available in the buffer */
+    Ifx_Fifo_Mode    mode;                  /**< \brief reader / writer synchronisation mode */
+    Ifx_Fifo_Spsc    spsc;                  /**< \brief head / tail indices, only used in \ref Ifx_Fifo_Mode_spsc mode */
 } Ifx_Fifo;
 
 /** \brief Indicates if the required number of bytes are available in the buffer
@@ -87,6 +117,8 @@ IFX_EXTERN boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Ti
 IFX_EXTERN boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout);
 
 /** \brief Clear fifo contents.
+ *
+ * In \ref Ifx_Fifo_Mode_spsc mode the function must be called by the reader.
  *
  * \param fifo Pointer on the Fifo object
  *
@@ -107,6 +139,18 @@ IFX_EXTERN void Ifx_Fifo_clear(Ifx_Fifo *fifo);
  */
 IFX_EXTERN Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize);
 
+/** \brief Create a Fifo object with the given synchronisation mode
+ *
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ * \param mode Specifies the reader / writer synchronisation mode
+ *
+ * \return returns a pointer to the FIFO object
+ *
+ * \see Ifx_Fifo_create(), Ifx_Fifo_initMode()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_createMode(Ifx_SizeT size, Ifx_SizeT elementSize, Ifx_Fifo_Mode mode);
+
 /** \brief Destroy the FIFO object
  *
  * This function must be called to destroy the fifo object when created with \ref Ifx_Fifo_create()
@@ -133,6 +177,26 @@ IFX_EXTERN void Ifx_Fifo_destroy(Ifx_Fifo *fifo);
  */
 IFX_EXTERN Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize);
 
+/** \brief Initialize the FIFO buffer object with the given synchronisation mode
+ *
+ * \ref Ifx_Fifo_Mode_locked is the mode used by Ifx_Fifo_init().
+ *
+ * \ref Ifx_Fifo_Mode_spsc does not disable the interrupts. It requires exactly one
+ * reader and one writer context, e.g. an ISR writing and a task reading, and
+ * Ifx_Fifo_clear() to be called by the reader. A blocking call polls the head / tail
+ * instead of waiting for the event, the events are set after each transfer.
+ *
+ * \param buffer Specifies the FIFO object address.
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ * \param mode Specifies the reader / writer synchronisation mode
+ *
+ * \return Returns a pointer on the FIFO object
+ *
+ * \see Ifx_Fifo_init()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_initMode(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize, Ifx_Fifo_Mode mode);
+
 /** \brief Read data from a fifo and remove them from the buffer.
  *
  * Only complete elements are returned, if count is not a multiple of
@@ -159,6 +223,49 @@ IFX_EXTERN Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count,
  */
 IFX_EXTERN Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout);
 
+/** \brief Give access to the free space of the fifo without copy.
+ *
+ * The free space is returned as up to 2 contiguous parts of the ring buffer, span[0]
+ * is filled first, span[1].length is 0 if the space does not wrap around. The caller
+ * writes the data in place and publishes them with Ifx_Fifo_commitWrite(). Only
+ * the writer shall call the function, the reserved space is not modified by the reader.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param span Array of 2 spans, set by the function
+ * \param count Maximum number of bytes to reserve
+ *
+ * \return the number of bytes reserved, a multiple of elementSize
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, Ifx_Fifo_Span *span, Ifx_SizeT count);
+
+/** \brief Publish data written in place after Ifx_Fifo_reserveWrite()
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes to publish, a multiple of elementSize, at most the reserved count
+ */
+IFX_EXTERN void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count);
+
+/** \brief Give access to the data of the fifo without copy.
+ *
+ * The data are returned as up to 2 contiguous parts of the ring buffer, span[0]
+ * holds the oldest data. The data stay in the fifo until Ifx_Fifo_consumeRead() is
+ * called. Only the reader shall call the function.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param span Array of 2 spans, set by the function
+ * \param count Maximum number of bytes to access
+ *
+ * \return the number of bytes accessible, a multiple of elementSize
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, Ifx_Fifo_Span *span, Ifx_SizeT count);
+
+/** \brief Remove data accessed with Ifx_Fifo_peekRead() from the fifo
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes to remove, a multiple of elementSize, at most the peeked count
+ */
+IFX_EXTERN void Ifx_Fifo_consumeRead(Ifx_Fifo *fifo, Ifx_SizeT count);
+
 /** \brief Empty the fifo
  *
  * \param fifo Pointer on the Fifo object
@@ -185,7 +292,18 @@ IFX_INLINE boolean Ifx_Fifo_flush(Ifx_Fifo *fifo, Ifx_TickTime timeout)
  */
 IFX_INLINE Ifx_SizeT Ifx_Fifo_readCount(Ifx_Fifo *fifo)
 {
-    return fifo->shared.count;
+    Ifx_SizeT count;
+
+    if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        count = (Ifx_SizeT)(fifo->spsc.head - fifo->spsc.tail);
+    }
+    else
+    {
+        count = fifo->shared.count;
+    }
+
+    return count;
 }
 
 
@@ -0,0 +1,213 @@
+/**
+ * \file Ifx_Bench.c
+ * \brief Micro benchmark runner for the host build.
+ *
+ * Usage: Ifx_Bench [filter]
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_Bench.h"
+#include "Bsp.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define IFX_BENCH_HAS_CYCLES (1)
+#else
+#define IFX_BENCH_HAS_CYCLES (0)
+#endif
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+volatile uint32  Ifx_Bench_g_sink    = 0;
+volatile float32 Ifx_Bench_g_sinkF32 = 0.0f;
+
+static const Ifx_Bench_Suite Ifx_Bench_suites[] = {
+    {"Math",         Ifx_Bench_g_mathCases        },
+    {"DataHandling", Ifx_Bench_g_dataHandlingCases},
+    {"Comm",         Ifx_Bench_g_commCases        },
+    {NULL_PTR,       NULL_PTR                     }
+};
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Measurement of one sample */
+typedef struct
+{
+    uint64 ns;      /**< \brief elapsed time in ns */
+    uint64 cycles;  /**< \brief elapsed time stamp counter cycles */
+} Ifx_Bench_Sample;
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+IFX_INLINE uint64 Ifx_Bench_readCycles(void)
+{
+#if IFX_BENCH_HAS_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+
+static Ifx_Bench_Sample Ifx_Bench_measure(const Ifx_Bench_Case *benchCase, uint32 iterations)
+{
+    Ifx_Bench_Sample sample;
+    Ifx_TickTime     start       = now();
+    uint64           startCycles = Ifx_Bench_readCycles();
+
+    benchCase->run(iterations);
+
+    sample.cycles = Ifx_Bench_readCycles() - startCycles;
+    sample.ns     = (uint64)elapsed(start);
+
+    return sample;
+}
+
+
+static void Ifx_Bench_runCase(pchar suiteName, const Ifx_Bench_Case *benchCase)
+{
+    uint32           iterations = 1;
+    uint32           i;
+    Ifx_Bench_Sample sample;
+    Ifx_Bench_Sample best;
+
+    if (benchCase->setup != NULL_PTR)
+    {
+        benchCase->setup();
+    }
+
+    /* Calibration: double the iteration count until a sample is long enough */
+    sample = Ifx_Bench_measure(benchCase, iterations);
+
+    while ((sample.ns < IFX_BENCH_SAMPLE_TIME) && (iterations < 0x80000000UL))
+    {
+        iterations *= 2;
+        sample      = Ifx_Bench_measure(benchCase, iterations);
+    }
+
+    best = sample;
+
+    for (i = 1; i < IFX_BENCH_SAMPLE_COUNT; i++)
+    {
+        sample = Ifx_Bench_measure(benchCase, iterations);
+
+        if (sample.ns < best.ns)
+        {
+            best = sample;
+        }
+    }
+
+#if IFX_BENCH_HAS_CYCLES
+    printf("%-14s %-44s %12.2f %12.2f %12lu", suiteName, benchCase->name,
+        (float64)best.ns / iterations, (float64)best.cycles / iterations, (unsigned long)iterations);
+
+    if ((benchCase->bytes != 0) && (best.cycles != 0))
+    {
+        printf(" %12.2f", ((float64)benchCase->bytes * iterations) / best.cycles);
+    }
+    else if (benchCase->error != NULL_PTR)
+    {
+        printf(" %12s", "");
+    }
+#else
+    printf("%-14s %-44s %12.2f %12s %12lu", suiteName, benchCase->name,
+        (float64)best.ns / iterations, "-", (unsigned long)iterations);
+
+    if (benchCase->error != NULL_PTR)
+    {
+        printf(" %12s", "");
+    }
+#endif
+
+    if (benchCase->error != NULL_PTR)
+    {
+        printf(" %12.3g", benchCase->error());
+    }
+
+    printf("\n");
+    fflush(stdout);
+}
+
+
+static boolean Ifx_Bench_isSelected(pchar suiteName, pchar caseName, pchar filter)
+{
+    char fullName[128];
+
+    if (filter == NULL_PTR)
+    {
+        return TRUE;
+    }
+
+    snprintf(fullName, sizeof(fullName), "%s/%s", suiteName, caseName);
+
+    return strstr(fullName, filter) != NULL_PTR;
+}
+
+
+uint32 Ifx_Bench_run(const Ifx_Bench_Suite *suites, pchar filter)
+{
+    uint32                count = 0;
+    const Ifx_Bench_Suite *suite;
+    const Ifx_Bench_Case  *benchCase;
+
+    printf("%-14s %-44s %12s %12s %12s %12s %12s\n", "suite", "case", "ns/op", "cycles/op", "iterations", "bytes/cycle", "max error");
+
+    for (suite = suites; suite->name != NULL_PTR; suite++)
+    {
+        for (benchCase = suite->cases; benchCase->name != NULL_PTR; benchCase++)
+        {
+            if (Ifx_Bench_isSelected(suite->name, benchCase->name, filter) != FALSE)
+            {
+                Ifx_Bench_runCase(suite->name, benchCase);
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+
+int main(int argc, char *argv[])
+{
+    pchar filter = (argc > 1) ? argv[1] : NULL_PTR;
+
+    initTime();
+
+    if (Ifx_Bench_run(Ifx_Bench_suites, filter) == 0)
+    {
+        fprintf(stderr, "No benchmark case matches '%s'\n", filter);
+        return 1;
+    }
+
+    return 0;
+}
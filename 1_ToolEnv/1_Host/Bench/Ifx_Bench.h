@@ -0,0 +1,103 @@
+/**
+ * \file Ifx_Bench.h
+ * \brief Micro benchmark runner for the host build.
+ *
+ * A benchmark case measures one public entry point of a module. The runner
+ * calibrates the number of iterations so that one sample lasts at least
+ * IFX_BENCH_SAMPLE_TIME ns, takes IFX_BENCH_SAMPLE_COUNT samples and reports the
+ * best one as ns/op and cycles/op. Cycles are read from the x86 time stamp
+ * counter, they are not reported on other host architectures.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#ifndef IFX_BENCH_H
+#define IFX_BENCH_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Cpu/Std/Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFX_BENCH_SAMPLE_TIME  (20000000)   /**< \brief Minimum duration of one sample in ns */
+#define IFX_BENCH_SAMPLE_COUNT (5)          /**< \brief Number of samples per case, the best one is reported */
+
+/** \brief End marker of a \ref Ifx_Bench_Case list */
+#define IFX_BENCH_CASE_LIST_END {0, 0, 0, 0, 0}
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Prepare the data used by the case, called once before the calibration */
+typedef void (*Ifx_Bench_Setup)(void);
+
+/** \brief Execute the measured entry point \p iterations times */
+typedef void (*Ifx_Bench_Run)(uint32 iterations);
+
+/** \brief Return the maximum absolute error of the measured function against a reference (e.g. libm) */
+typedef float64 (*Ifx_Bench_Error)(void);
+
+/** \brief Benchmark case object */
+typedef struct
+{
+    pchar           name;       /**< \brief Measured entry point, e.g. "Ifx_Fifo_write(1)" */
+    Ifx_Bench_Setup setup;      /**< \brief Optional setup function, may be NULL_PTR */
+    Ifx_Bench_Run   run;        /**< \brief Measured function */
+    uint32          bytes;      /**< \brief Optional number of bytes copied per operation, reported as bytes/cycle */
+    Ifx_Bench_Error error;      /**< \brief Optional accuracy check, reported as max error, may be NULL_PTR */
+} Ifx_Bench_Case;
+
+/** \brief Group of cases belonging to one module */
+typedef struct
+{
+    pchar                 name;  /**< \brief Suite name, e.g. "DataHandling" */
+    const Ifx_Bench_Case *cases; /**< \brief Case list terminated by IFX_BENCH_CASE_LIST_END */
+} Ifx_Bench_Suite;
+
+/******************************************************************************/
+/*-------------------------Global Variable Declarations-----------------------*/
+/******************************************************************************/
+
+/** \brief Sink written by the cases so that the compiler keeps the measured calls */
+IFX_EXTERN volatile uint32  Ifx_Bench_g_sink;
+
+/** \brief Sink for floating point results */
+IFX_EXTERN volatile float32 Ifx_Bench_g_sinkF32;
+
+IFX_EXTERN const Ifx_Bench_Case Ifx_Bench_g_mathCases[];
+IFX_EXTERN const Ifx_Bench_Case Ifx_Bench_g_dataHandlingCases[];
+IFX_EXTERN const Ifx_Bench_Case Ifx_Bench_g_commCases[];
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Run all cases whose "suite/name" contains \p filter
+ * \param suites suite list terminated by an entry with name == NULL_PTR
+ * \param filter sub string selecting the cases, NULL_PTR runs all cases
+ * \return number of cases run
+ */
+IFX_EXTERN uint32 Ifx_Bench_run(const Ifx_Bench_Suite *suites, pchar filter);
+
+#endif /* IFX_BENCH_H */
@@ -0,0 +1,191 @@
+/**
+ * \file Ifx_BenchPipe.c
+ * \brief Host loopback driver for the IfxStdIf_DPipe standard interface.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_BenchPipe.h"
+#include "Bsp.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+static boolean Ifx_BenchPipe_write(Ifx_BenchPipe *pipe, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    Ifx_SizeT left = 0;
+
+    if (*count != 0)
+    {
+        left             = Ifx_Fifo_write(pipe->tx, data, *count, timeout);
+        *count          -= left;
+        pipe->sendCount += *count;
+        pipe->txTimestamp = now();
+    }
+
+    return left == 0;
+}
+
+
+static boolean Ifx_BenchPipe_read(Ifx_BenchPipe *pipe, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    Ifx_SizeT left = Ifx_Fifo_read(pipe->rx, data, *count, timeout);
+
+    *count -= left;
+
+    return left == 0;
+}
+
+
+static sint32 Ifx_BenchPipe_getReadCount(Ifx_BenchPipe *pipe)
+{
+    return Ifx_Fifo_readCount(pipe->rx);
+}
+
+
+static IfxStdIf_DPipe_ReadEvent Ifx_BenchPipe_getReadEvent(Ifx_BenchPipe *pipe)
+{
+    return &pipe->rx->eventReader;
+}
+
+
+static sint32 Ifx_BenchPipe_getWriteCount(Ifx_BenchPipe *pipe)
+{
+    return Ifx_Fifo_writeCount(pipe->tx);
+}
+
+
+static IfxStdIf_DPipe_WriteEvent Ifx_BenchPipe_getWriteEvent(Ifx_BenchPipe *pipe)
+{
+    return &pipe->tx->eventWriter;
+}
+
+
+static boolean Ifx_BenchPipe_canReadCount(Ifx_BenchPipe *pipe, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    return Ifx_Fifo_canReadCount(pipe->rx, count, timeout);
+}
+
+
+static boolean Ifx_BenchPipe_canWriteCount(Ifx_BenchPipe *pipe, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    return Ifx_Fifo_canWriteCount(pipe->tx, count, timeout);
+}
+
+
+static boolean Ifx_BenchPipe_flushTx(Ifx_BenchPipe *pipe, Ifx_TickTime timeout)
+{
+    (void)timeout;
+    Ifx_BenchPipe_drain(pipe);
+
+    return TRUE;
+}
+
+
+static void Ifx_BenchPipe_clearTx(Ifx_BenchPipe *pipe)
+{
+    Ifx_Fifo_clear(pipe->tx);
+}
+
+
+static void Ifx_BenchPipe_clearRx(Ifx_BenchPipe *pipe)
+{
+    Ifx_Fifo_clear(pipe->rx);
+}
+
+
+static void Ifx_BenchPipe_onEvent(Ifx_BenchPipe *pipe)
+{
+    (void)pipe;
+}
+
+
+static uint32 Ifx_BenchPipe_getSendCount(Ifx_BenchPipe *pipe)
+{
+    return pipe->sendCount;
+}
+
+
+static Ifx_TickTime Ifx_BenchPipe_getTxTimeStamp(Ifx_BenchPipe *pipe)
+{
+    return pipe->txTimestamp;
+}
+
+
+static void Ifx_BenchPipe_resetSendCount(Ifx_BenchPipe *pipe)
+{
+    pipe->sendCount = 0;
+}
+
+
+boolean Ifx_BenchPipe_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_BenchPipe *pipe)
+{
+    pipe->rx          = Ifx_Fifo_init(pipe->rxBuffer, IFX_BENCHPIPE_BUFFER_SIZE, 1);
+    pipe->tx          = Ifx_Fifo_init(pipe->txBuffer, IFX_BENCHPIPE_BUFFER_SIZE, 1);
+    pipe->sendCount   = 0;
+    pipe->txTimestamp = 0;
+
+    /* Ensure the stdif is reset to zeros */
+    memset(stdif, 0, sizeof(IfxStdIf_DPipe));
+
+    /* Set the API link */
+    stdif->driver         = pipe;
+    stdif->write          = (IfxStdIf_DPipe_Write) & Ifx_BenchPipe_write;
+    stdif->read           = (IfxStdIf_DPipe_Read) & Ifx_BenchPipe_read;
+    stdif->getReadCount   = (IfxStdIf_DPipe_GetReadCount) & Ifx_BenchPipe_getReadCount;
+    stdif->getReadEvent   = (IfxStdIf_DPipe_GetReadEvent) & Ifx_BenchPipe_getReadEvent;
+    stdif->getWriteCount  = (IfxStdIf_DPipe_GetWriteCount) & Ifx_BenchPipe_getWriteCount;
+    stdif->getWriteEvent  = (IfxStdIf_DPipe_GetWriteEvent) & Ifx_BenchPipe_getWriteEvent;
+    stdif->canReadCount   = (IfxStdIf_DPipe_CanReadCount) & Ifx_BenchPipe_canReadCount;
+    stdif->canWriteCount  = (IfxStdIf_DPipe_CanWriteCount) & Ifx_BenchPipe_canWriteCount;
+    stdif->flushTx        = (IfxStdIf_DPipe_FlushTx) & Ifx_BenchPipe_flushTx;
+    stdif->clearTx        = (IfxStdIf_DPipe_ClearTx) & Ifx_BenchPipe_clearTx;
+    stdif->clearRx        = (IfxStdIf_DPipe_ClearRx) & Ifx_BenchPipe_clearRx;
+    stdif->onReceive      = (IfxStdIf_DPipe_OnReceive) & Ifx_BenchPipe_onEvent;
+    stdif->onTransmit     = (IfxStdIf_DPipe_OnTransmit) & Ifx_BenchPipe_onEvent;
+    stdif->onError        = (IfxStdIf_DPipe_OnError) & Ifx_BenchPipe_onEvent;
+    stdif->getSendCount   = (IfxStdIf_DPipe_GetSendCount) & Ifx_BenchPipe_getSendCount;
+    stdif->getTxTimeStamp = (IfxStdIf_DPipe_GetTxTimeStamp) & Ifx_BenchPipe_getTxTimeStamp;
+    stdif->resetSendCount = (IfxStdIf_DPipe_ResetSendCount) & Ifx_BenchPipe_resetSendCount;
+    stdif->txDisabled     = FALSE;
+
+    return TRUE;
+}
+
+
+Ifx_SizeT Ifx_BenchPipe_inject(Ifx_BenchPipe *pipe, const void *data, Ifx_SizeT count)
+{
+    return Ifx_Fifo_write(pipe->rx, data, count, TIME_NULL);
+}
+
+
+Ifx_SizeT Ifx_BenchPipe_drain(Ifx_BenchPipe *pipe)
+{
+    Ifx_SizeT count = Ifx_Fifo_readCount(pipe->tx);
+
+    Ifx_Fifo_clear(pipe->tx);
+
+    return count;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file Ifx_BenchPipe.h
+ * \brief Host loopback driver for the IfxStdIf_DPipe standard interface.
+ *
+ * The driver replaces the ASCLIN driver in the host build. Data written through
+ * the standard interface is stored in the tx FIFO, data read through the
+ * standard interface is taken from the rx FIFO. The benchmark feeds the rx FIFO
+ * with Ifx_BenchPipe_inject() and drains the tx FIFO with Ifx_BenchPipe_drain().
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#ifndef IFX_BENCHPIPE_H
+#define IFX_BENCHPIPE_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxStdIf_DPipe.h"
+#include "Ifx_Fifo.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFX_BENCHPIPE_BUFFER_SIZE (4096)   /**< \brief Size of the rx and tx FIFO in bytes */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Loopback driver object */
+typedef struct
+{
+    Ifx_Fifo    *rx;          /**< \brief Data read by the standard interface */
+    Ifx_Fifo    *tx;          /**< \brief Data written by the standard interface */
+    uint32       sendCount;   /**< \brief Number of bytes written */
+    Ifx_TickTime txTimestamp; /**< \brief Time of the last write */
+    uint64       rxBuffer[(IFX_BENCHPIPE_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8) / sizeof(uint64)];
+    uint64       txBuffer[(IFX_BENCHPIPE_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8) / sizeof(uint64)];
+} Ifx_BenchPipe;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialize the loopback driver and its standard interface
+ * \param stdif standard interface object, will be initialized by the function
+ * \param pipe driver object
+ * \return TRUE on success
+ */
+IFX_EXTERN boolean Ifx_BenchPipe_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_BenchPipe *pipe);
+
+/** \brief Append \p count bytes to the rx FIFO, as if received from the line
+ * \return number of bytes that could not be injected
+ */
+IFX_EXTERN Ifx_SizeT Ifx_BenchPipe_inject(Ifx_BenchPipe *pipe, const void *data, Ifx_SizeT count);
+
+/** \brief Discard the content of the tx FIFO, as if sent on the line
+ * \return number of bytes discarded
+ */
+IFX_EXTERN Ifx_SizeT Ifx_BenchPipe_drain(Ifx_BenchPipe *pipe);
+
+#endif /* IFX_BENCHPIPE_H */
@@ -0,0 +1,654 @@
+/**
+ * \file Ifx_Bench_Comm.c
+ * \brief Benchmark cases of the SysSe/Comm modules.
+ *
+ * The Shell and the Console are connected to an \ref Ifx_BenchPipe, the
+ * produced output is discarded after each operation.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_Bench.h"
+#include "Ifx_BenchPipe.h"
+#include "Ifx_BatchProtocol.h"
+#include "Ifx_Capture.h"
+#include "Ifx_Console.h"
+#include "Ifx_Log.h"
+#include "Ifx_Shell.h"
+#include "Ifx_Telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+static boolean Ifx_Bench_Comm_command(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+static Ifx_BenchPipe     Ifx_Bench_Comm_pipe;
+static IfxStdIf_DPipe    Ifx_Bench_Comm_io;
+static Ifx_Shell         Ifx_Bench_Comm_shell;
+static Ifx_Telemetry     Ifx_Bench_Comm_telemetry;
+static sint32            Ifx_Bench_Comm_speedChannel;
+static sint32            Ifx_Bench_Comm_currentChannel;
+static Ifx_Capture       Ifx_Bench_Comm_capture;
+static sint16            Ifx_Bench_Comm_captureBuffer[256];
+static Ifx_TickTime      Ifx_Bench_Comm_captureTimestamps[256 / IFX_CAPTURE_FRAME_SIZE];
+static sint32            Ifx_Bench_Comm_captureChannel;
+static Ifx_BatchProtocol Ifx_Bench_Comm_batch;
+static uint32            Ifx_Bench_Comm_calibration[16];
+static uint8             Ifx_Bench_Comm_writeFrame[IFX_BATCHPROTOCOL_MAX_FRAME_SIZE];
+static Ifx_SizeT         Ifx_Bench_Comm_writeFrameSize;
+static uint8             Ifx_Bench_Comm_readFrame[IFX_BATCHPROTOCOL_MAX_FRAME_SIZE];
+static Ifx_SizeT         Ifx_Bench_Comm_readFrameSize;
+
+/** \brief Same content as the Ifx_Console_print case: speed and position */
+static const Ifx_Telemetry_ChannelConfig Ifx_Bench_Comm_speedConfig   = {"speed", Ifx_Telemetry_Type_sint32, 2, TRUE};
+/** \brief Phase currents as returned by the ADC */
+static const Ifx_Telemetry_ChannelConfig Ifx_Bench_Comm_currentConfig = {"current", Ifx_Telemetry_Type_float32, 3, FALSE};
+
+/** \brief Command list similar to the one of the application shell */
+static const Ifx_Shell_Command Ifx_Bench_Comm_commands[] = {
+    {"status",       "   : Show the application status",  NULL_PTR, &Ifx_Bench_Comm_command},
+    {"info",         "     : Show the welcome screen",     NULL_PTR, &Ifx_Bench_Comm_command},
+    {"help",         "     : Show the help",               NULL_PTR, &Ifx_Bench_Comm_command},
+    {"adc start",    ": Start the ADC conversion",         NULL_PTR, &Ifx_Bench_Comm_command},
+    {"adc stop",     " : Stop the ADC conversion",         NULL_PTR, &Ifx_Bench_Comm_command},
+    {"adc show",     " : Show the ADC results",            NULL_PTR, &Ifx_Bench_Comm_command},
+    {"pwm duty",     " : Set the PWM duty cycle",          NULL_PTR, &Ifx_Bench_Comm_command},
+    {"pwm freq",     " : Set the PWM frequency",           NULL_PTR, &Ifx_Bench_Comm_command},
+    {"pwm start",    ": Start the PWM",                    NULL_PTR, &Ifx_Bench_Comm_command},
+    {"pwm stop",     " : Stop the PWM",                    NULL_PTR, &Ifx_Bench_Comm_command},
+    {"resolver show", ": Show the resolver position",      NULL_PTR, &Ifx_Bench_Comm_command},
+    {"resolver gain", ": Set the resolver observer gains", NULL_PTR, &Ifx_Bench_Comm_command},
+    {"can send",     " : Send a CAN message",              NULL_PTR, &Ifx_Bench_Comm_command},
+    {"can show",     " : Show the CAN counters",           NULL_PTR, &Ifx_Bench_Comm_command},
+    {"mem read",     " : Read a memory location",          NULL_PTR, &Ifx_Bench_Comm_command},
+    {"mem write",    ": Write a memory location",          NULL_PTR, &Ifx_Bench_Comm_command},
+    IFX_SHELL_COMMAND_LIST_END
+};
+
+static const char Ifx_Bench_Comm_lastCommand[]  = "mem write 0x70000000 1234";
+static const char Ifx_Bench_Comm_commandInput[] = "mem write 0x70000000 1234\r";
+
+/** \brief Scripted session: commands of different lengths, each one added to the history */
+static pchar const Ifx_Bench_Comm_script[] = {
+    "status\r",
+    "adc start\r",
+    "pwm duty 0x40000000\r",
+    "pwm freq 20000\r",
+    "pwm start\r",
+    "resolver gain 0x3F800000 0x40000000 0x40400000\r",
+    "mem read 0x70000000\r",
+    "mem write 0x70000000 0x12345678\r",
+    "can send 0x123 0x0102030405060708\r",
+    "adc show\r",
+    "pwm stop\r",
+    "info\r",
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+static boolean Ifx_Bench_Comm_command(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    uint32 value;
+
+    (void)data;
+    (void)io;
+
+    return Ifx_Shell_parseUInt32(&args, &value, TRUE);
+}
+
+
+static void Ifx_Bench_Comm_setup(void)
+{
+    Ifx_Shell_Config         config;
+    Ifx_Telemetry_Config     telemetryConfig;
+    Ifx_BatchProtocol_Config batchConfig;
+
+    Ifx_BenchPipe_stdIfDPipeInit(&Ifx_Bench_Comm_io, &Ifx_Bench_Comm_pipe);
+
+    /* Requests relative to the calibration table */
+    Ifx_BatchProtocol_initConfig(&batchConfig, &Ifx_Bench_Comm_shell);
+    batchConfig.addressBase = Ifx_Bench_Comm_calibration;
+    Ifx_BatchProtocol_init(&Ifx_Bench_Comm_batch, &batchConfig);
+
+    Ifx_Shell_initConfig(&config);
+    Ifx_BatchProtocol_initShellConfig(&Ifx_Bench_Comm_batch, &config);
+    config.standardIo     = &Ifx_Bench_Comm_io;
+    config.commandList[0] = Ifx_Bench_Comm_commands;
+    config.echo           = FALSE;
+    config.showPrompt     = FALSE;
+    Ifx_Shell_init(&Ifx_Bench_Comm_shell, &config);
+
+    Ifx_Console_init(&Ifx_Bench_Comm_io);
+    Ifx_Log_init(&Ifx_Bench_Comm_io);
+
+    Ifx_Telemetry_initConfig(&telemetryConfig, &Ifx_Bench_Comm_io);
+    Ifx_Telemetry_init(&Ifx_Bench_Comm_telemetry, &telemetryConfig);
+    Ifx_Bench_Comm_speedChannel   = Ifx_Telemetry_addChannel(&Ifx_Bench_Comm_telemetry, &Ifx_Bench_Comm_speedConfig);
+    Ifx_Bench_Comm_currentChannel = Ifx_Telemetry_addChannel(&Ifx_Bench_Comm_telemetry, &Ifx_Bench_Comm_currentConfig);
+    Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+}
+
+
+/** \brief Stop the bench with a message if a capture check fails */
+static void Ifx_Bench_Comm_checkCaptureResult(boolean ok, pchar check)
+{
+    if (ok == FALSE)
+    {
+        fprintf(stderr, "Ifx_Capture: %s check failed\n", check);
+        exit(1);
+    }
+}
+
+
+/** \brief Check the failed initialisation, the limits, the decimation, the statistics and the ring buffer wrap */
+static void Ifx_Bench_Comm_checkCapture(void)
+{
+    static const sint16    results[] = {10, 20, 30, 40, 200, -50, -50, -50, -50, -101};
+    Ifx_Capture            capture;
+    Ifx_Capture_Config     config;
+    Ifx_Capture_Statistics statistics;
+    sint16                 samples[2 * IFX_CAPTURE_FRAME_SIZE];
+    uint32                 size = 2 * IFX_CAPTURE_FRAME_SIZE;
+    uint32                 i;
+    boolean                ok;
+
+    /* Buffer smaller than a frame: nothing is stored, read nor exported */
+    Ifx_Capture_initConfig(&config, Ifx_Bench_Comm_captureBuffer, NULL_PTR, IFX_CAPTURE_FRAME_SIZE / 2);
+    ok = Ifx_Capture_init(&capture, &config) == FALSE;
+    Ifx_Capture_add(&capture, 1);
+    ok = ok && (Ifx_Capture_getCount(&capture) == 0) && (capture.overflows == 1);
+    ok = ok && (Ifx_Capture_read(&capture, samples, size) == 0);
+    ok = ok && (Ifx_Capture_export(&capture, &Ifx_Bench_Comm_telemetry, Ifx_Bench_Comm_captureChannel) == 0);
+    Ifx_Bench_Comm_checkCaptureResult(ok, "failed initialisation");
+
+    /* Limits -100 .. 100, averaged by 4 */
+    Ifx_Capture_initConfig(&config, Ifx_Bench_Comm_captureBuffer, NULL_PTR, (uint16)size);
+    config.decimation = 4;
+    config.lowerLimit = -100;
+    config.upperLimit = 100;
+    ok                = Ifx_Capture_init(&capture, &config);
+    Ifx_Capture_addBlock(&capture, results, sizeof(results) / sizeof(results[0]));
+    Ifx_Capture_getStatistics(&capture, &statistics);
+    ok = ok && (capture.rejected == 2) && (statistics.count == 8) && (statistics.min == -50) && (statistics.max == 40);
+    ok = ok && (statistics.sum == -100) && (statistics.sumOfSquares == 13000);
+    ok = ok && (Ifx_Capture_read(&capture, samples, size) == 2) && (samples[0] == 25) && (samples[1] == -50);
+    Ifx_Bench_Comm_checkCaptureResult(ok, "statistics and decimation");
+
+    /* Overflow, then wrap of the ring buffer */
+    config.decimation = 1;
+    config.lowerLimit = -32768;
+    config.upperLimit = 32767;
+    ok                = Ifx_Capture_init(&capture, &config);
+
+    for (i = 0; i < (size + 5); i++)
+    {
+        Ifx_Capture_add(&capture, (sint16)i);
+    }
+
+    ok = ok && (Ifx_Capture_getCount(&capture) == size) && (capture.overflows == 5);
+    ok = ok && (Ifx_Capture_read(&capture, samples, size / 2) == (size / 2));
+
+    for (i = 0; i < (size / 2); i++)
+    {
+        ok = ok && (samples[i] == (sint16)i);
+        Ifx_Capture_add(&capture, (sint16)(1000 + i));
+    }
+
+    ok = ok && (Ifx_Capture_read(&capture, samples, size) == size);
+
+    for (i = 0; i < size; i++)
+    {
+        ok = ok && (samples[i] == (sint16)((i < (size / 2)) ? ((size / 2) + i) : (1000 + i - (size / 2))));
+    }
+
+    ok = ok && (Ifx_Capture_getCount(&capture) == 0) && (capture.overflows == 5);
+    Ifx_Bench_Comm_checkCaptureResult(ok, "ring buffer");
+}
+
+
+static void Ifx_Bench_Comm_setupCapture(void)
+{
+    Ifx_Capture_Config config;
+
+    Ifx_Bench_Comm_setup();
+
+    /* DSADC results averaged by 4, as the resolver demo */
+    Ifx_Capture_initConfig(&config, Ifx_Bench_Comm_captureBuffer, Ifx_Bench_Comm_captureTimestamps, 256);
+    config.decimation = 4;
+    Ifx_Capture_init(&Ifx_Bench_Comm_capture, &config);
+    Ifx_Bench_Comm_captureChannel = Ifx_Capture_addChannel(&Ifx_Bench_Comm_capture, &Ifx_Bench_Comm_telemetry, "dsadc");
+    Ifx_Bench_Comm_checkCapture();
+    Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+}
+
+
+/**
+ * \brief Build a framed request packet of 16 reads or writes of the calibration table
+ * \return Frame size in bytes
+ */
+static Ifx_SizeT Ifx_Bench_Comm_buildBatchFrame(uint8 *frame, Ifx_BatchProtocol_Opcode opcode)
+{
+    uint8     packet[IFX_CFG_BATCHPROTOCOL_PACKET_SIZE];
+    Ifx_SizeT length = 0;
+    uint16    crc;
+    uint32    i;
+
+    packet[length++] = IFX_BATCHPROTOCOL_PACKET_REQUEST;
+    packet[length++] = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        packet[length++] = (uint8)opcode;
+        packet[length++] = (uint8)(i * 4);
+        packet[length++] = 0;
+        packet[length++] = 0;
+        packet[length++] = 0;
+        packet[length++] = 4;
+
+        if (opcode == Ifx_BatchProtocol_Opcode_write)
+        {
+            packet[length++] = (uint8)(0x10 + i);
+            packet[length++] = 0x32;
+            packet[length++] = 0x54;
+            packet[length++] = 0x76;
+        }
+    }
+
+    crc              = Ifx_BatchProtocol_crc16(packet, length);
+    packet[length++] = (uint8)crc;
+    packet[length++] = (uint8)(crc >> 8);
+
+    return Ifx_Telemetry_encodeCobs(frame, packet, length);
+}
+
+
+/**
+ * \brief Send a request frame and check the response: framing, CRC, status of the packet and of the 16 requests
+ * \param frame Request frame
+ * \param size Request frame size in bytes
+ * \param data Expected data of the 16 reads, NULL_PTR for writes
+ * \param check Name of the check, printed on failure
+ */
+static void Ifx_Bench_Comm_checkBatch(const uint8 *frame, Ifx_SizeT size, const uint32 *data, pchar check)
+{
+    uint8     response[IFX_BATCHPROTOCOL_MAX_FRAME_SIZE];
+    uint8     value[4];
+    Ifx_SizeT length;
+    uint16    crc;
+    uint32    i;
+    Ifx_SizeT result = (data != NULL_PTR) ? 5 : 1;
+    boolean   ok;
+
+    Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, frame, size);
+    Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+    length = Ifx_Fifo_readCount(Ifx_Bench_Comm_pipe.tx);
+    ok     = (length > 0) && (length <= (Ifx_SizeT)sizeof(response));
+    ok     = ok && (Ifx_Fifo_read(Ifx_Bench_Comm_pipe.tx, response, length, TIME_NULL) == 0) && (response[length - 1] == 0);
+    length = ok ? Ifx_Telemetry_decodeCobs(response, response, length - 1) : -1;
+    ok     = ok && (length == (Ifx_SizeT)(3 + (16 * result) + 2));
+
+    if (ok != FALSE)
+    {
+        crc = Ifx_BatchProtocol_crc16(response, length - 2);
+        ok  = (response[length - 2] == (uint8)crc) && (response[length - 1] == (uint8)(crc >> 8));
+        ok  = ok && (response[0] == IFX_BATCHPROTOCOL_PACKET_RESPONSE) && (response[1] == 0) && (response[2] == Ifx_BatchProtocol_Status_ok);
+
+        for (i = 0; ok && (i < 16); i++)
+        {
+            ok = (response[3 + (i * result)] == Ifx_BatchProtocol_Status_ok);
+
+            if (data != NULL_PTR)
+            {
+                value[0] = (uint8)data[i];
+                value[1] = (uint8)(data[i] >> 8);
+                value[2] = (uint8)(data[i] >> 16);
+                value[3] = (uint8)(data[i] >> 24);
+                ok       = ok && (memcmp(&response[4 + (i * result)], value, 4) == 0);
+            }
+        }
+    }
+
+    if (ok == FALSE)
+    {
+        fprintf(stderr, "Ifx_BatchProtocol: %s check failed\n", check);
+        exit(1);
+    }
+}
+
+
+static void Ifx_Bench_Comm_setupBatch(void)
+{
+    uint32 expected[16];
+    uint32 i;
+
+    Ifx_Bench_Comm_setup();
+
+    Ifx_Bench_Comm_writeFrameSize = Ifx_Bench_Comm_buildBatchFrame(Ifx_Bench_Comm_writeFrame, Ifx_BatchProtocol_Opcode_write);
+    Ifx_Bench_Comm_readFrameSize  = Ifx_Bench_Comm_buildBatchFrame(Ifx_Bench_Comm_readFrame, Ifx_BatchProtocol_Opcode_read);
+
+    /* "protocol start" from the text shell, then the 0 byte synchronizing the receiver */
+    Ifx_Shell_protocolStart("start", &Ifx_Bench_Comm_shell, &Ifx_Bench_Comm_io);
+    Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, "", 1);
+    Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+    Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+
+    /* the writes reach the calibration table, the reads return it */
+    memset(Ifx_Bench_Comm_calibration, 0, sizeof(Ifx_Bench_Comm_calibration));
+
+    for (i = 0; i < 16; i++)
+    {
+        expected[i] = 0x76543210U + i;
+    }
+
+    Ifx_Bench_Comm_checkBatch(Ifx_Bench_Comm_writeFrame, Ifx_Bench_Comm_writeFrameSize, NULL_PTR, "write response");
+
+    if (memcmp(Ifx_Bench_Comm_calibration, expected, sizeof(expected)) != 0)
+    {
+        fprintf(stderr, "Ifx_BatchProtocol: calibration table check failed\n");
+        exit(1);
+    }
+
+    Ifx_Bench_Comm_checkBatch(Ifx_Bench_Comm_readFrame, Ifx_Bench_Comm_readFrameSize, expected, "read response");
+}
+
+
+static void Ifx_Bench_Comm_runShellProcess(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, Ifx_Bench_Comm_commandInput, sizeof(Ifx_Bench_Comm_commandInput) - 1);
+        Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runShellScript(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+    pchar  line;
+
+    for (i = 0; i < iterations; i++)
+    {
+        line = Ifx_Bench_Comm_script[i % (sizeof(Ifx_Bench_Comm_script) / sizeof(Ifx_Bench_Comm_script[0]))];
+        Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, line, (Ifx_SizeT)strlen(line));
+        Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runBatchWrite(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, Ifx_Bench_Comm_writeFrame, Ifx_Bench_Comm_writeFrameSize);
+        Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent + Ifx_Bench_Comm_calibration[15];
+}
+
+
+static void Ifx_Bench_Comm_runBatchRead(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BenchPipe_inject(&Ifx_Bench_Comm_pipe, Ifx_Bench_Comm_readFrame, Ifx_Bench_Comm_readFrameSize);
+        Ifx_Shell_process(&Ifx_Bench_Comm_shell);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runCommandFind(uint32 iterations)
+{
+    uint32 i;
+    pchar  args = NULL_PTR;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Bench_g_sink = (uint32)(Ifx_Shell_commandFind(Ifx_Bench_Comm_commands, Ifx_Bench_Comm_lastCommand, &args) != NULL_PTR);
+    }
+}
+
+
+static void Ifx_Bench_Comm_runCommandListFind(uint32 iterations)
+{
+    uint32 i;
+    pchar  args = NULL_PTR;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Bench_g_sink = (uint32)(Ifx_Shell_commandListFind(&Ifx_Bench_Comm_shell, Ifx_Bench_Comm_lastCommand, &args) != NULL_PTR);
+    }
+}
+
+
+static void Ifx_Bench_Comm_runParseUInt32(uint32 iterations)
+{
+    uint32 i;
+    uint32 sum = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        pchar  args = "0x70000000";
+        uint32 value;
+        Ifx_Shell_parseUInt32(&args, &value, TRUE);
+        sum        += value;
+    }
+
+    Ifx_Bench_g_sink = sum;
+}
+
+
+static void Ifx_Bench_Comm_runParseFloat32(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        pchar   args = "1.25e-3";
+        float32 value;
+        Ifx_Shell_parseFloat32(&args, &value);
+        sum         += value;
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Comm_runConsolePrint(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Console_print("speed=%d rpm, position=%d" ENDL, (int)i, (int)(i * 3));
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runLogWrite(uint32 iterations)
+{
+    uint32 i;
+    uint32 stored = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        stored += Ifx_Log_write("speed=%d rpm, position=%d" ENDL, 2, i, i * 3);
+
+        if ((i & 31) == 31)
+        {
+            /* Keep the ring from overflowing, without formatting */
+            Ifx_Fifo_clear(Ifx_g_log.ring[0].fifo);
+        }
+    }
+
+    Ifx_Bench_g_sink = stored;
+}
+
+
+static void Ifx_Bench_Comm_runLogProcess(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Log_write("speed=%d rpm, position=%d" ENDL, 2, i, i * 3);
+        Ifx_Log_process();
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runTelemetryDelta(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sint32 values[2] = {(sint32)i, (sint32)(i * 3)};
+        Ifx_Telemetry_write(&Ifx_Bench_Comm_telemetry, Ifx_Bench_Comm_speedChannel, values);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runTelemetryFloat(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        float32 values[3] = {(float32)i, -0.5f * (float32)i, -0.5f * (float32)i};
+        Ifx_Telemetry_write(&Ifx_Bench_Comm_telemetry, Ifx_Bench_Comm_currentChannel, values);
+        sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+static void Ifx_Bench_Comm_runCaptureAdd(uint32 iterations)
+{
+    Ifx_Capture_Statistics statistics;
+    uint32                 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Capture_add(&Ifx_Bench_Comm_capture, (sint16)((i * 37) & 0x3FFF));
+
+        if ((i & 255) == 255)
+        {
+            /* Keep the ring buffer from overflowing */
+            Ifx_Capture_clear(&Ifx_Bench_Comm_capture);
+        }
+    }
+
+    Ifx_Capture_getStatistics(&Ifx_Bench_Comm_capture, &statistics);
+    Ifx_Bench_g_sinkF32 = Ifx_Capture_Statistics_getRms(&statistics);
+}
+
+
+static void Ifx_Bench_Comm_runCaptureExport(uint32 iterations)
+{
+    uint32 i;
+    uint32 sent = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Capture_add(&Ifx_Bench_Comm_capture, (sint16)((i * 37) & 0x3FFF));
+
+        if ((i & 31) == 31)
+        {
+            Ifx_Capture_export(&Ifx_Bench_Comm_capture, &Ifx_Bench_Comm_telemetry, Ifx_Bench_Comm_captureChannel);
+            sent += Ifx_BenchPipe_drain(&Ifx_Bench_Comm_pipe);
+        }
+    }
+
+    Ifx_Bench_g_sink = sent;
+}
+
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+const Ifx_Bench_Case Ifx_Bench_g_commCases[] = {
+    {"Ifx_Shell_process",                    Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runShellProcess},
+    {"Ifx_Shell_process(script)",            Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runShellScript },
+    {"Ifx_Shell_commandFind(16)",            Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runCommandFind },
+    {"Ifx_Shell_commandListFind(16)",        Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runCommandListFind},
+    {"Ifx_BatchProtocol_execute(16 writes)", Ifx_Bench_Comm_setupBatch, Ifx_Bench_Comm_runBatchWrite},
+    {"Ifx_BatchProtocol_execute(16 reads)",  Ifx_Bench_Comm_setupBatch, Ifx_Bench_Comm_runBatchRead },
+    {"Ifx_Shell_parseUInt32",                Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runParseUInt32 },
+    {"Ifx_Shell_parseFloat32",               Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runParseFloat32},
+    {"Ifx_Console_print",                    Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runConsolePrint},
+    {"Ifx_Log_write",                        Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runLogWrite     },
+    {"Ifx_Log_write+process",                Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runLogProcess   },
+    {"Ifx_Telemetry_write(sint32x2,delta)",  Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runTelemetryDelta},
+    {"Ifx_Telemetry_write(float32x3)",       Ifx_Bench_Comm_setup, Ifx_Bench_Comm_runTelemetryFloat},
+    {"Ifx_Capture_add(dec4)",                Ifx_Bench_Comm_setupCapture, Ifx_Bench_Comm_runCaptureAdd   },
+    {"Ifx_Capture_add+export(dec4)",         Ifx_Bench_Comm_setupCapture, Ifx_Bench_Comm_runCaptureExport},
+    IFX_BENCH_CASE_LIST_END
+};
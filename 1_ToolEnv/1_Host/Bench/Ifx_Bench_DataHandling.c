@@ -0,0 +1,557 @@
+/**
+ * \file Ifx_Bench_DataHandling.c
+ * \brief Benchmark cases of the _Lib/DataHandling modules.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_Bench.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Ifx_CircularBuffer.h"
+#include "Ifx_Fifo.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFX_BENCH_DATAHANDLING_FIFO_SIZE   (1024)  /**< \brief Size of the benchmarked FIFO in bytes */
+#define IFX_BENCH_DATAHANDLING_BLOCK_SIZE  (256)   /**< \brief Largest block transferred in one call */
+#define IFX_BENCH_DATAHANDLING_STRESS_SIZE (64)    /**< \brief Bytes transferred per operation of the two thread cases */
+#define IFX_BENCH_DATAHANDLING_BULK_SIZE   (8192)  /**< \brief Size of the circular buffer of the bulk copy cases in bytes */
+#define IFX_BENCH_DATAHANDLING_BULK_BLOCK  (4096)  /**< \brief Largest block of the bulk copy cases */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+static uint64             Ifx_Bench_DataHandling_fifoBuffer[(IFX_BENCH_DATAHANDLING_FIFO_SIZE + sizeof(Ifx_Fifo) + 8) / sizeof(uint64)];
+static uint32             Ifx_Bench_DataHandling_circularBuffer[IFX_BENCH_DATAHANDLING_FIFO_SIZE / sizeof(uint32)];
+static uint32             Ifx_Bench_DataHandling_block[IFX_BENCH_DATAHANDLING_BLOCK_SIZE / sizeof(uint32)];
+static Ifx_Fifo          *Ifx_Bench_DataHandling_fifo;
+static Ifx_CircularBuffer Ifx_Bench_DataHandling_circular;
+static uint64             Ifx_Bench_DataHandling_bulkBuffer[IFX_BENCH_DATAHANDLING_BULK_SIZE / sizeof(uint64)];
+static uint64             Ifx_Bench_DataHandling_bulkBlock[(IFX_BENCH_DATAHANDLING_BULK_BLOCK + 8) / sizeof(uint64)];
+static uint64             Ifx_Bench_DataHandling_bulkCheck[(IFX_BENCH_DATAHANDLING_BULK_BLOCK + 8) / sizeof(uint64)];
+static Ifx_CircularBuffer Ifx_Bench_DataHandling_bulk;
+
+/** \brief Producer of the two thread cases */
+typedef struct
+{
+    Ifx_Fifo *fifo;         /**< \brief FIFO under test */
+    uint32    count;        /**< \brief Number of bytes to write */
+} Ifx_Bench_DataHandling_Producer;
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+static void Ifx_Bench_DataHandling_setup(void)
+{
+    uint32 i;
+
+    for (i = 0; i < Ifx_COUNTOF(Ifx_Bench_DataHandling_block); i++)
+    {
+        Ifx_Bench_DataHandling_block[i] = i * 0x01010101UL;
+    }
+
+    Ifx_Bench_DataHandling_fifo            = Ifx_Fifo_init(Ifx_Bench_DataHandling_fifoBuffer, IFX_BENCH_DATAHANDLING_FIFO_SIZE, 1);
+
+    Ifx_Bench_DataHandling_circular.base   = Ifx_Bench_DataHandling_circularBuffer;
+    Ifx_Bench_DataHandling_circular.index  = 0;
+    Ifx_Bench_DataHandling_circular.length = IFX_BENCH_DATAHANDLING_FIFO_SIZE;
+
+    Ifx_CircularBuffer_setBulkCopy(NULL_PTR, NULL_PTR, IFX_CFG_CIRCULARBUFFER_BULK_THRESHOLD);
+}
+
+
+/** \brief One write followed by one read of \p count bytes, the FIFO is empty before and after */
+IFX_INLINE void Ifx_Bench_DataHandling_runFifo(uint32 iterations, Ifx_SizeT count)
+{
+    uint32 i;
+    uint32 missing = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        missing += Ifx_Fifo_write(Ifx_Bench_DataHandling_fifo, Ifx_Bench_DataHandling_block, count, TIME_NULL);
+        missing += Ifx_Fifo_read(Ifx_Bench_DataHandling_fifo, Ifx_Bench_DataHandling_block, count, TIME_NULL);
+    }
+
+    Ifx_Bench_g_sink = missing;
+}
+
+
+static void Ifx_Bench_DataHandling_runFifo1(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runFifo(iterations, 1);
+}
+
+
+static void Ifx_Bench_DataHandling_runFifo16(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runFifo(iterations, 16);
+}
+
+
+static void Ifx_Bench_DataHandling_runFifo256(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runFifo(iterations, 256);
+}
+
+
+/** \brief Same transfer as Ifx_Bench_DataHandling_runFifo(), the data are copied in and out of the ring in place */
+IFX_INLINE void Ifx_Bench_DataHandling_runFifoInPlace(uint32 iterations, Ifx_SizeT count)
+{
+    uint32        i;
+    uint32        sum = 0;
+    Ifx_Fifo_Span span[2];
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_SizeT length = Ifx_Fifo_reserveWrite(Ifx_Bench_DataHandling_fifo, span, count);
+        memcpy(span[0].data, Ifx_Bench_DataHandling_block, span[0].length);
+        memcpy(span[1].data, &((uint8 *)Ifx_Bench_DataHandling_block)[span[0].length], span[1].length);
+        Ifx_Fifo_commitWrite(Ifx_Bench_DataHandling_fifo, length);
+
+        length = Ifx_Fifo_peekRead(Ifx_Bench_DataHandling_fifo, span, count);
+        sum   += ((uint8 *)span[0].data)[0];
+        Ifx_Fifo_consumeRead(Ifx_Bench_DataHandling_fifo, length);
+    }
+
+    Ifx_Bench_g_sink = sum;
+}
+
+
+static void Ifx_Bench_DataHandling_runFifoInPlace16(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runFifoInPlace(iterations, 16);
+}
+
+
+static void Ifx_Bench_DataHandling_runFifoInPlace256(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runFifoInPlace(iterations, 256);
+}
+
+
+static void Ifx_Bench_DataHandling_runFifoCounts(uint32 iterations)
+{
+    uint32 i;
+    uint32 sum = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += Ifx_Fifo_readCount(Ifx_Bench_DataHandling_fifo);
+        sum += Ifx_Fifo_canWriteCount(Ifx_Bench_DataHandling_fifo, 16, TIME_NULL);
+    }
+
+    Ifx_Bench_g_sink = sum;
+}
+
+
+static void Ifx_Bench_DataHandling_setupSpsc(void)
+{
+    Ifx_Bench_DataHandling_setup();
+    Ifx_Bench_DataHandling_fifo = Ifx_Fifo_initMode(Ifx_Bench_DataHandling_fifoBuffer, IFX_BENCH_DATAHANDLING_FIFO_SIZE, 1, Ifx_Fifo_Mode_spsc);
+}
+
+
+/** \brief Producer thread, emulates the receive ISR: writes an incrementing byte sequence in blocks of 1..31 bytes
+ *
+ * Blocks which do not fit completely are partially written and the rest is sent again.
+ */
+static void *Ifx_Bench_DataHandling_produce(void *arg)
+{
+    Ifx_Bench_DataHandling_Producer *producer = (Ifx_Bench_DataHandling_Producer *)arg;
+    uint8                            block[32];
+    uint32                           sent     = 0;
+    uint32                           i;
+
+    IfxCpu_Host_setCoreIndex(IfxCpu_ResourceCpu_1);
+
+    while (sent < producer->count)
+    {
+        Ifx_SizeT blockSize = (Ifx_SizeT)__minu((sent % 31) + 1, producer->count - sent);
+
+        for (i = 0; i < (uint32)blockSize; i++)
+        {
+            block[i] = (uint8)(sent + i);
+        }
+
+        blockSize -= Ifx_Fifo_write(producer->fifo, block, blockSize, TIME_NULL);
+        sent      += blockSize;
+
+        if (blockSize == 0)
+        {
+            sched_yield();      /* FIFO full, let the reader run on hosts with few cores */
+        }
+    }
+
+    return NULL_PTR;
+}
+
+
+/** \brief Check that block holds the sequence starting at received */
+static void Ifx_Bench_DataHandling_check(const uint8 *block, Ifx_SizeT count, uint32 received)
+{
+    uint32 i;
+
+    for (i = 0; i < (uint32)count; i++)
+    {
+        if (block[i] != (uint8)(received + i))
+        {
+            fprintf(stderr, "Ifx_Fifo: data mismatch at byte %lu\n", (unsigned long)(received + i));
+            exit(1);
+        }
+    }
+}
+
+
+/** \brief Two thread stress case: one thread writes, the calling thread reads and checks the sequence
+ * \param inPlace TRUE: the data are checked in the ring with Ifx_Fifo_peekRead(), FALSE: the data are read with Ifx_Fifo_read()
+ */
+IFX_INLINE void Ifx_Bench_DataHandling_runTwoThreads(uint32 iterations, boolean inPlace)
+{
+    Ifx_Bench_DataHandling_Producer producer;
+    pthread_t                       thread;
+    uint8                           block[IFX_BENCH_DATAHANDLING_STRESS_SIZE];
+    Ifx_Fifo_Span                   span[2];
+    uint32                          received = 0;
+
+    producer.fifo  = Ifx_Bench_DataHandling_fifo;
+    producer.count = iterations * IFX_BENCH_DATAHANDLING_STRESS_SIZE;
+    pthread_create(&thread, NULL_PTR, &Ifx_Bench_DataHandling_produce, &producer);
+
+    while (received < producer.count)
+    {
+        Ifx_SizeT blockSize = (Ifx_SizeT)__minu((received % 47) + 1, producer.count - received);
+
+        if (inPlace != FALSE)
+        {
+            blockSize = Ifx_Fifo_peekRead(Ifx_Bench_DataHandling_fifo, span, blockSize);
+            Ifx_Bench_DataHandling_check(span[0].data, span[0].length, received);
+            Ifx_Bench_DataHandling_check(span[1].data, span[1].length, received + span[0].length);
+            Ifx_Fifo_consumeRead(Ifx_Bench_DataHandling_fifo, blockSize);
+        }
+        else
+        {
+            blockSize -= Ifx_Fifo_read(Ifx_Bench_DataHandling_fifo, block, blockSize, TIME_NULL);
+            Ifx_Bench_DataHandling_check(block, blockSize, received);
+        }
+
+        received += blockSize;
+
+        if (blockSize == 0)
+        {
+            sched_yield();      /* FIFO empty, let the writer run on hosts with few cores */
+        }
+    }
+
+    pthread_join(thread, NULL_PTR);
+
+    if (Ifx_Fifo_isEmpty(Ifx_Bench_DataHandling_fifo) == FALSE)
+    {
+        fprintf(stderr, "Ifx_Fifo: FIFO not empty after transfer\n");
+        exit(1);
+    }
+
+    Ifx_Bench_g_sink = received;
+}
+
+
+static void Ifx_Bench_DataHandling_runTwoThreadsCopy(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runTwoThreads(iterations, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runTwoThreadsInPlace(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runTwoThreads(iterations, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularWrite8(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_CircularBuffer_write8(&Ifx_Bench_DataHandling_circular, Ifx_Bench_DataHandling_block, IFX_BENCH_DATAHANDLING_BLOCK_SIZE);
+    }
+
+    Ifx_Bench_g_sink = Ifx_Bench_DataHandling_circular.index;
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularWrite32(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_CircularBuffer_write32(&Ifx_Bench_DataHandling_circular, Ifx_Bench_DataHandling_block, IFX_BENCH_DATAHANDLING_BLOCK_SIZE / 4);
+    }
+
+    Ifx_Bench_g_sink = Ifx_Bench_DataHandling_circular.index;
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead32(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_CircularBuffer_read32(&Ifx_Bench_DataHandling_circular, Ifx_Bench_DataHandling_block, IFX_BENCH_DATAHANDLING_BLOCK_SIZE / 4);
+    }
+
+    Ifx_Bench_g_sink = Ifx_Bench_DataHandling_block[0];
+}
+
+
+/** \brief Host stand-in for IfxDma_Dma_copy(): the copy is done by the C library */
+static void Ifx_Bench_DataHandling_dmaCopy(void *object, void *destination, const void *source, Ifx_SizeT count)
+{
+    (void)object;
+    memcpy(destination, source, (size_t)count);
+}
+
+
+/** \brief Check the bulk copy against a byte copy for all alignments, wrap positions and some sizes */
+static void Ifx_Bench_DataHandling_checkBulk(void)
+{
+    static const Ifx_SizeT sizes[] = {1, 7, 8, 9, 63, 64, 65, 1023, 1024, 1025, IFX_BENCH_DATAHANDLING_BULK_BLOCK};
+    uint8                 *block   = (uint8 *)Ifx_Bench_DataHandling_bulkBlock;
+    uint8                 *check   = (uint8 *)Ifx_Bench_DataHandling_bulkCheck;
+    uint32                 i;
+    uint32                 offset;
+    uint32                 start;
+
+    for (i = 0; i < sizeof(Ifx_Bench_DataHandling_bulkBlock); i++)
+    {
+        block[i] = (uint8)(i * 7 + 3);
+    }
+
+    for (i = 0; i < Ifx_COUNTOF(sizes); i++)
+    {
+        for (offset = 0; offset < 8; offset++)
+        {
+            for (start = IFX_BENCH_DATAHANDLING_BULK_SIZE - 9; start < IFX_BENCH_DATAHANDLING_BULK_SIZE + 4; start++)
+            {
+                Ifx_SizeT index = (Ifx_SizeT)(start % IFX_BENCH_DATAHANDLING_BULK_SIZE);
+
+                memset(check, 0, sizeof(Ifx_Bench_DataHandling_bulkCheck));
+                Ifx_Bench_DataHandling_bulk.index = (uint16)index;
+                Ifx_CircularBuffer_writeBulk(&Ifx_Bench_DataHandling_bulk, &block[offset], sizes[i]);
+                Ifx_Bench_DataHandling_bulk.index = (uint16)index;
+                Ifx_CircularBuffer_read8(&Ifx_Bench_DataHandling_bulk, check, sizes[i]);
+
+                if (memcmp(check, &block[offset], (size_t)sizes[i]) != 0)
+                {
+                    fprintf(stderr, "Ifx_CircularBuffer_writeBulk: mismatch, size %d, offset %u, index %d\n", sizes[i], offset, index);
+                    exit(1);
+                }
+
+                Ifx_Bench_DataHandling_bulk.index = (uint16)index;
+                Ifx_CircularBuffer_readBulk(&Ifx_Bench_DataHandling_bulk, &check[7 - offset], sizes[i]);
+
+                if (memcmp(&check[7 - offset], &block[offset], (size_t)sizes[i]) != 0)
+                {
+                    fprintf(stderr, "Ifx_CircularBuffer_readBulk: mismatch, size %d, offset %u, index %d\n", sizes[i], offset, index);
+                    exit(1);
+                }
+            }
+        }
+    }
+
+    Ifx_Bench_DataHandling_bulk.index = 0;
+}
+
+
+static void Ifx_Bench_DataHandling_setupBulk(void)
+{
+    Ifx_Bench_DataHandling_setup();
+
+    Ifx_Bench_DataHandling_bulk.base   = Ifx_Bench_DataHandling_bulkBuffer;
+    Ifx_Bench_DataHandling_bulk.index  = 0;
+    Ifx_Bench_DataHandling_bulk.length = IFX_BENCH_DATAHANDLING_BULK_SIZE;
+
+    Ifx_Bench_DataHandling_checkBulk();
+}
+
+
+/** \brief Same as Ifx_Bench_DataHandling_setupBulk(), all blocks are delegated to the DMA stand-in */
+static void Ifx_Bench_DataHandling_setupBulkDma(void)
+{
+    Ifx_Bench_DataHandling_setupBulk();
+    Ifx_CircularBuffer_setBulkCopy(&Ifx_Bench_DataHandling_dmaCopy, NULL_PTR, 0);
+    Ifx_Bench_DataHandling_checkBulk();
+}
+
+
+/** \brief Read \p count bytes to the block at \p offset, with the byte or the bulk copy */
+IFX_INLINE void Ifx_Bench_DataHandling_runCircularRead(uint32 iterations, Ifx_SizeT count, uint32 offset, boolean bulk)
+{
+    uint32 i;
+    uint8 *block = &((uint8 *)Ifx_Bench_DataHandling_bulkBlock)[offset];
+
+    for (i = 0; i < iterations; i++)
+    {
+        if (bulk != FALSE)
+        {
+            Ifx_CircularBuffer_readBulk(&Ifx_Bench_DataHandling_bulk, block, count);
+        }
+        else
+        {
+            Ifx_CircularBuffer_read8(&Ifx_Bench_DataHandling_bulk, block, count);
+        }
+    }
+
+    Ifx_Bench_g_sink = block[0];
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead8_16(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 16, 0, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead8_64(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 64, 0, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead8_256(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 256, 0, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead8_1024(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 1024, 0, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularRead8_4096(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 4096, 0, FALSE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulk16(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 16, 0, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulk64(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 64, 0, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulk256(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 256, 0, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulk1024(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 1024, 0, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulk4096(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 4096, 0, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularReadBulkUnaligned1024(uint32 iterations)
+{
+    Ifx_Bench_DataHandling_runCircularRead(iterations, 1024, 1, TRUE);
+}
+
+
+static void Ifx_Bench_DataHandling_runCircularWriteBulk1024(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_CircularBuffer_writeBulk(&Ifx_Bench_DataHandling_bulk, Ifx_Bench_DataHandling_bulkBlock, 1024);
+    }
+
+    Ifx_Bench_g_sink = Ifx_Bench_DataHandling_bulk.index;
+}
+
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+const Ifx_Bench_Case Ifx_Bench_g_dataHandlingCases[] = {
+    {"Ifx_Fifo_write+read(1)",               Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifo1          },
+    {"Ifx_Fifo_write+read(16)",              Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifo16         },
+    {"Ifx_Fifo_write+read(256)",             Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifo256        },
+    {"Ifx_Fifo_reserve..consume(16)",        Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifoInPlace16  },
+    {"Ifx_Fifo_reserve..consume(256)",       Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifoInPlace256 },
+    {"Ifx_Fifo_spsc_reserve..consume(256)",  Ifx_Bench_DataHandling_setupSpsc, Ifx_Bench_DataHandling_runFifoInPlace256 },
+    {"Ifx_Fifo_readCount+canWriteCount",     Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runFifoCounts     },
+    {"Ifx_Fifo_spsc_write+read(1)",          Ifx_Bench_DataHandling_setupSpsc, Ifx_Bench_DataHandling_runFifo1      },
+    {"Ifx_Fifo_spsc_write+read(16)",         Ifx_Bench_DataHandling_setupSpsc, Ifx_Bench_DataHandling_runFifo16     },
+    {"Ifx_Fifo_locked_2threads(64)",         Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runTwoThreadsCopy     },
+    {"Ifx_Fifo_spsc_2threads(64)",           Ifx_Bench_DataHandling_setupSpsc, Ifx_Bench_DataHandling_runTwoThreadsCopy },
+    {"Ifx_Fifo_locked_2threads_peek(64)",    Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runTwoThreadsInPlace  },
+    {"Ifx_Fifo_spsc_2threads_peek(64)",      Ifx_Bench_DataHandling_setupSpsc, Ifx_Bench_DataHandling_runTwoThreadsInPlace },
+    {"Ifx_CircularBuffer_write8(256)",       Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runCircularWrite8 },
+    {"Ifx_CircularBuffer_write32(64)",       Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runCircularWrite32},
+    {"Ifx_CircularBuffer_read32(64)",        Ifx_Bench_DataHandling_setup, Ifx_Bench_DataHandling_runCircularRead32 },
+    {"Ifx_CircularBuffer_read8(16)",         Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularRead8_16, 16                    },
+    {"Ifx_CircularBuffer_read8(64)",         Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularRead8_64, 64                    },
+    {"Ifx_CircularBuffer_read8(256)",        Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularRead8_256, 256                  },
+    {"Ifx_CircularBuffer_read8(1024)",       Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularRead8_1024, 1024                },
+    {"Ifx_CircularBuffer_read8(4096)",       Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularRead8_4096, 4096                },
+    {"Ifx_CircularBuffer_readBulk(16)",      Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulk16, 16                  },
+    {"Ifx_CircularBuffer_readBulk(64)",      Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulk64, 64                  },
+    {"Ifx_CircularBuffer_readBulk(256)",     Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulk256, 256                },
+    {"Ifx_CircularBuffer_readBulk(1024)",    Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulk1024, 1024              },
+    {"Ifx_CircularBuffer_readBulk(4096)",    Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulk4096, 4096              },
+    {"Ifx_CircularBuffer_readBulk(1024+1)",  Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularReadBulkUnaligned1024, 1024     },
+    {"Ifx_CircularBuffer_writeBulk(1024)",   Ifx_Bench_DataHandling_setupBulk, Ifx_Bench_DataHandling_runCircularWriteBulk1024, 1024             },
+    {"Ifx_CircularBuffer_readBulk_dma(16)",  Ifx_Bench_DataHandling_setupBulkDma, Ifx_Bench_DataHandling_runCircularReadBulk16, 16               },
+    {"Ifx_CircularBuffer_readBulk_dma(64)",  Ifx_Bench_DataHandling_setupBulkDma, Ifx_Bench_DataHandling_runCircularReadBulk64, 64               },
+    {"Ifx_CircularBuffer_readBulk_dma(256)", Ifx_Bench_DataHandling_setupBulkDma, Ifx_Bench_DataHandling_runCircularReadBulk256, 256             },
+    {"Ifx_CircularBuffer_readBulk_dma(1024)", Ifx_Bench_DataHandling_setupBulkDma, Ifx_Bench_DataHandling_runCircularReadBulk1024, 1024         },
+    {"Ifx_CircularBuffer_readBulk_dma(4096)", Ifx_Bench_DataHandling_setupBulkDma, Ifx_Bench_DataHandling_runCircularReadBulk4096, 4096         },
+    IFX_BENCH_CASE_LIST_END
+};
@@ -0,0 +1,1232 @@
+/**
+ * \file Ifx_Bench_Math.c
+ * \brief Benchmark cases of the SysSe/Math modules.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_Bench.h"
+#include "Ifx_AngleTrkF32.h"
+#include "Ifx_AngleTrkQ31.h"
+#include "Ifx_BiquadF32.h"
+#include "Ifx_BiquadQ31.h"
+#include "Ifx_Cf32.h"
+#include "Ifx_FftF32.h"
+#include "Ifx_LowPassPt1.h"
+#include "Ifx_LowPassPt1F32.h"
+#include "Ifx_LutAtan2F32.h"
+#include "Ifx_LutLinearF32.h"
+#include "Ifx_LutMapF32.h"
+#include "Ifx_LutSincosF32.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFX_BENCH_MATH_INPUTS       (256)    /**< \brief Number of input samples, power of 2 */
+#define IFX_BENCH_MATH_VECTOR       (64)     /**< \brief Length of the vector kernel inputs */
+#define IFX_BENCH_MATH_SPECTRUM     (1024)   /**< \brief Length of the spectral diagnostic vectors */
+#define IFX_BENCH_MATH_AMPLITUDE    (20000)  /**< \brief Resolver signal amplitude */
+#define IFX_BENCH_MATH_ERROR_POINTS (65536)  /**< \brief Number of angles of the accuracy checks */
+#define IFX_BENCH_MATH_FILTER_ORDER (4)      /**< \brief Order of the filter comparisons */
+#define IFX_BENCH_MATH_CHANNELS     (4)      /**< \brief Number of channels of the filter banks */
+#define IFX_BENCH_MATH_MAP_POINTS   (16)     /**< \brief Number of breakpoints of each map axis */
+#define IFX_BENCH_MATH_FFT_BOUND    (2.0e-6) /**< \brief Maximum FFT error against the DFT, relative to the highest bin */
+#define IFX_BENCH_MATH_BIQUAD_BOUND (1.0e-3) /**< \brief Maximum biquad error at DC, at Nyquist and against float32, relative to full scale */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+static float32          Ifx_Bench_Math_x[IFX_BENCH_MATH_INPUTS];
+static float32          Ifx_Bench_Math_y[IFX_BENCH_MATH_INPUTS];
+static sint16           Ifx_Bench_Math_sin[IFX_BENCH_MATH_INPUTS];
+static sint16           Ifx_Bench_Math_cos[IFX_BENCH_MATH_INPUTS];
+static cfloat32         Ifx_Bench_Math_c[IFX_BENCH_MATH_INPUTS];
+static cfloat32         Ifx_Bench_Math_vector[IFX_BENCH_MATH_VECTOR];
+static float32          Ifx_Bench_Math_vectorF32[IFX_BENCH_MATH_VECTOR];
+static cfloat32         Ifx_Bench_Math_spectrum[IFX_BENCH_MATH_SPECTRUM];
+static float32          Ifx_Bench_Math_spectrumF32[IFX_BENCH_MATH_SPECTRUM];
+static sint16           Ifx_Bench_Math_samples[IFX_BENCH_MATH_SPECTRUM];
+static Ifx_FftF32       Ifx_Bench_Math_fft;
+static cfloat32         Ifx_Bench_Math_fftData[IFX_FFTF32_MAX_LENGTH];
+static sint16           Ifx_Bench_Math_fftSamples[IFX_FFTF32_MAX_LENGTH];
+static float64          Ifx_Bench_Math_fftInput[2 * IFX_FFTF32_MAX_LENGTH];
+static float64          Ifx_Bench_Math_fftReference[2 * IFX_FFTF32_MAX_LENGTH];
+static float64          Ifx_Bench_Math_fftTwiddle[2 * IFX_FFTF32_MAX_LENGTH];
+
+static Ifx_LowPassPt1   Ifx_Bench_Math_lowPass;
+static Ifx_LowPassPt1F32 Ifx_Bench_Math_lowPassF32;
+static Ifx_LowPassPt1F32 Ifx_Bench_Math_lowPassChain[IFX_BENCH_MATH_FILTER_ORDER];
+static Ifx_BiquadF32    Ifx_Bench_Math_biquad;
+static Ifx_BiquadF32Bank Ifx_Bench_Math_biquadBank;
+static Ifx_BiquadQ31    Ifx_Bench_Math_biquadQ31;
+static Ifx_BiquadQ31Bank Ifx_Bench_Math_biquadQ31Bank;
+static Ifx_AngleTrkF32  Ifx_Bench_Math_angleTrk;
+static Ifx_AngleTrkF32  Ifx_Bench_Math_angleTrkMulti[2];
+static Ifx_AngleTrkQ31  Ifx_Bench_Math_angleTrkQ31;
+static sint16           Ifx_Bench_Math_angleTrkSin;
+static sint16           Ifx_Bench_Math_angleTrkCos;
+
+static const Ifx_LutLinearF32_Item Ifx_Bench_Math_lutItems[] = {
+    {1.0f, 0.0f, -0.5f},
+    {2.0f, 0.5f, 0.0f },
+    {3.0f, 0.5f, 0.5f },
+    {4.0f, 0.0f, 2.0f }
+};
+
+static const Ifx_LutLinearF32 Ifx_Bench_Math_lut = {
+    sizeof(Ifx_Bench_Math_lutItems) / sizeof(Ifx_Bench_Math_lutItems[0]),
+    Ifx_Bench_Math_lutItems
+};
+
+static float32 Ifx_Bench_Math_mapPoints[IFX_BENCH_MATH_MAP_POINTS];
+static float32 Ifx_Bench_Math_mapValues[IFX_BENCH_MATH_MAP_POINTS * IFX_BENCH_MATH_MAP_POINTS * IFX_BENCH_MATH_MAP_POINTS];
+static float32 Ifx_Bench_Math_mapOutput[IFX_BENCH_MATH_INPUTS];
+static Ifx_LutMapF32_Cache Ifx_Bench_Math_mapCache;
+
+/* non-uniform x axis, uniform y and z axes on -1 .. 1 */
+static const Ifx_LutMap2dF32 Ifx_Bench_Math_map2d = {
+    IFX_LUTMAPF32_AXIS(IFX_BENCH_MATH_MAP_POINTS, Ifx_Bench_Math_mapPoints),
+    IFX_LUTMAPF32_AXIS_UNIFORM(IFX_BENCH_MATH_MAP_POINTS, -1.0f, 1.0f),
+    Ifx_Bench_Math_mapValues
+};
+
+static const Ifx_LutMap3dF32 Ifx_Bench_Math_map3d = {
+    IFX_LUTMAPF32_AXIS(IFX_BENCH_MATH_MAP_POINTS, Ifx_Bench_Math_mapPoints),
+    IFX_LUTMAPF32_AXIS_UNIFORM(IFX_BENCH_MATH_MAP_POINTS, -1.0f, 1.0f),
+    IFX_LUTMAPF32_AXIS_UNIFORM(IFX_BENCH_MATH_MAP_POINTS, -1.0f, 1.0f),
+    Ifx_Bench_Math_mapValues
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+static void Ifx_Bench_Math_setupInputs(void)
+{
+    uint32 i;
+
+    for (i = 0; i < IFX_BENCH_MATH_INPUTS; i++)
+    {
+        float32 angle = (2.0f * IFX_PI * i) / IFX_BENCH_MATH_INPUTS;
+        Ifx_Bench_Math_x[i]   = cosf(angle);
+        Ifx_Bench_Math_y[i]   = sinf(angle);
+        Ifx_Bench_Math_sin[i] = (sint16)(IFX_BENCH_MATH_AMPLITUDE * sinf(angle));
+        Ifx_Bench_Math_cos[i] = (sint16)(IFX_BENCH_MATH_AMPLITUDE * cosf(angle));
+        IFX_Cf32_set(&Ifx_Bench_Math_c[i], Ifx_Bench_Math_x[i], Ifx_Bench_Math_y[i]);
+    }
+
+    for (i = 0; i < IFX_BENCH_MATH_VECTOR; i++)
+    {
+        Ifx_Bench_Math_vector[i]   = Ifx_Bench_Math_c[i];
+        Ifx_Bench_Math_vectorF32[i] = Ifx_Bench_Math_x[i];
+    }
+
+    for (i = 0; i < IFX_BENCH_MATH_SPECTRUM; i++)
+    {
+        Ifx_Bench_Math_spectrum[i]    = Ifx_Bench_Math_c[i & (IFX_BENCH_MATH_INPUTS - 1)];
+        Ifx_Bench_Math_spectrumF32[i] = Ifx_Bench_Math_y[i & (IFX_BENCH_MATH_INPUTS - 1)];
+        Ifx_Bench_Math_samples[i]     = Ifx_Bench_Math_sin[i & (IFX_BENCH_MATH_INPUTS - 1)];
+    }
+
+    Ifx_FftF32_init(&Ifx_Bench_Math_fft, IFX_BENCH_MATH_SPECTRUM);
+
+    Ifx_LutSincosF32_init();
+    Ifx_LutAtan2F32_init();
+}
+
+
+static void Ifx_Bench_Math_setupLowPass(void)
+{
+    Ifx_LowPassPt1_Config    config;
+    Ifx_LowPassPt1F32_Config configF32;
+
+    Ifx_Bench_Math_setupInputs();
+
+    config.cutOffFrequency    = 100.0f;
+    config.gain               = 1.0f;
+    config.samplingTime       = 100e-6f;
+    Ifx_LowPassPt1_init(&Ifx_Bench_Math_lowPass, &config);
+
+    configF32.cutOffFrequency = 100.0f;
+    configF32.gain            = 1.0f;
+    configF32.samplingTime    = 100e-6f;
+    Ifx_LowPassPt1F32_init(&Ifx_Bench_Math_lowPassF32, &configF32);
+}
+
+
+static void Ifx_Bench_Math_setupBiquad(void)
+{
+    Ifx_LowPassPt1F32_Config configPt1;
+    Ifx_BiquadF32_Config     config;
+    uint8                    k;
+
+    Ifx_Bench_Math_setupInputs();
+
+    configPt1.cutOffFrequency = 2 * IFX_PI * 1000.0f;
+    configPt1.gain            = 1.0f;
+    configPt1.samplingTime    = 50e-6f;
+
+    for (k = 0; k < IFX_BENCH_MATH_FILTER_ORDER; k++)
+    {
+        Ifx_LowPassPt1F32_init(&Ifx_Bench_Math_lowPassChain[k], &configPt1);
+    }
+
+    config.type            = Ifx_BiquadF32_Type_lowPass;
+    config.sections        = IFX_BENCH_MATH_FILTER_ORDER / 2;
+    config.cutOffFrequency = 2 * IFX_PI * 1000.0f;
+    config.q               = 0.0f;
+    config.gain            = 1.0f;
+    config.samplingTime    = 50e-6f;
+    Ifx_BiquadF32_init(&Ifx_Bench_Math_biquad, &config);
+    Ifx_BiquadF32Bank_init(&Ifx_Bench_Math_biquadBank, &config, IFX_BENCH_MATH_CHANNELS);
+    Ifx_BiquadQ31_init(&Ifx_Bench_Math_biquadQ31, &config);
+    Ifx_BiquadQ31Bank_init(&Ifx_Bench_Math_biquadQ31Bank, &config, IFX_BENCH_MATH_CHANNELS);
+}
+
+
+static void Ifx_Bench_Math_setupMap(void)
+{
+    uint32 i;
+
+    Ifx_Bench_Math_setupInputs();
+
+    for (i = 0; i < IFX_BENCH_MATH_MAP_POINTS; i++)
+    {   /* denser breakpoints around 0 */
+        float32 u = ((2.0f * i) / (IFX_BENCH_MATH_MAP_POINTS - 1)) - 1.0f;
+        Ifx_Bench_Math_mapPoints[i] = u * __absf(u);
+    }
+
+    for (i = 0; i < (sizeof(Ifx_Bench_Math_mapValues) / sizeof(Ifx_Bench_Math_mapValues[0])); i++)
+    {
+        Ifx_Bench_Math_mapValues[i] = sinf(0.01f * i);
+    }
+
+    Ifx_LutMapF32_initCache(&Ifx_Bench_Math_mapCache);
+}
+
+
+static void Ifx_Bench_Math_setupAngleTrk(void)
+{
+    Ifx_AngleTrkF32_Config config;
+
+    Ifx_Bench_Math_setupInputs();
+
+    Ifx_AngleTrkF32_initConfig(&config, &Ifx_Bench_Math_angleTrkSin, &Ifx_Bench_Math_angleTrkCos);
+    config.sqrAmplMax = (sint32)IFX_BENCH_MATH_AMPLITUDE * IFX_BENCH_MATH_AMPLITUDE * 2;
+    config.sqrAmplMin = (sint32)IFX_BENCH_MATH_AMPLITUDE * IFX_BENCH_MATH_AMPLITUDE / 2;
+    Ifx_AngleTrkF32_init(&Ifx_Bench_Math_angleTrk, &config, 100e-6f);
+    Ifx_AngleTrkQ31_init(&Ifx_Bench_Math_angleTrkQ31, &config, 100e-6f);
+}
+
+
+static void Ifx_Bench_Math_setupAngleTrkMulti(void)
+{
+    Ifx_Bench_Math_setupAngleTrk();
+    Ifx_Bench_Math_angleTrkMulti[0] = Ifx_Bench_Math_angleTrk;
+    Ifx_Bench_Math_angleTrkMulti[1] = Ifx_Bench_Math_angleTrk;
+}
+
+
+static void Ifx_Bench_Math_runLowPassPt1(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_LowPassPt1_do(&Ifx_Bench_Math_lowPass, Ifx_Bench_Math_x[i & (IFX_BENCH_MATH_INPUTS - 1)]);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_lowPass.out;
+}
+
+
+static void Ifx_Bench_Math_runLowPassPt1F32(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_LowPassPt1F32_do(&Ifx_Bench_Math_lowPassF32, Ifx_Bench_Math_x[i & (IFX_BENCH_MATH_INPUTS - 1)]);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_lowPassF32.out;
+}
+
+
+static void Ifx_Bench_Math_runLowPassPt1F32Chain(uint32 iterations)
+{
+    uint32  i;
+    uint8   k;
+    float32 value = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        value = Ifx_Bench_Math_x[i & (IFX_BENCH_MATH_INPUTS - 1)];
+
+        for (k = 0; k < IFX_BENCH_MATH_FILTER_ORDER; k++)
+        {
+            value = Ifx_LowPassPt1F32_do(&Ifx_Bench_Math_lowPassChain[k], value);
+        }
+    }
+
+    Ifx_Bench_g_sinkF32 = value;
+}
+
+
+static void Ifx_Bench_Math_runBiquadF32(uint32 iterations)
+{
+    uint32  i;
+    float32 value = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        value = Ifx_BiquadF32_do(&Ifx_Bench_Math_biquad, Ifx_Bench_Math_x[i & (IFX_BENCH_MATH_INPUTS - 1)]);
+    }
+
+    Ifx_Bench_g_sinkF32 = value;
+}
+
+
+static void Ifx_Bench_Math_runBiquadF32Block(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        /* the low-pass filter keeps the values in range */
+        Ifx_BiquadF32_doBlock(&Ifx_Bench_Math_biquad, Ifx_Bench_Math_spectrumF32, Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrumF32[1];
+}
+
+
+static void Ifx_Bench_Math_runBiquadF32Bank(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BiquadF32Bank_doBlock(&Ifx_Bench_Math_biquadBank, Ifx_Bench_Math_spectrumF32, Ifx_Bench_Math_spectrumF32,
+            IFX_BENCH_MATH_SPECTRUM / IFX_BENCH_MATH_CHANNELS);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrumF32[1];
+}
+
+
+static void Ifx_Bench_Math_runBiquadQ31BlockQ15(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BiquadQ31_doBlockQ15(&Ifx_Bench_Math_biquadQ31, Ifx_Bench_Math_samples, Ifx_Bench_Math_samples, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sink = (uint32)Ifx_Bench_Math_samples[1];
+}
+
+
+static void Ifx_Bench_Math_runBiquadQ31BankQ15(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_BiquadQ31Bank_doBlockQ15(&Ifx_Bench_Math_biquadQ31Bank, Ifx_Bench_Math_samples, Ifx_Bench_Math_samples,
+            IFX_BENCH_MATH_SPECTRUM / IFX_BENCH_MATH_CHANNELS);
+    }
+
+    Ifx_Bench_g_sink = (uint32)Ifx_Bench_Math_samples[1];
+}
+
+
+static void Ifx_Bench_Math_runAngleTrkStep(uint32 iterations)
+{
+    uint32  i;
+    float32 angle = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        angle += Ifx_AngleTrkF32_step(&Ifx_Bench_Math_angleTrk, Ifx_Bench_Math_sin[index], Ifx_Bench_Math_cos[index], 0.0f);
+    }
+
+    Ifx_Bench_g_sinkF32 = angle;
+}
+
+
+static void Ifx_Bench_Math_runAngleTrkUpdate(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        Ifx_Bench_Math_angleTrkSin = Ifx_Bench_Math_sin[index];
+        Ifx_Bench_Math_angleTrkCos = Ifx_Bench_Math_cos[index];
+        Ifx_AngleTrkF32_update(&Ifx_Bench_Math_angleTrk);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_AngleTrkF32_getPosition(&Ifx_Bench_Math_angleTrk);
+}
+
+
+static void Ifx_Bench_Math_runAngleTrkQ31Update(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        Ifx_Bench_Math_angleTrkSin = Ifx_Bench_Math_sin[index];
+        Ifx_Bench_Math_angleTrkCos = Ifx_Bench_Math_cos[index];
+        Ifx_AngleTrkQ31_update(&Ifx_Bench_Math_angleTrkQ31);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_AngleTrkQ31_getPosition(&Ifx_Bench_Math_angleTrkQ31);
+}
+
+
+/** \brief Ifx_AngleTrkF32_stepBlock() on blocks of IFX_BENCH_MATH_INPUTS samples, one iteration per sample */
+static void Ifx_Bench_Math_runAngleTrkStepBlock(uint32 iterations)
+{
+    uint32  i;
+    float32 angle = 0.0f;
+
+    for (i = 0; i < iterations; i += IFX_BENCH_MATH_INPUTS)
+    {
+        sint32 count = (sint32)__minu(iterations - i, IFX_BENCH_MATH_INPUTS);
+        angle += Ifx_AngleTrkF32_stepBlock(&Ifx_Bench_Math_angleTrk, Ifx_Bench_Math_sin, Ifx_Bench_Math_cos, NULL_PTR, count);
+    }
+
+    Ifx_Bench_g_sinkF32 = angle;
+}
+
+
+/** \brief Ifx_AngleTrkF32_stepBlockMulti() with 2 observers, one iteration per sample of one observer */
+static void Ifx_Bench_Math_runAngleTrkStepBlockMulti(uint32 iterations)
+{
+    const sint16 *const sinIn[2] = {Ifx_Bench_Math_sin, Ifx_Bench_Math_sin};
+    const sint16 *const cosIn[2] = {Ifx_Bench_Math_cos, Ifx_Bench_Math_cos};
+    uint32              i;
+
+    for (i = 0; i < iterations; i += 2 * IFX_BENCH_MATH_INPUTS)
+    {
+        sint32 count = (sint32)__minu((iterations - i) / 2, IFX_BENCH_MATH_INPUTS);
+        Ifx_AngleTrkF32_stepBlockMulti(Ifx_Bench_Math_angleTrkMulti, 2, sinIn, cosIn, NULL_PTR, count);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_angleTrkMulti[0].angleEst + Ifx_Bench_Math_angleTrkMulti[1].angleEst;
+}
+
+
+static void Ifx_Bench_Math_runAtan2Float32(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += Ifx_LutAtan2F32_float32(Ifx_Bench_Math_y[index], Ifx_Bench_Math_x[index]);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runAtan2FxpAngle(uint32 iterations)
+{
+    uint32 i;
+    uint32 sum = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += (uint32)Ifx_LutAtan2F32_fxpAngle(Ifx_Bench_Math_x[index], Ifx_Bench_Math_y[index]);
+    }
+
+    Ifx_Bench_g_sink = sum;
+}
+
+
+static void Ifx_Bench_Math_runAtan2Sint16(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += Ifx_LutAtan2F32_sint16(Ifx_Bench_Math_sin[index], Ifx_Bench_Math_cos[index]);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runAtan2Q31(uint32 iterations)
+{
+    uint32 i;
+    sint32 sum = 0;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += Ifx_AngleTrkQ31_atan2(Ifx_Bench_Math_sin[index], Ifx_Bench_Math_cos[index]);
+    }
+
+    Ifx_Bench_g_sink = sum;
+}
+
+
+/** \brief Return the absolute difference of two angles in rad, modulo 2*pi */
+static float64 Ifx_Bench_Math_angleError(float64 angle, float64 reference)
+{
+    float64 error = fmod(fabs(angle - reference), 2.0 * IFX_PI);
+
+    return (error > IFX_PI) ? ((2.0 * IFX_PI) - error) : error;
+}
+
+
+/** \brief Maximum error of the atan2 functions on resolver samples of IFX_BENCH_MATH_AMPLITUDE */
+static float64 Ifx_Bench_Math_errorAtan2(uint8 function)
+{
+    float64 maxError = 0.0;
+    sint32  i;
+
+    for (i = 0; i < IFX_BENCH_MATH_ERROR_POINTS; i++)
+    {
+        float64 angle     = (2.0 * IFX_PI * (i + 0.5)) / IFX_BENCH_MATH_ERROR_POINTS;
+        sint16  y         = (sint16)lround(IFX_BENCH_MATH_AMPLITUDE * sin(angle));
+        sint16  x         = (sint16)lround(IFX_BENCH_MATH_AMPLITUDE * cos(angle));
+        float64 reference = atan2(y, x);
+        float64 result;
+
+        switch (function)
+        {
+        case 0:
+            result = Ifx_LutAtan2F32_float32(y, x);
+            break;
+        case 1:
+            result = IFX_LUT_FXPANGLE_TO_F32(Ifx_LutAtan2F32_fxpAngle(x, y));
+            break;
+        case 2:
+            result = Ifx_LutAtan2F32_sint16(y, x);
+            break;
+        default:
+            result = Ifx_AngleTrkQ31_atan2(y, x) * (IFX_PI / 2147483648.0);
+            break;
+        }
+
+        result   = Ifx_Bench_Math_angleError(result, reference);
+        maxError = (result > maxError) ? result : maxError;
+    }
+
+    return maxError;
+}
+
+
+static float64 Ifx_Bench_Math_errorAtan2Float32(void)
+{
+    return Ifx_Bench_Math_errorAtan2(0);
+}
+
+
+static float64 Ifx_Bench_Math_errorAtan2FxpAngle(void)
+{
+    return Ifx_Bench_Math_errorAtan2(1);
+}
+
+
+static float64 Ifx_Bench_Math_errorAtan2Sint16(void)
+{
+    return Ifx_Bench_Math_errorAtan2(2);
+}
+
+
+static float64 Ifx_Bench_Math_errorAtan2Q31(void)
+{
+    return Ifx_Bench_Math_errorAtan2(3);
+}
+
+
+/** \brief Direct evaluation of the DFT of the N complex values of Ifx_Bench_Math_fftInput into Ifx_Bench_Math_fftReference */
+static void Ifx_Bench_Math_dft(sint32 length, boolean inverse)
+{
+    sint32 k;
+    sint32 n;
+
+    for (n = 0; n < length; n++)
+    {
+        float64 angle = (2.0 * IFX_PI * n) / length;
+        Ifx_Bench_Math_fftTwiddle[2 * n]     = cos(angle);
+        Ifx_Bench_Math_fftTwiddle[2 * n + 1] = inverse ? sin(angle) : -sin(angle);
+    }
+
+    for (k = 0; k < length; k++)
+    {
+        float64 re = 0.0;
+        float64 im = 0.0;
+
+        for (n = 0; n < length; n++)
+        {
+            sint32  m  = (k * n) & (length - 1);
+            float64 xr = Ifx_Bench_Math_fftInput[2 * n];
+            float64 xi = Ifx_Bench_Math_fftInput[2 * n + 1];
+            float64 wr = Ifx_Bench_Math_fftTwiddle[2 * m];
+            float64 wi = Ifx_Bench_Math_fftTwiddle[2 * m + 1];
+            re += (xr * wr) - (xi * wi);
+            im += (xr * wi) + (xi * wr);
+        }
+
+        Ifx_Bench_Math_fftReference[2 * k]     = re;
+        Ifx_Bench_Math_fftReference[2 * k + 1] = im;
+    }
+}
+
+
+/** \brief Maximum error of bins 0 .. count-1 of Ifx_Bench_Math_fftData against Ifx_Bench_Math_fftReference, relative to the highest bin
+ * With packed set, bin 0 holds the real bins 0 and N/2 as for Ifx_FftF32_real() */
+static float64 Ifx_Bench_Math_fftError(sint32 count, boolean packed)
+{
+    float64 maxError = 0.0;
+    float64 peak     = 0.0;
+    sint32  k;
+
+    for (k = 0; k <= count; k++)
+    {
+        peak = fmax(peak, hypot(Ifx_Bench_Math_fftReference[2 * k], Ifx_Bench_Math_fftReference[2 * k + 1]));
+    }
+
+    for (k = 0; k < count; k++)
+    {
+        float64 re = Ifx_Bench_Math_fftReference[2 * k];
+        float64 im = Ifx_Bench_Math_fftReference[2 * k + 1];
+
+        if (packed && (k == 0))
+        {
+            im = Ifx_Bench_Math_fftReference[2 * count];
+        }
+
+        maxError = fmax(maxError, hypot(Ifx_Bench_Math_fftData[k].real - re, Ifx_Bench_Math_fftData[k].imag - im));
+    }
+
+    return maxError / peak;
+}
+
+
+/** \brief Maximum error of the FFT functions against the DFT of pseudo-random inputs, for all the lengths.
+ * The bench stops if the error exceeds IFX_BENCH_MATH_FFT_BOUND */
+static float64 Ifx_Bench_Math_errorFft(uint8 function)
+{
+    static const pchar names[] = {"Ifx_FftF32_complex", "Ifx_FftF32_complex(inverse)", "Ifx_FftF32_real", "Ifx_FftF32_realQ15"};
+    float64            maxError = 0.0;
+    uint32             seed     = 12345;
+    sint32             length;
+    sint32             n;
+
+    Ifx_LutSincosF32_init();
+
+    for (length = IFX_FFTF32_MIN_LENGTH; length <= IFX_FFTF32_MAX_LENGTH; length *= 2)
+    {
+        boolean real = function >= 2;
+        float64 error;
+
+        for (n = 0; n < length; n++)
+        {
+            seed = (seed * 1103515245UL) + 12345UL;
+            Ifx_Bench_Math_fftSamples[n] = (sint16)(seed >> 16);
+            seed = (seed * 1103515245UL) + 12345UL;
+
+            if (function == 3)
+            {
+                Ifx_Bench_Math_fftInput[2 * n]     = Ifx_Bench_Math_fftSamples[n] / 32768.0;
+                Ifx_Bench_Math_fftInput[2 * n + 1] = 0.0;
+            }
+            else
+            {
+                /* values exactly representable as float32 */
+                Ifx_Bench_Math_fftInput[2 * n]     = (float32)(Ifx_Bench_Math_fftSamples[n] / 32768.0);
+                Ifx_Bench_Math_fftInput[2 * n + 1] = real ? 0.0 : (float32)((sint16)(seed >> 16) / 32768.0);
+            }
+
+            if (real)
+            {
+                ((float32 *)Ifx_Bench_Math_fftData)[n] = (float32)Ifx_Bench_Math_fftInput[2 * n];
+            }
+            else
+            {
+                IFX_Cf32_set(&Ifx_Bench_Math_fftData[n], (float32)Ifx_Bench_Math_fftInput[2 * n], (float32)Ifx_Bench_Math_fftInput[2 * n + 1]);
+            }
+        }
+
+        Ifx_FftF32_init(&Ifx_Bench_Math_fft, length);
+        Ifx_Bench_Math_dft(length, function == 1);
+
+        switch (function)
+        {
+        case 0:
+        case 1:
+            Ifx_FftF32_complex(&Ifx_Bench_Math_fft, Ifx_Bench_Math_fftData, function == 1);
+            error = Ifx_Bench_Math_fftError(length, FALSE);
+            break;
+        case 2:
+            Ifx_FftF32_real(&Ifx_Bench_Math_fft, (float32 *)Ifx_Bench_Math_fftData);
+            error = Ifx_Bench_Math_fftError(length / 2, TRUE);
+            break;
+        default:
+            Ifx_FftF32_realQ15(&Ifx_Bench_Math_fft, Ifx_Bench_Math_fftData, Ifx_Bench_Math_fftSamples);
+            error = Ifx_Bench_Math_fftError(length / 2, TRUE);
+            break;
+        }
+
+        if (error > IFX_BENCH_MATH_FFT_BOUND)
+        {
+            fprintf(stderr, "%s: error %g against the DFT exceeds %g, N = %d\n", names[function], error, IFX_BENCH_MATH_FFT_BOUND, length);
+            exit(1);
+        }
+
+        maxError = fmax(maxError, error);
+    }
+
+    /* Restore the benchmark transform */
+    Ifx_FftF32_init(&Ifx_Bench_Math_fft, IFX_BENCH_MATH_SPECTRUM);
+
+    return maxError;
+}
+
+
+/** \brief Maximum error of the biquad functions: gain of the low-pass filter at DC (1) and at Nyquist (0) in steady
+ * state, and for Q15, output against Ifx_BiquadF32_do() on a sine. The bench stops if the error exceeds
+ * IFX_BENCH_MATH_BIQUAD_BOUND */
+static float64 Ifx_Bench_Math_errorBiquad(uint8 function)
+{
+    static const pchar names[] = {"Ifx_BiquadF32_do", "Ifx_BiquadF32_doBlock", "Ifx_BiquadF32Bank_doBlock", "Ifx_BiquadQ31_doBlockQ15", "Ifx_BiquadQ31Bank_doBlockQ15"};
+    static float32     input[IFX_BENCH_MATH_SPECTRUM];
+    static float32     output[IFX_BENCH_MATH_SPECTRUM];
+    static float32     reference[IFX_BENCH_MATH_SPECTRUM];
+    static sint16      samples[IFX_BENCH_MATH_SPECTRUM];
+    static const pchar tests[] = {"DC", "Nyquist", "sine"};
+    sint32             step    = ((function == 2) || (function == 4)) ? IFX_BENCH_MATH_CHANNELS : 1;
+    sint32             frames  = IFX_BENCH_MATH_SPECTRUM / step;
+    float64            maxError = 0.0;
+    uint8              test;
+    sint32             i, n;
+
+    /* the floating point filters are their own reference on the sine */
+    for (test = 0; test < ((function >= 3) ? 3 : 2); test++)
+    {
+        float64 error = 0.0;
+
+        Ifx_BiquadF32_reset(&Ifx_Bench_Math_biquad);
+
+        for (n = 0; n < frames; n++)
+        {
+            float32 value = (test == 0) ? 0.5f : ((test == 1) ? (((n & 1) != 0) ? -0.5f : 0.5f) : (Ifx_Bench_Math_samples[n] / 32768.0f));
+
+            for (i = n * step; i < ((n + 1) * step); i++)
+            {
+                input[i]   = value;
+                samples[i] = (sint16)(value * 32768.0f);
+            }
+
+            reference[n] = (test == 0) ? 0.5f : ((test == 1) ? 0.0f : Ifx_BiquadF32_do(&Ifx_Bench_Math_biquad, value));
+        }
+
+        switch (function)
+        {
+        case 0:
+            Ifx_BiquadF32_reset(&Ifx_Bench_Math_biquad);
+
+            for (i = 0; i < IFX_BENCH_MATH_SPECTRUM; i++)
+            {
+                output[i] = Ifx_BiquadF32_do(&Ifx_Bench_Math_biquad, input[i]);
+            }
+
+            break;
+        case 1:
+            Ifx_BiquadF32_reset(&Ifx_Bench_Math_biquad);
+            Ifx_BiquadF32_doBlock(&Ifx_Bench_Math_biquad, input, output, IFX_BENCH_MATH_SPECTRUM);
+            break;
+        case 2:
+            Ifx_BiquadF32Bank_reset(&Ifx_Bench_Math_biquadBank);
+            Ifx_BiquadF32Bank_doBlock(&Ifx_Bench_Math_biquadBank, input, output, frames);
+            break;
+        default:
+
+            if (function == 3)
+            {
+                Ifx_BiquadQ31_reset(&Ifx_Bench_Math_biquadQ31);
+                Ifx_BiquadQ31_doBlockQ15(&Ifx_Bench_Math_biquadQ31, samples, samples, IFX_BENCH_MATH_SPECTRUM);
+            }
+            else
+            {
+                Ifx_BiquadQ31Bank_reset(&Ifx_Bench_Math_biquadQ31Bank);
+                Ifx_BiquadQ31Bank_doBlockQ15(&Ifx_Bench_Math_biquadQ31Bank, samples, samples, frames);
+            }
+
+            for (i = 0; i < IFX_BENCH_MATH_SPECTRUM; i++)
+            {
+                output[i] = samples[i] / 32768.0f;
+            }
+
+            break;
+        }
+
+        /* steady state: last frame only for DC and Nyquist */
+        for (i = (test == 2) ? 0 : ((frames - 1) * step); i < IFX_BENCH_MATH_SPECTRUM; i++)
+        {
+            error = fmax(error, fabs(output[i] - reference[i / step]));
+        }
+
+        if (error > IFX_BENCH_MATH_BIQUAD_BOUND)
+        {
+            fprintf(stderr, "%s: %s error %g exceeds %g\n", names[function], tests[test], error, IFX_BENCH_MATH_BIQUAD_BOUND);
+            exit(1);
+        }
+
+        maxError = fmax(maxError, error);
+    }
+
+    /* Restore the benchmark filters */
+    Ifx_BiquadF32_reset(&Ifx_Bench_Math_biquad);
+    Ifx_BiquadF32Bank_reset(&Ifx_Bench_Math_biquadBank);
+    Ifx_BiquadQ31_reset(&Ifx_Bench_Math_biquadQ31);
+    Ifx_BiquadQ31Bank_reset(&Ifx_Bench_Math_biquadQ31Bank);
+
+    return maxError;
+}
+
+
+static float64 Ifx_Bench_Math_errorBiquadF32(void)
+{
+    return Ifx_Bench_Math_errorBiquad(0);
+}
+
+
+static float64 Ifx_Bench_Math_errorBiquadF32Block(void)
+{
+    return Ifx_Bench_Math_errorBiquad(1);
+}
+
+
+static float64 Ifx_Bench_Math_errorBiquadF32Bank(void)
+{
+    return Ifx_Bench_Math_errorBiquad(2);
+}
+
+
+static float64 Ifx_Bench_Math_errorBiquadQ31BlockQ15(void)
+{
+    return Ifx_Bench_Math_errorBiquad(3);
+}
+
+
+static float64 Ifx_Bench_Math_errorBiquadQ31BankQ15(void)
+{
+    return Ifx_Bench_Math_errorBiquad(4);
+}
+
+
+static float64 Ifx_Bench_Math_errorFftComplex(void)
+{
+    return fmax(Ifx_Bench_Math_errorFft(0), Ifx_Bench_Math_errorFft(1));
+}
+
+
+static float64 Ifx_Bench_Math_errorFftReal(void)
+{
+    return fmax(Ifx_Bench_Math_errorFft(2), Ifx_Bench_Math_errorFft(3));
+}
+
+
+static void Ifx_Bench_Math_runSincos(uint32 iterations)
+{
+    uint32   i;
+    cfloat32 sum = {0.0f, 0.0f};
+
+    for (i = 0; i < iterations; i++)
+    {
+        cfloat32 value = Ifx_LutSincosF32_cossin((Ifx_Lut_FxpAngle)(i * 7));
+        sum = IFX_Cf32_add(&sum, &value);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum.real + sum.imag;
+}
+
+
+static void Ifx_Bench_Math_runLutLinearSearchBin(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += Ifx_LutLinearF32_searchBin(&Ifx_Bench_Math_lut, Ifx_Bench_Math_x[i & (IFX_BENCH_MATH_INPUTS - 1)]);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runLutMap2dCoherent(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        uint32 index = i & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += Ifx_LutMap2dF32_get(&Ifx_Bench_Math_map2d, &Ifx_Bench_Math_mapCache, Ifx_Bench_Math_x[index], Ifx_Bench_Math_y[index]);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runLutMap2dRandom(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {   /* jumps across the map, the cached cell is missed */
+        uint32 index = (i * 97) & (IFX_BENCH_MATH_INPUTS - 1);
+        sum += Ifx_LutMap2dF32_get(&Ifx_Bench_Math_map2d, &Ifx_Bench_Math_mapCache, Ifx_Bench_Math_x[index], Ifx_Bench_Math_y[index]);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runLutMap3dBlock(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_LutMap3dF32_getBlock(&Ifx_Bench_Math_map3d, &Ifx_Bench_Math_mapCache, Ifx_Bench_Math_x, Ifx_Bench_Math_y,
+            Ifx_Bench_Math_spectrumF32, Ifx_Bench_Math_mapOutput, IFX_BENCH_MATH_INPUTS);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_mapOutput[1];
+}
+
+
+static void Ifx_Bench_Math_runCf32Mul(uint32 iterations)
+{
+    uint32   i;
+    cfloat32 product = {1.0f, 0.0f};
+
+    for (i = 0; i < iterations; i++)
+    {
+        product = IFX_Cf32_mul(&product, &Ifx_Bench_Math_c[i & (IFX_BENCH_MATH_INPUTS - 1)]);
+    }
+
+    Ifx_Bench_g_sinkF32 = product.real;
+}
+
+
+static void Ifx_Bench_Math_runCplxVecMag(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Bench_Math_vector[i & (IFX_BENCH_MATH_VECTOR - 1)] = Ifx_Bench_Math_c[i & (IFX_BENCH_MATH_INPUTS - 1)];
+        Ifx_Bench_g_sinkF32 = CplxVecMag_f32(Ifx_Bench_Math_vector, IFX_BENCH_MATH_VECTOR)[0];
+    }
+}
+
+
+static void Ifx_Bench_Math_runVecSum(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_Bench_Math_vectorF32[i & (IFX_BENCH_MATH_VECTOR - 1)] = Ifx_Bench_Math_y[i & (IFX_BENCH_MATH_INPUTS - 1)];
+        sum += VecSum_f32(Ifx_Bench_Math_vectorF32, IFX_BENCH_MATH_VECTOR);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+/* Scalar references: the Ifx_Cf32 loops before the vector backend ---------*/
+
+static float32 Ifx_Bench_Math_scalarVecSum(float32 *X, short nX)
+{
+    float32        sumX = 0;
+    unsigned short i;
+
+    for (i = 0; i < nX; i++)
+    {
+        sumX += *X;
+        X++;
+    }
+
+    return sumX;
+}
+
+
+static void Ifx_Bench_Math_scalarVecGain(float32 *X, float32 gain, short nX)
+{
+    unsigned short i;
+
+    for (i = 0; i < nX; i++)
+    {
+        *X = *X * gain;
+        X++;
+    }
+}
+
+
+static float32 Ifx_Bench_Math_scalarVecMax(float32 *X, short nX)
+{
+    unsigned short i;
+    float32        r = (1.17549435E-38F);
+
+    for (i = 0; i < nX; i++)
+    {
+        r = __maxf(r, *X);
+        X++;
+    }
+
+    return r;
+}
+
+
+static void Ifx_Bench_Math_scalarCplxVecMul(cfloat32 *X, const cfloat32 *mul, short nX)
+{
+    for ( ; nX > 0; nX--)
+    {
+        *X = IFX_Cf32_mul(X, mul);
+        X++;
+    }
+}
+
+
+static void Ifx_Bench_Math_runScalarVecSum(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += Ifx_Bench_Math_scalarVecSum(Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runVecSumSpectrum(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += VecSum_f32(Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runVecSumPairwise(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += VecSumPairwise_f32(Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runScalarVecGain(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        /* gain alternates between x and 1/x, the values stay in range */
+        Ifx_Bench_Math_scalarVecGain(Ifx_Bench_Math_spectrumF32, (i & 1) ? 0.5f : 2.0f, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrumF32[0];
+}
+
+
+static void Ifx_Bench_Math_runVecGain(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        VecGain_f32(Ifx_Bench_Math_spectrumF32, (i & 1) ? 0.5f : 2.0f, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrumF32[0];
+}
+
+
+static void Ifx_Bench_Math_runScalarVecMax(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += Ifx_Bench_Math_scalarVecMax(Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runVecMax(uint32 iterations)
+{
+    uint32  i;
+    float32 sum = 0.0f;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sum += VecMax_f32(Ifx_Bench_Math_spectrumF32, IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = sum;
+}
+
+
+static void Ifx_Bench_Math_runScalarCplxVecMul(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        /* unit magnitude rotation, the values stay in range */
+        Ifx_Bench_Math_scalarCplxVecMul(Ifx_Bench_Math_spectrum, &Ifx_Bench_Math_c[i & (IFX_BENCH_MATH_INPUTS - 1)], IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrum[0].real;
+}
+
+
+static void Ifx_Bench_Math_runCplxVecMul(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        CplxVecMul_f32(Ifx_Bench_Math_spectrum, &Ifx_Bench_Math_c[i & (IFX_BENCH_MATH_INPUTS - 1)], IFX_BENCH_MATH_SPECTRUM);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrum[0].real;
+}
+
+
+static void Ifx_Bench_Math_runFftComplex(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        /* forward and inverse alternate, the values stay in range */
+        Ifx_FftF32_complex(&Ifx_Bench_Math_fft, Ifx_Bench_Math_spectrum, (i & 1) != 0);
+        VecGain_f32((float32 *)Ifx_Bench_Math_spectrum, (i & 1) ? (1.0f / IFX_BENCH_MATH_SPECTRUM) : 1.0f, IFX_BENCH_MATH_SPECTRUM * 2);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrum[1].real;
+}
+
+
+static void Ifx_Bench_Math_runFftRealQ15(uint32 iterations)
+{
+    uint32 i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        Ifx_FftF32_realQ15(&Ifx_Bench_Math_fft, Ifx_Bench_Math_spectrum, Ifx_Bench_Math_samples);
+    }
+
+    Ifx_Bench_g_sinkF32 = Ifx_Bench_Math_spectrum[1].real;
+}
+
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+const Ifx_Bench_Case Ifx_Bench_g_mathCases[] = {
+    {"Ifx_LowPassPt1_do",                    Ifx_Bench_Math_setupLowPass,  Ifx_Bench_Math_runLowPassPt1         },
+    {"Ifx_LowPassPt1F32_do",                 Ifx_Bench_Math_setupLowPass,  Ifx_Bench_Math_runLowPassPt1F32      },
+    {"Ifx_LowPassPt1F32_do(4x chained)",     Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runLowPassPt1F32Chain },
+    {"Ifx_BiquadF32_do(4th order)",          Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runBiquadF32,          0, Ifx_Bench_Math_errorBiquadF32           },
+    {"Ifx_BiquadF32_doBlock(1024)",          Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runBiquadF32Block,     IFX_BENCH_MATH_SPECTRUM * sizeof(float32), Ifx_Bench_Math_errorBiquadF32Block      },
+    {"Ifx_BiquadF32Bank_doBlock(4x256)",     Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runBiquadF32Bank,      IFX_BENCH_MATH_SPECTRUM * sizeof(float32), Ifx_Bench_Math_errorBiquadF32Bank       },
+    {"Ifx_BiquadQ31_doBlockQ15(1024)",       Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runBiquadQ31BlockQ15,  IFX_BENCH_MATH_SPECTRUM * sizeof(sint16),  Ifx_Bench_Math_errorBiquadQ31BlockQ15   },
+    {"Ifx_BiquadQ31Bank_doBlockQ15(4x256)",  Ifx_Bench_Math_setupBiquad,   Ifx_Bench_Math_runBiquadQ31BankQ15,   IFX_BENCH_MATH_SPECTRUM * sizeof(sint16),  Ifx_Bench_Math_errorBiquadQ31BankQ15    },
+    {"Ifx_AngleTrkF32_step",                 Ifx_Bench_Math_setupAngleTrk, Ifx_Bench_Math_runAngleTrkStep       },
+    {"Ifx_AngleTrkF32_update",               Ifx_Bench_Math_setupAngleTrk, Ifx_Bench_Math_runAngleTrkUpdate     },
+    {"Ifx_AngleTrkF32_stepBlock(256)",       Ifx_Bench_Math_setupAngleTrk, Ifx_Bench_Math_runAngleTrkStepBlock  },
+    {"Ifx_AngleTrkF32_stepBlockMulti(2x256)", Ifx_Bench_Math_setupAngleTrkMulti, Ifx_Bench_Math_runAngleTrkStepBlockMulti},
+    {"Ifx_AngleTrkQ31_update",               Ifx_Bench_Math_setupAngleTrk, Ifx_Bench_Math_runAngleTrkQ31Update  },
+    {"Ifx_LutAtan2F32_float32",              Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runAtan2Float32,       0, Ifx_Bench_Math_errorAtan2Float32 },
+    {"Ifx_LutAtan2F32_fxpAngle",             Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runAtan2FxpAngle,      0, Ifx_Bench_Math_errorAtan2FxpAngle},
+    {"Ifx_LutAtan2F32_sint16",               Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runAtan2Sint16,        0, Ifx_Bench_Math_errorAtan2Sint16  },
+    {"Ifx_AngleTrkQ31_atan2",                Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runAtan2Q31,           0, Ifx_Bench_Math_errorAtan2Q31     },
+    {"Ifx_LutSincosF32_cossin",              Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runSincos             },
+    {"Ifx_LutLinearF32_searchBin",           Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runLutLinearSearchBin },
+    {"Ifx_LutMap2dF32_get(coherent)",        Ifx_Bench_Math_setupMap,      Ifx_Bench_Math_runLutMap2dCoherent   },
+    {"Ifx_LutMap2dF32_get(random)",          Ifx_Bench_Math_setupMap,      Ifx_Bench_Math_runLutMap2dRandom     },
+    {"Ifx_LutMap3dF32_getBlock(256)",        Ifx_Bench_Math_setupMap,      Ifx_Bench_Math_runLutMap3dBlock      },
+    {"IFX_Cf32_mul",                         Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runCf32Mul            },
+    {"CplxVecMag_f32(64)",                   Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runCplxVecMag         },
+    {"VecSum_f32(64)",                       Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runVecSum             },
+    {"VecSum_f32(1024) scalar",              Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runScalarVecSum,       IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecSum_f32(1024)",                     Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runVecSumSpectrum,     IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecSumPairwise_f32(1024)",             Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runVecSumPairwise,     IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecGain_f32(1024) scalar",             Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runScalarVecGain,      IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecGain_f32(1024)",                    Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runVecGain,            IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecMax_f32(1024) scalar",              Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runScalarVecMax,       IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"VecMax_f32(1024)",                     Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runVecMax,             IFX_BENCH_MATH_SPECTRUM * sizeof(float32) },
+    {"CplxVecMul_f32(1024) scalar",          Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runScalarCplxVecMul,   IFX_BENCH_MATH_SPECTRUM * sizeof(cfloat32)},
+    {"CplxVecMul_f32(1024)",                 Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runCplxVecMul,         IFX_BENCH_MATH_SPECTRUM * sizeof(cfloat32)},
+    {"Ifx_FftF32_complex(1024)",             Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runFftComplex,         0, Ifx_Bench_Math_errorFftComplex   },
+    {"Ifx_FftF32_realQ15(1024)",             Ifx_Bench_Math_setupInputs,   Ifx_Bench_Math_runFftRealQ15,         0, Ifx_Bench_Math_errorFftReal      },
+    IFX_BENCH_CASE_LIST_END
+};
@@ -0,0 +1,80 @@
+/**
+ * \file IfxCpu.c
+ * \brief Host (x86 Linux) replacement of the CPU driver.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxCpu.h"
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+volatile unsigned int       IfxCpu_g_hostInterruptLock    = 0;
+__thread boolean            IfxCpu_g_hostInterruptEnabled = TRUE;
+__thread IfxCpu_ResourceCpu IfxCpu_g_hostCoreIndex        = IfxCpu_ResourceCpu_0;
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+boolean IfxCpu_acquireMutex(IfxCpu_mutexLock *lock)
+{
+    return __cmpAndSwap(((unsigned int *)lock), 1, 0) == 0;
+}
+
+
+void IfxCpu_releaseMutex(IfxCpu_mutexLock *lock)
+{
+    /*Reset the SpinLock*/
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+
+void IfxCpu_resetSpinLock(IfxCpu_spinLock *lock)
+{
+    /*Reset the SpinLock*/
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+
+boolean IfxCpu_setSpinLock(IfxCpu_spinLock *lock, uint32 timeoutCount)
+{
+    boolean retVal = FALSE;
+
+    do
+    {
+        if (__cmpAndSwap(((unsigned int *)lock), 1, 0) == 0)
+        {
+            retVal = TRUE;
+        }
+        else
+        {
+            timeoutCount--;
+        }
+    } while ((retVal == FALSE) && (timeoutCount > 0));
+
+    return retVal;
+}
@@ -0,0 +1,159 @@
+/**
+ * \file IfxCpu.h
+ * \brief Host (x86 Linux) replacement of the CPU driver.
+ *
+ * This file shadows 0_Src/4_McHal/Tricore/Cpu/Std/IfxCpu.h in the host build.
+ * The global interrupt enable is emulated by a process wide spin lock: disabling
+ * the interrupts acquires the lock, restoring them releases it. This gives the
+ * same mutual exclusion between threads as the interrupt lock gives between a
+ * task and an ISR on the target, so the modules can be exercised from several
+ * host threads.
+ *
+ * Each host thread may announce which core it emulates with
+ * IfxCpu_Host_setCoreIndex(), which is then returned by IfxCpu_getCoreIndex().
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#ifndef IFXCPU_H
+#define IFXCPU_H 1
+
+/******************************************************************************/
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Lock type Spin lock
+ */
+typedef unsigned int IfxCpu_spinLock;
+
+/** \brief Lock type Mutex lock
+ */
+typedef unsigned int IfxCpu_mutexLock;
+
+/** \brief List of the available CPU resources
+ */
+typedef enum
+{
+    IfxCpu_ResourceCpu_0 = 0,  /**< \brief CPU 0 */
+    IfxCpu_ResourceCpu_1 = 1,  /**< \brief CPU 1 */
+    IfxCpu_ResourceCpu_2 = 2,  /**< \brief CPU 2 */
+    IfxCpu_ResourceCpu_none    /**< \brief None of the CPU */
+} IfxCpu_ResourceCpu;
+
+#define IFXCPU_NUM_MODULES (3)
+
+/******************************************************************************/
+/*-------------------------------Host emulation-------------------------------*/
+/******************************************************************************/
+
+/** \brief Emulated interrupt lock, shared by all host threads */
+IFX_EXTERN volatile unsigned int IfxCpu_g_hostInterruptLock;
+
+/** \brief Emulated ICR.IE of the calling host thread */
+IFX_EXTERN __thread boolean IfxCpu_g_hostInterruptEnabled;
+
+/** \brief Emulated core index of the calling host thread */
+IFX_EXTERN __thread IfxCpu_ResourceCpu IfxCpu_g_hostCoreIndex;
+
+/** \brief Select the core emulated by the calling host thread
+ * \param cpu core index returned by IfxCpu_getCoreIndex() for this thread
+ */
+IFX_INLINE void IfxCpu_Host_setCoreIndex(IfxCpu_ResourceCpu cpu)
+{
+    IfxCpu_g_hostCoreIndex = cpu;
+}
+
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE boolean IfxCpu_areInterruptsEnabled(void)
+{
+    return IfxCpu_g_hostInterruptEnabled;
+}
+
+
+IFX_INLINE boolean IfxCpu_disableInterrupts(void)
+{
+    boolean enabled = IfxCpu_g_hostInterruptEnabled;
+
+    if (enabled != FALSE)
+    {
+        while (__cmpAndSwap(&IfxCpu_g_hostInterruptLock, 1, 0) != 0)
+        {}
+
+        IfxCpu_g_hostInterruptEnabled = FALSE;
+    }
+
+    return enabled;
+}
+
+
+IFX_INLINE void IfxCpu_enableInterrupts(void)
+{
+    if (IfxCpu_g_hostInterruptEnabled == FALSE)
+    {
+        IfxCpu_g_hostInterruptEnabled = TRUE;
+        __atomic_store_n(&IfxCpu_g_hostInterruptLock, 0, __ATOMIC_RELEASE);
+    }
+}
+
+
+IFX_INLINE void IfxCpu_forceDisableInterrupts(void)
+{
+    (void)IfxCpu_disableInterrupts();
+}
+
+
+IFX_INLINE void IfxCpu_restoreInterrupts(boolean enabled)
+{
+    if (enabled != FALSE)
+    {
+        IfxCpu_enableInterrupts();
+    }
+}
+
+
+IFX_INLINE IfxCpu_ResourceCpu IfxCpu_getCoreIndex(void)
+{
+    return IfxCpu_g_hostCoreIndex;
+}
+
+
+IFX_INLINE IfxCpu_ResourceCpu IfxCpu_getCoreId(void)
+{
+    return IfxCpu_g_hostCoreIndex;
+}
+
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+IFX_EXTERN boolean IfxCpu_acquireMutex(IfxCpu_mutexLock *lock);
+IFX_EXTERN void    IfxCpu_releaseMutex(IfxCpu_mutexLock *lock);
+IFX_EXTERN void    IfxCpu_resetSpinLock(IfxCpu_spinLock *lock);
+IFX_EXTERN boolean IfxCpu_setSpinLock(IfxCpu_spinLock *lock, uint32 timeoutCount);
+
+/******************************************************************************/
+#endif /* IFXCPU_H */
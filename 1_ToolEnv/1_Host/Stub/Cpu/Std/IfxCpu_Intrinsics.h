@@ -0,0 +1,129 @@
+/**
+ * \file IfxCpu_Intrinsics.h
+ * \brief Host (x86 Linux) replacement of the TriCore intrinsics.
+ *
+ * This file shadows 0_Src/4_McHal/Tricore/Cpu/Std/IfxCpu_Intrinsics.h when the
+ * pure software modules are compiled with 1_ToolEnv/1_Host/Makefile. Only the
+ * portable subset used by the SrvSw and _Lib modules is provided, implemented
+ * with plain C and GCC builtins instead of TriCore inline assembler.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#ifndef IFXCPU_INTRINSICS_H
+#define IFXCPU_INTRINSICS_H
+/******************************************************************************/
+#include "Cpu/Std/Ifx_Types.h"
+#include <math.h>
+
+#if !defined(__GNUC__) || defined(__TRICORE__)
+#error This file is only intended for the host build
+#endif
+
+#define IFX_ALIGN_8   (1)            // Align on 8 bit Boundary
+#define IFX_ALIGN_16  (2)            // Align on 16 bit Boundary
+#define IFX_ALIGN_32  (4)            // Align on 32 bit Boundary
+#define IFX_ALIGN_64  (8)            // Align on 64 bit Boundary
+#define IFX_ALIGN_256 (32)           // Align on 256 bit Boundary
+
+#define Ifx_AlignOn256(Size) ((((Size) + (IFX_ALIGN_256 - 1)) & (~(IFX_ALIGN_256 - 1))))
+#define Ifx_AlignOn64(Size)  ((((Size) + (IFX_ALIGN_64 - 1)) & (~(IFX_ALIGN_64 - 1))))
+#define Ifx_AlignOn32(Size)  ((((Size) + (IFX_ALIGN_32 - 1)) & (~(IFX_ALIGN_32 - 1))))
+#define Ifx_AlignOn16(Size)  ((((Size) + (IFX_ALIGN_16 - 1)) & (~(IFX_ALIGN_16 - 1))))
+#define Ifx_AlignOn8(Size)   ((((Size) + (IFX_ALIGN_8 - 1)) & (~(IFX_ALIGN_8 - 1))))
+
+#define Ifx_COUNTOF(x)       (sizeof(x) / sizeof(x[0]))
+
+/* *INDENT-OFF* */
+/** \defgroup IfxLld_Cpu_Intrinsics_Host Intrinsics for the host build
+ * \ingroup IfxLld_Cpu_Intrinsics
+ * \{
+ */
+#define __minX(X,Y)                     ( ((X) < (Y)) ? (X) : (Y) )
+#define __maxX(X,Y)                     ( ((X) > (Y)) ? (X) : (Y) )
+#define __saturateX(X,Min,Max)          ( __minX(__maxX(X, Min), Max) )
+#define __checkrangeX(X,Min,Max)        (((X) >= (Min)) && ((X) <= (Max)))
+
+#define __saturate(X,Min,Max)           ( __min(__max(X, Min), Max) )
+#define __saturateu(X,Min,Max)          ( __minu(__maxu(X, Min), Max) )
+
+IFX_INLINE sint32 __max(sint32 a, sint32 b)   { return (a > b) ? a : b; }
+IFX_INLINE sint32 __maxs(sint16 a, sint16 b)  { return (a > b) ? a : b; }
+IFX_INLINE uint32 __maxu(uint32 a, uint32 b)  { return (a > b) ? a : b; }
+IFX_INLINE sint32 __min(sint32 a, sint32 b)   { return (a < b) ? a : b; }
+IFX_INLINE sint16 __mins(sint16 a, sint16 b)  { return (a < b) ? a : b; }
+IFX_INLINE uint32 __minu(uint32 a, uint32 b)  { return (a < b) ? a : b; }
+
+#define __sqrf(X)                       ((X) * (X))
+#define __sqrtf(X)                      sqrtf(X)
+#define __checkrange(X,Min,Max)         (((X) >= (Min)) && ((X) <= (Max)))
+
+#define __roundf(X)                     ((((X) - (sint32)(X)) > 0.5) ? (1 + (sint32)(X)) : ((sint32)(X)))
+#define __absf(X)                       ( ((X) < 0.0) ? -(X) : (X) )
+#define __minf(X,Y)                     ( ((X) < (Y)) ? (X) : (Y) )
+#define __maxf(X,Y)                     ( ((X) > (Y)) ? (X) : (Y) )
+#define __saturatef(X,Min,Max)          ( __minf(__maxf(X, Min), Max) )
+#define __checkrangef(X,Min,Max)        (((X) >= (Min)) && ((X) <= (Max)))
+
+#define __abs_stdreal(X)                ( ((X) > 0.0) ? (X) : -(X) )
+#define __min_stdreal(X,Y)              ( ((X) < (Y)) ? (X) : (Y) )
+#define __max_stdreal(X,Y)              ( ((X) > (Y)) ? (X) : (Y) )
+#define __saturate_stdreal(X,Min,Max)   ( __min_stdreal(__max_stdreal(X, Min), Max) )
+
+#define __neqf(X,Y)                     ( ((X) > (Y)) ||  ((X) < (Y)) )     /**< X != Y */
+#define __leqf(X,Y)                     ( !((X) > (Y)) )     /**< X <= Y */
+#define __geqf(X,Y)                     ( !((X) < (Y)) )     /**< X >= Y */
+
+#define __abs(a)                        __builtin_abs(a)
+#define __clz(a)                        __builtin_clz(a)
+
+IFX_INLINE sint32 __absdif(sint32 a, sint32 b) { return (a > b) ? (a - b) : (b - a); }
+
+IFX_INLINE sint16 __sath(sint32 a)  { return (sint16)__saturate(a, -32768, 32767); }
+IFX_INLINE uint16 __sathu(sint32 a) { return (uint16)__saturate(a, 0, 65535); }
+
+IFX_INLINE uint32 __rol(uint32 operand, uint32 count) { return (operand << count) | (operand >> ((32 - count) & 31)); }
+IFX_INLINE uint32 __ror(uint32 operand, uint32 count) { return (operand >> count) | (operand << ((32 - count) & 31)); }
+
+IFX_INLINE uint32 __extru(uint32 a, uint32 p, uint32 w) { return (a >> p) & ((w < 32) ? ((1U << w) - 1) : 0xFFFFFFFFU); }
+
+/** Memory barriers: the host build maps DSYNC / ISYNC to a full fence */
+IFX_INLINE void __dsync(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+IFX_INLINE void __isync(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+IFX_INLINE void __nop(void)   { __asm__ volatile ("" : : : "memory"); }
+IFX_INLINE void __debug(void) { __builtin_trap(); }
+
+/** \brief Compare and swap, same semantic as the TriCore 1.6 CMPSWAP.W instruction
+ * \return The previous value of *address. The swap occurred if the return value equals condition.
+ */
+IFX_INLINE unsigned int __cmpAndSwap(unsigned int volatile *address, unsigned int value, unsigned int condition)
+{
+    __atomic_compare_exchange_n(address, &condition, value, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return condition;
+}
+
+/** \brief Swap, same semantic as the TriCore SWAP.W instruction */
+IFX_INLINE uint32 __swap(void *place, uint32 value)
+{
+    return __atomic_exchange_n((volatile uint32 *)place, value, __ATOMIC_SEQ_CST);
+}
+/** \} */
+/* *INDENT-ON* */
+
+/******************************************************************************/
+#endif /* IFXCPU_INTRINSICS_H */
@@ -0,0 +1,62 @@
+/**
+ * \file Bsp.c
+ * \brief Host (x86 Linux) replacement of the board support package
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Bsp.h"
+
+Ifx_TickTime TimeConst[TIMER_COUNT];
+
+/** \brief Initialize the time constants for the 1ns host timer.
+ * \return None.
+ */
+void initTime(void)
+{
+    sint32 Fsys = BSP_HOST_TIMER_FREQUENCY;
+
+    TimeConst[TIMER_INDEX_10NS]  = Fsys / (1000000000 / 10);
+    TimeConst[TIMER_INDEX_100NS] = Fsys / (1000000000 / 100);
+    TimeConst[TIMER_INDEX_1US]   = Fsys / (1000000 / 1);
+    TimeConst[TIMER_INDEX_10US]  = Fsys / (1000000 / 10);
+    TimeConst[TIMER_INDEX_100US] = Fsys / (1000000 / 100);
+    TimeConst[TIMER_INDEX_1MS]   = Fsys / (1000 / 1);
+    TimeConst[TIMER_INDEX_10MS]  = Fsys / (1000 / 10);
+    TimeConst[TIMER_INDEX_100MS] = Fsys / (1000 / 100);
+    TimeConst[TIMER_INDEX_1S]    = (Ifx_TickTime)Fsys * (1);
+    TimeConst[TIMER_INDEX_10S]   = (Ifx_TickTime)Fsys * (10);
+    TimeConst[TIMER_INDEX_100S]  = (Ifx_TickTime)Fsys * (100);
+}
+
+
+/** \brief Wait function.
+ * \return None.
+ */
+void waitPoll(void)
+{}
+
+/** \brief Wait time function.
+ * \param timeout Specifies the time the function waits for before returning
+ * \return None.
+ */
+void waitTime(Ifx_TickTime timeout)
+{
+    wait(timeout);
+}
@@ -0,0 +1,263 @@
+/**
+ * \file Bsp.h
+ * \brief Host (x86 Linux) replacement of the board support package
+ *
+ * This file shadows 0_Src/1_SrvSw/SysSe/Bsp/Bsp.h in the host build. The API is
+ * the same, the system timer is emulated by CLOCK_MONOTONIC with a resolution of
+ * 1 tick = 1ns.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#ifndef BSP_H
+#define BSP_H 1
+
+#include "Ifx_Cfg.h"                   /* Do not remove this include */
+#include "Cpu/Std/IfxCpu_Intrinsics.h" /* Do not remove this include */
+#include "_Utilities/Ifx_Assert.h"     /* Do not remove this include */
+
+#include "Cpu/Std/IfxCpu.h"
+#include <time.h>
+
+/** \brief Frequency of the emulated system timer in Hz */
+#define BSP_HOST_TIMER_FREQUENCY (1000000000)
+
+/******************************************************************************/
+/*                           Functions                                        */
+/******************************************************************************/
+
+/** \brief Return the status of the global interrupts */
+IFX_INLINE boolean areInterruptsEnabled(void)
+{
+    return IfxCpu_areInterruptsEnabled();
+}
+
+
+/** \brief Disable the global interrupts */
+IFX_INLINE boolean disableInterrupts(void)
+{
+    return IfxCpu_disableInterrupts();
+}
+
+
+/** \brief Disable the global interrupts forcefully */
+IFX_INLINE void forceDisableInterrupts(void)
+{
+    IfxCpu_forceDisableInterrupts();
+}
+
+
+/** \brief enable the global interrupts */
+IFX_INLINE void enableInterrupts(void)
+{
+    IfxCpu_enableInterrupts();
+}
+
+
+/** \brief Restore the state of the global interrupts. */
+IFX_INLINE void restoreInterrupts(boolean enabled)
+{
+    IfxCpu_restoreInterrupts(enabled);
+}
+
+
+/******************************************************************************/
+/*                           Macros                                           */
+/******************************************************************************/
+#define TIMER_COUNT       (11)                                      /**< \internal \brief number of timer values defined */
+#define TIMER_INDEX_10NS  (0)                                       /**< \internal \brief Index of the time value 10ns*/
+#define TIMER_INDEX_100NS (1)                                       /**< \internal \brief Index of the time value 100ns*/
+#define TIMER_INDEX_1US   (2)                                       /**< \internal \brief Index of the time value 1us*/
+#define TIMER_INDEX_10US  (3)                                       /**< \internal \brief Index of the time value 10us*/
+#define TIMER_INDEX_100US (4)                                       /**< \internal \brief Index of the time value 100us*/
+#define TIMER_INDEX_1MS   (5)                                       /**< \internal \brief Index of the time value 1ms*/
+#define TIMER_INDEX_10MS  (6)                                       /**< \internal \brief Index of the time value 10ms*/
+#define TIMER_INDEX_100MS (7)                                       /**< \internal \brief Index of the time value 100ms*/
+#define TIMER_INDEX_1S    (8)                                       /**< \internal \brief Index of the time value 1s*/
+#define TIMER_INDEX_10S   (9)                                       /**< \internal \brief Index of the time value 10s*/
+#define TIMER_INDEX_100S  (10)                                      /**< \internal \brief Index of the time value 100s*/
+
+/** \internal
+ *  Array containing the time constants.
+ */
+IFX_EXTERN Ifx_TickTime TimeConst[TIMER_COUNT];
+
+IFX_EXTERN void         initTime(void);
+IFX_EXTERN void         waitPoll(void);
+IFX_EXTERN void         waitTime(Ifx_TickTime timeout);
+
+/** Prototype for wait() functions */
+typedef void (*WaitTimeFunction)(Ifx_TickTime timeout);
+
+#define TimeConst_0s    ((Ifx_TickTime)0)                           /**< \brief time constant equal to 1s */
+#define TimeConst_10ns  (TimeConst[TIMER_INDEX_10NS])               /**< \brief time constant equal to 10ns */
+#define TimeConst_100ns (TimeConst[TIMER_INDEX_100NS])              /**< \brief time constant equal to 100ns */
+#define TimeConst_1us   (TimeConst[TIMER_INDEX_1US])                /**< \brief time constant equal to 1us */
+#define TimeConst_10us  (TimeConst[TIMER_INDEX_10US])               /**< \brief time constant equal to 10us */
+#define TimeConst_100us (TimeConst[TIMER_INDEX_100US])              /**< \brief time constant equal to 100us */
+#define TimeConst_1ms   (TimeConst[TIMER_INDEX_1MS])                /**< \brief time constant equal to 1ms */
+#define TimeConst_10ms  (TimeConst[TIMER_INDEX_10MS])               /**< \brief time constant equal to 10ms */
+#define TimeConst_100ms (TimeConst[TIMER_INDEX_100MS])              /**< \brief time constant equal to 100ms */
+#define TimeConst_1s    (TimeConst[TIMER_INDEX_1S])                 /**< \brief time constant equal to 1s */
+#define TimeConst_10s   (TimeConst[TIMER_INDEX_10S])                /**< \brief time constant equal to 10s */
+#define TimeConst_100s  (TimeConst[TIMER_INDEX_100S])               /**< \brief time constant equal to 100s */
+
+/** \brief Return the emulated system timer value (without critical section). */
+IFX_INLINE Ifx_TickTime nowWithoutCriticalSection(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((Ifx_TickTime)ts.tv_sec * BSP_HOST_TIMER_FREQUENCY) + (Ifx_TickTime)ts.tv_nsec) & TIME_INFINITE;
+}
+
+
+/** \brief Return the emulated system timer value.
+ * The host clock is read atomically, no critical section is required.
+ */
+IFX_INLINE Ifx_TickTime now(void)
+{
+    return nowWithoutCriticalSection();
+}
+
+
+/** \brief Add 2 Ifx_TickTime values and return the result */
+IFX_INLINE Ifx_TickTime addTTime(Ifx_TickTime a, Ifx_TickTime b)
+{
+    Ifx_TickTime result;
+
+    if ((a == TIME_INFINITE) || (b == TIME_INFINITE))
+    {
+        result = TIME_INFINITE;
+    }
+    else
+    {
+        result = a + b;
+    }
+
+    return result;
+}
+
+
+/** \brief Return the elapsed time in ticks. */
+IFX_INLINE Ifx_TickTime elapsed(Ifx_TickTime since)
+{
+    return now() - since;
+}
+
+
+/** \brief Return the time dead line. */
+IFX_INLINE Ifx_TickTime getDeadLine(Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine;
+
+    if (timeout == TIME_INFINITE)
+    {
+        deadLine = TIME_INFINITE;
+    }
+    else
+    {
+        deadLine = now() + timeout;
+    }
+
+    return deadLine;
+}
+
+
+/** \brief Return the time until the dead line. */
+IFX_INLINE Ifx_TickTime getTimeout(Ifx_TickTime deadline)
+{
+    Ifx_TickTime timeout;
+
+    if (deadline == TIME_INFINITE)
+    {
+        timeout = TIME_INFINITE;
+    }
+    else
+    {
+        timeout = deadline - now();
+    }
+
+    return timeout;
+}
+
+
+/** \brief Return TRUE if the dead line is over. */
+IFX_INLINE boolean isDeadLine(Ifx_TickTime deadLine)
+{
+    boolean result;
+
+    if (deadLine == TIME_INFINITE)
+    {
+        result = FALSE;
+    }
+    else
+    {
+        result = now() >= deadLine;
+    }
+
+    return result;
+}
+
+
+/** \brief Poll a variable for a time. */
+IFX_INLINE boolean poll(volatile boolean *test, Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine = getDeadLine(timeout);
+
+    while ((*test == FALSE) && (isDeadLine(deadLine) == FALSE))
+    {}
+
+    return *test;
+}
+
+
+/** \brief Return the elapsed time in system timer ticks, and enable the interrupts. */
+IFX_INLINE Ifx_TickTime timingNoInterruptEnd(Ifx_TickTime since, boolean interruptEnabled)
+{
+    Ifx_TickTime stmNow;
+
+    stmNow = nowWithoutCriticalSection();
+    restoreInterrupts(interruptEnabled);
+
+    return stmNow - since;
+}
+
+
+/** \brief Disable the interrupt and return system timer value. */
+IFX_INLINE Ifx_TickTime timingNoInterruptStart(boolean *interruptEnabled)
+{
+    *interruptEnabled = disableInterrupts();
+
+    return nowWithoutCriticalSection();
+}
+
+
+/** \brief Wait for a while. */
+IFX_INLINE void wait(Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine = getDeadLine(timeout);
+
+    while (isDeadLine(deadLine) == FALSE)
+    {}
+}
+
+
+#endif /* BSP_H */
@@ -0,0 +1,12 @@
+/**
+ * \file cint.h
+ * \brief Host (x86 Linux) replacement of the HighTec <machine/cint.h> header.
+ *
+ * Ifx_TypesGnuc.h includes the TriCore interrupt intrinsics header of the
+ * HighTec tool chain. None of its content is used by the modules compiled in
+ * the host build, the header is therefore empty.
+ */
+#ifndef MACHINE_CINT_H
+#define MACHINE_CINT_H 1
+
+#endif /* MACHINE_CINT_H */
@@ -0,0 +1,245 @@
+/**
+ * \file Ifx_AngleTrkReplay.c
+ * \brief Host replay of captured resolver traces through \ref library_srvsw_sysse_math_f32_angletrk.
+ *
+ * Usage: Ifx_AngleTrkReplay [-t Ts] [-g kp,ki,kd] ... [file]
+ *
+ * Reads the sin/cos samples from the file (default: stdin), one sample per line, the sine and
+ * cosine being the last two numeric fields of the line. This accepts plain "sin,cos" lists as
+ * well as the output of Ifx_TelemetryDecode. Lines without two numeric fields, e.g. headers, are
+ * ignored.
+ *
+ * -t sets the sampling period in seconds (default 100e-6). Each -g adds an observer with the given
+ * gains, all observers replay the same trace with Ifx_AngleTrkF32_stepBlockMulti(). Without -g, one
+ * observer with the default gains of Ifx_AngleTrkF32_initConfig() is used.
+ *
+ * Writes one CSV line per sample to stdout:
+ *
+ *     sample,sin,cos,angle0,angle1,...
+ *
+ * The replay throughput and the final status of each observer are printed to stderr.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_AngleTrkF32.h"
+#include "Bsp.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFX_ANGLETRKREPLAY_MAX_OBSERVERS (16)   /**< \brief Maximal number of -g options */
+#define IFX_ANGLETRKREPLAY_LINE_SIZE     (256)  /**< \brief Maximal length of an input line */
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Get the last two numeric fields of a line, return FALSE if there are less than two */
+static boolean Ifx_AngleTrkReplay_parseLine(char *line, sint16 *sinVal, sint16 *cosVal)
+{
+    long    values[2] = {0, 0};
+    sint32  found     = 0;
+    char   *field     = strtok(line, ",; \t\r\n");
+
+    while (field != NULL)
+    {
+        char *end;
+        long  value = strtol(field, &end, 10);
+
+        if ((end != field) && (*end == '\0'))
+        {
+            values[0] = values[1];
+            values[1] = value;
+            found++;
+        }
+
+        field = strtok(NULL, ",; \t\r\n");
+    }
+
+    *sinVal = (sint16)values[0];
+    *cosVal = (sint16)values[1];
+
+    return found >= 2;
+}
+
+
+/** \brief Read the trace, return the number of samples */
+static sint32 Ifx_AngleTrkReplay_read(FILE *input, sint16 **sinIn, sint16 **cosIn)
+{
+    char   line[IFX_ANGLETRKREPLAY_LINE_SIZE];
+    sint32 count    = 0;
+    sint32 capacity = 0;
+
+    *sinIn = NULL;
+    *cosIn = NULL;
+
+    while (fgets(line, sizeof(line), input) != NULL)
+    {
+        sint16 sinVal, cosVal;
+
+        if (Ifx_AngleTrkReplay_parseLine(line, &sinVal, &cosVal) == FALSE)
+        {
+            continue;
+        }
+
+        if (count == capacity)
+        {
+            capacity = (capacity == 0) ? 4096 : (capacity * 2);
+            *sinIn   = realloc(*sinIn, (size_t)capacity * sizeof(sint16));
+            *cosIn   = realloc(*cosIn, (size_t)capacity * sizeof(sint16));
+
+            if ((*sinIn == NULL) || (*cosIn == NULL))
+            {
+                return -1;
+            }
+        }
+
+        (*sinIn)[count] = sinVal;
+        (*cosIn)[count] = cosVal;
+        count++;
+    }
+
+    return count;
+}
+
+
+int main(int argc, char *argv[])
+{
+    static Ifx_AngleTrkF32 observer[IFX_ANGLETRKREPLAY_MAX_OBSERVERS];
+    Ifx_AngleTrkF32_Config config;
+    float32                gains[IFX_ANGLETRKREPLAY_MAX_OBSERVERS][3];
+    sint32                 observers = 0;
+    float32                Ts        = 100e-6f;
+    FILE                  *input     = stdin;
+    sint16                 sinVar    = 0;
+    sint16                 cosVar    = 0;
+    sint16                *sinIn;
+    sint16                *cosIn;
+    const sint16          *sinInK[IFX_ANGLETRKREPLAY_MAX_OBSERVERS];
+    const sint16          *cosInK[IFX_ANGLETRKREPLAY_MAX_OBSERVERS];
+    float32               *angleK[IFX_ANGLETRKREPLAY_MAX_OBSERVERS];
+    Ifx_TickTime           start;
+    float64                seconds;
+    sint32                 count, i, k;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc))
+        {
+            Ts = strtof(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "-g") == 0) && ((i + 1) < argc) && (observers < IFX_ANGLETRKREPLAY_MAX_OBSERVERS)
+                 && (sscanf(argv[++i], "%f,%f,%f", &gains[observers][0], &gains[observers][1], &gains[observers][2]) == 3))
+        {
+            observers++;
+        }
+        else if ((argv[i][0] != '-') && (input == stdin) && ((input = fopen(argv[i], "r")) != NULL))
+        {}
+        else
+        {
+            fprintf(stderr, "Usage: Ifx_AngleTrkReplay [-t Ts] [-g kp,ki,kd] ... [file]\n");
+            return 1;
+        }
+    }
+
+    if (!(Ts > 0.0f))
+    {
+        fprintf(stderr, "Ifx_AngleTrkReplay: invalid sampling period\n");
+        return 1;
+    }
+
+    count = Ifx_AngleTrkReplay_read(input, &sinIn, &cosIn);
+
+    if (count <= 0)
+    {
+        fprintf(stderr, "Ifx_AngleTrkReplay: no samples\n");
+        return 1;
+    }
+
+    Ifx_AngleTrkF32_initConfig(&config, &sinVar, &cosVar);
+
+    for (k = 0; k < __max(observers, 1); k++)
+    {
+        if (observers > 0)
+        {
+            config.kp = gains[k][0];
+            config.ki = gains[k][1];
+            config.kd = gains[k][2];
+        }
+
+        Ifx_AngleTrkF32_init(&observer[k], &config, Ts);
+        sinInK[k] = sinIn;
+        cosInK[k] = cosIn;
+        angleK[k] = malloc((size_t)count * sizeof(float32));
+
+        if (angleK[k] == NULL)
+        {
+            fprintf(stderr, "Ifx_AngleTrkReplay: out of memory\n");
+            return 1;
+        }
+    }
+
+    observers = __max(observers, 1);
+
+    initTime();
+    start = now();
+    Ifx_AngleTrkF32_stepBlockMulti(observer, observers, sinInK, cosInK, angleK, count);
+    seconds = (float64)elapsed(start) / (float64)TimeConst_1s;
+
+    printf("sample,sin,cos");
+
+    for (k = 0; k < observers; k++)
+    {
+        printf(",angle%d", (int)k);
+    }
+
+    printf("\n");
+
+    for (i = 0; i < count; i++)
+    {
+        printf("%d,%d,%d", (int)i, (int)sinIn[i], (int)cosIn[i]);
+
+        for (k = 0; k < observers; k++)
+        {
+            printf(",%.7g", (double)angleK[k][i]);
+        }
+
+        printf("\n");
+    }
+
+    fprintf(stderr, "Ifx_AngleTrkReplay: %d samples x %d observers in %.6f s (%.3g samples/s)\n",
+        (int)count, (int)observers, seconds, (seconds > 0.0) ? ((float64)count * observers / seconds) : 0.0);
+
+    for (k = 0; k < observers; k++)
+    {
+        fprintf(stderr, "Ifx_AngleTrkReplay: observer %d status 0x%X, speed %.7g rad/s\n",
+            (int)k, (unsigned)observer[k].base.status.status, (double)Ifx_AngleTrkF32_getSpeed(&observer[k]));
+    }
+
+    return 0;
+}
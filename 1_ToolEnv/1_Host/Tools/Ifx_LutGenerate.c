@@ -0,0 +1,183 @@
+/**
+ * \file Ifx_LutGenerate.c
+ * \brief Generator of the precompiled \ref library_srvsw_sysse_math_lut tables.
+ *
+ * Usage: Ifx_LutGenerate sincos|atan2 bits [file]
+ *
+ * Writes Ifx_LutSincosF32_Table.c for \ref IFX_LUTSINCOSF32_BITS = bits, or Ifx_LutAtan2F32_Table.c
+ * for \ref IFX_LUTATAN2F32_BITS = bits, to the file (default: stdout). The values are computed in
+ * double precision. Called by the "lut" target of the host Makefile.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Write the file header */
+static void Ifx_LutGenerate_header(FILE *output, const char *file, const char *brief, const char *include)
+{
+    fprintf(output,
+        "/**\n"
+        " * \\file %s\n"
+        " * \\brief %s\n"
+        " *\n"
+        " * Generated by 1_ToolEnv/1_Host/Tools/Ifx_LutGenerate.c, do not edit.\n"
+        " * See \\ref library_srvsw_sysse_math_lut_generate.\n"
+        " *\n"
+        " * \\version disabled\n"
+        " * \\copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.\n"
+        " *\n"
+        " *\n"
+        " *                                 IMPORTANT NOTICE\n"
+        " *\n"
+        " *\n"
+        " * Infineon Technologies AG (Infineon) is supplying this file for use\n"
+        " * exclusively with Infineon's microcontroller products. This file can be freely\n"
+        " * distributed within development tools that are supporting such microcontroller\n"
+        " * products.\n"
+        " *\n"
+        " * THIS SOFTWARE IS PROVIDED \"AS IS\".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED\n"
+        " * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF\n"
+        " * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.\n"
+        " * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,\n"
+        " * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.\n"
+        " *\n"
+        " */\n"
+        "\n"
+        "#include \"%s\"\n"
+        "\n",
+        file, brief, include);
+}
+
+
+/** \brief Write Ifx_LutSincosF32_Table.c: quarter wave sin(2*pi*k/2^bits), k = 0 .. 2^bits/4 */
+static void Ifx_LutGenerate_sincos(FILE *output, int bits)
+{
+    int size = (1 << bits) / 4;
+    int k;
+
+    Ifx_LutGenerate_header(output, "Ifx_LutSincosF32_Table.c", "Table data for Sin/Cos lookup functions", "Ifx_LutSincosF32.h");
+
+    fprintf(output,
+        "#if IFX_LUT_TABLE_CONST == 0\n"
+        "IFX_LUT_TABLE float32 Ifx_g_LutSincosF32_table[(IFX_LUTSINCOSF32_PI / 2) + 1];\n"
+        "#else\n"
+        "\n"
+        "#if (IFX_LUTSINCOSF32_BITS != %d)\n"
+        "#error \"Inconsistent between Lookup Table and configuration. Please regenerate.\"\n"
+        "#endif\n"
+        "\n"
+        "/*lint -e915*/\n"
+        "const float32 Ifx_g_LutSincosF32_table[%d + 1] = {\n",
+        bits, size);
+
+    for (k = 0; k <= size; k++)
+    {
+        fprintf(output, "    %.15g,\n", sin((2.0 * M_PI * k) / (1 << bits)));
+    }
+
+    fprintf(output, "};\n\n#endif\n");
+}
+
+
+/** \brief Write Ifx_LutAtan2F32_Table.c: atan(k/2^bits), k = 0 .. 2^bits */
+static void Ifx_LutGenerate_atan2(FILE *output, int bits)
+{
+    int size = 1 << bits;
+    int k;
+
+    Ifx_LutGenerate_header(output, "Ifx_LutAtan2F32_Table.c", "Table data for ATAN2 lookup functions", "Ifx_LutAtan2F32.h");
+
+    fprintf(output,
+        "#if IFX_LUT_TABLE_CONST == 0\n"
+        "#if IFX_LUTATAN2F32_INTERPOLATION == 0\n"
+        "IFX_LUT_TABLE Ifx_Lut_FxpAngle Ifx_g_LutAtan2F32_FxpAngle_table[IFX_LUTATAN2F32_SIZE + 1];\n"
+        "#endif\n"
+        "IFX_LUT_TABLE float32          Ifx_g_LutAtan2F32_table[IFX_LUTATAN2F32_SIZE + 1];\n"
+        "#else\n"
+        "\n"
+        "#if (IFX_LUTATAN2F32_BITS != %d)\n"
+        "#error \"Inconsistent between Lookup Table and configuration. Please regenerate.\"\n"
+        "#endif\n"
+        "\n"
+        "#if IFX_LUTATAN2F32_INTERPOLATION == 0\n"
+        "const Ifx_Lut_FxpAngle Ifx_g_LutAtan2F32_FxpAngle_table[%d + 1] = {\n",
+        bits, size);
+
+    for (k = 0; k <= size; k++)
+    {
+        fprintf(output, "    IFX_LUT_F32_TO_FXPANGLE(%.15g),\n", atan((double)k / size));
+    }
+
+    fprintf(output,
+        "};\n"
+        "#endif\n"
+        "\n"
+        "const float32          Ifx_g_LutAtan2F32_table[%d + 1] = {\n",
+        size);
+
+    for (k = 0; k <= size; k++)
+    {
+        fprintf(output, "    %.15g,\n", atan((double)k / size));
+    }
+
+    fprintf(output, "};\n\n#endif\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    FILE *output = stdout;
+    int   bits   = (argc >= 3) ? atoi(argv[2]) : 0;
+
+    if ((argc < 3) || (argc > 4) || (bits < 8) || (bits > 16)
+        || ((strcmp(argv[1], "sincos") != 0) && (strcmp(argv[1], "atan2") != 0)))
+    {
+        fprintf(stderr, "Usage: Ifx_LutGenerate sincos|atan2 bits [file], bits = 8 .. 16\n");
+        return 1;
+    }
+
+    if ((argc == 4) && ((output = fopen(argv[3], "w")) == NULL))
+    {
+        fprintf(stderr, "Ifx_LutGenerate: can not open %s\n", argv[3]);
+        return 1;
+    }
+
+    if (strcmp(argv[1], "sincos") == 0)
+    {
+        Ifx_LutGenerate_sincos(output, bits);
+    }
+    else
+    {
+        Ifx_LutGenerate_atan2(output, bits);
+    }
+
+    return (fclose(output) == 0) ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/**
+ * \file Ifx_TelemetryDecode.c
+ * \brief Host decoder of the \ref library_srvsw_sysse_comm_telemetry stream.
+ *
+ * Usage: Ifx_TelemetryDecode [-l] [file]
+ *
+ * Reads the binary stream from the file (default: stdin, e.g. the serial port) and
+ * writes one CSV line per sample to stdout:
+ *
+ *     time_s,channel,value0,value1,...
+ *
+ * -l selects the length prefixed framing (\ref Ifx_Telemetry_Framing_none), the default
+ * is the COBS framing. The number of invalid and skipped packets is printed to stderr.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Ifx_Telemetry.h"
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Decoder state of one channel */
+typedef struct
+{
+    boolean      described;                               /**< \brief The channel descriptor has been received */
+    boolean      referenced;                              /**< \brief An absolute packet has been received since the descriptor */
+    uint8        type;                                    /**< \brief \ref Ifx_Telemetry_Type */
+    uint8        count;                                   /**< \brief Number of values per sample */
+    boolean      deltaEncoding;                           /**< \brief Values of delta packets are differences */
+    char         name[IFX_TELEMETRY_NAME_SIZE + 1];       /**< \brief Channel name */
+    uint64       timestamp;                               /**< \brief Timestamp of the previous packet */
+    uint32       values[IFX_CFG_TELEMETRY_MAX_VALUES];    /**< \brief Values of the previous packet */
+} Ifx_TelemetryDecode_Channel;
+
+/** \brief Decoder state */
+typedef struct
+{
+    uint32                      frequency;                                   /**< \brief Tick frequency, 0 if unknown */
+    uint32                      packets;                                     /**< \brief Number of decoded samples */
+    uint32                      invalid;                                     /**< \brief Number of malformed frames / packets */
+    uint32                      skipped;                                     /**< \brief Number of samples of unknown or unreferenced channels */
+    Ifx_TelemetryDecode_Channel channel[IFX_TELEMETRY_CHANNEL_META];         /**< \brief Channels */
+} Ifx_TelemetryDecode;
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Read an unsigned LEB128 value, return FALSE if the packet is too short */
+static boolean Ifx_TelemetryDecode_getVarint(const uint8 **position, const uint8 *end, uint64 *value)
+{
+    uint32  shift = 0;
+    boolean last  = FALSE;
+
+    *value = 0;
+
+    while ((*position < end) && (shift < 64) && (last == FALSE))
+    {
+        uint8 byte = *(*position)++;
+        *value |= (uint64)(byte & 0x7FU) << shift;
+        shift  += 7;
+        last    = (byte & 0x80U) == 0;
+    }
+
+    return last;
+}
+
+
+/** \brief Print a value according to its type */
+static void Ifx_TelemetryDecode_printValue(uint8 type, uint32 value)
+{
+    switch (type)
+    {
+    case Ifx_Telemetry_Type_uint8:
+        printf(",%u", (unsigned)(uint8)value);
+        break;
+    case Ifx_Telemetry_Type_sint8:
+        printf(",%d", (int)(sint8)value);
+        break;
+    case Ifx_Telemetry_Type_uint16:
+        printf(",%u", (unsigned)(uint16)value);
+        break;
+    case Ifx_Telemetry_Type_sint16:
+        printf(",%d", (int)(sint16)value);
+        break;
+    case Ifx_Telemetry_Type_sint32:
+        printf(",%d", (int)(sint32)value);
+        break;
+    case Ifx_Telemetry_Type_float32:
+    {
+        float32 f;
+        memcpy(&f, &value, sizeof(f));
+        printf(",%.9g", (double)f);
+        break;
+    }
+    default:
+        printf(",%u", (unsigned)value);
+        break;
+    }
+}
+
+
+/** \brief Decode a packet of channel \ref IFX_TELEMETRY_CHANNEL_META */
+static void Ifx_TelemetryDecode_meta(Ifx_TelemetryDecode *decoder, const uint8 *packet, sint32 length)
+{
+    if ((length == 6) && (packet[1] == IFX_TELEMETRY_META_STREAM))
+    {
+        decoder->frequency = (uint32)packet[2] | ((uint32)packet[3] << 8) | ((uint32)packet[4] << 16) | ((uint32)packet[5] << 24);
+    }
+    else if ((length >= 7) && (packet[1] == IFX_TELEMETRY_META_CHANNEL) && (packet[2] < IFX_TELEMETRY_CHANNEL_META)
+             && (packet[4] > 0) && (packet[4] <= IFX_CFG_TELEMETRY_MAX_VALUES)
+             && (packet[6] <= IFX_TELEMETRY_NAME_SIZE) && (length == (7 + packet[6])))
+    {
+        Ifx_TelemetryDecode_Channel *channel = &decoder->channel[packet[2]];
+        boolean                      same    = channel->described && (channel->type == packet[3])
+                                               && (channel->count == packet[4]) && (channel->deltaEncoding == (packet[5] != 0));
+
+        channel->described     = TRUE;
+        channel->referenced    = same && channel->referenced;
+        channel->type          = packet[3];
+        channel->count         = packet[4];
+        channel->deltaEncoding = packet[5] != 0;
+        memcpy(channel->name, &packet[7], packet[6]);
+        channel->name[packet[6]] = '\0';
+    }
+    else
+    {
+        decoder->invalid++;
+    }
+}
+
+
+/** \brief Decode a packet and print the sample */
+static void Ifx_TelemetryDecode_packet(Ifx_TelemetryDecode *decoder, const uint8 *packet, sint32 length)
+{
+    const uint8                 *position = packet + 1;
+    const uint8                 *end      = packet + length;
+    uint8                        index    = packet[0] & IFX_TELEMETRY_CHANNEL_MASK;
+    boolean                      delta    = (packet[0] & IFX_TELEMETRY_HEADER_DELTA) != 0;
+    Ifx_TelemetryDecode_Channel *channel;
+    uint32                       values[IFX_CFG_TELEMETRY_MAX_VALUES];
+    uint64                       timestamp;
+    boolean                      valid;
+    uint32                       i;
+
+    if (index == IFX_TELEMETRY_CHANNEL_META)
+    {
+        Ifx_TelemetryDecode_meta(decoder, packet, length);
+        return;
+    }
+
+    channel = &decoder->channel[index];
+
+    if ((channel->described == FALSE) || (delta && (channel->referenced == FALSE)))
+    {
+        /* Not decodable until the descriptor or the next absolute packet is received */
+        decoder->skipped++;
+        return;
+    }
+
+    valid = Ifx_TelemetryDecode_getVarint(&position, end, &timestamp);
+
+    if (delta)
+    {
+        timestamp += channel->timestamp;
+    }
+
+    for (i = 0; (i < channel->count) && valid; i++)
+    {
+        if (delta && channel->deltaEncoding)
+        {
+            uint64 zigzag;
+            valid     = Ifx_TelemetryDecode_getVarint(&position, end, &zigzag);
+            values[i] = channel->values[i] + (((uint32)zigzag >> 1) ^ (0U - ((uint32)zigzag & 1U)));
+        }
+        else
+        {
+            uint32 size = (uint32)channel->type & 0x0FU;
+            uint32 byte;
+
+            values[i] = 0;
+            valid     = (uint32)(end - position) >= size;
+
+            for (byte = 0; (byte < size) && valid; byte++)
+            {
+                values[i] |= (uint32)*position++ << (byte * 8);
+            }
+        }
+    }
+
+    if ((valid == FALSE) || (position != end))
+    {
+        decoder->invalid++;
+        return;
+    }
+
+    channel->referenced = TRUE;
+    channel->timestamp  = timestamp;
+    memcpy(channel->values, values, sizeof(values));
+    decoder->packets++;
+
+    if (decoder->frequency != 0)
+    {
+        printf("%.9f,%s", (double)timestamp / decoder->frequency, channel->name);
+    }
+    else
+    {
+        printf("%llu,%s", (unsigned long long)timestamp, channel->name);
+    }
+
+    for (i = 0; i < channel->count; i++)
+    {
+        Ifx_TelemetryDecode_printValue(channel->type, values[i]);
+    }
+
+    printf("\n");
+}
+
+
+/** \brief Decode a COBS framed stream */
+static void Ifx_TelemetryDecode_cobs(Ifx_TelemetryDecode *decoder, FILE *input)
+{
+    uint8   frame[IFX_TELEMETRY_MAX_FRAME_SIZE];
+    uint8   packet[IFX_TELEMETRY_MAX_FRAME_SIZE];
+    sint32  count   = 0;
+    boolean overrun = FALSE;
+    int     c;
+
+    while ((c = fgetc(input)) != EOF)
+    {
+        if (c != 0)
+        {
+            if (count < (sint32)sizeof(frame))
+            {
+                frame[count++] = (uint8)c;
+            }
+            else
+            {
+                overrun = TRUE;
+            }
+        }
+        else if (count > 0)
+        {
+            /* End of frame: the stream is resynchronised on each 0 byte */
+            sint32 length = overrun ? -1 : Ifx_Telemetry_decodeCobs(packet, frame, (Ifx_SizeT)count);
+
+            if (length > 0)
+            {
+                Ifx_TelemetryDecode_packet(decoder, packet, length);
+            }
+            else
+            {
+                decoder->invalid++;
+            }
+
+            count   = 0;
+            overrun = FALSE;
+        }
+    }
+}
+
+
+/** \brief Decode a length prefixed stream */
+static void Ifx_TelemetryDecode_lengthPrefixed(Ifx_TelemetryDecode *decoder, FILE *input)
+{
+    uint8 packet[256];
+    int   length;
+
+    while ((length = fgetc(input)) != EOF)
+    {
+        if (length == 0)
+        {
+            decoder->invalid++;
+        }
+        else if (fread(packet, 1, (size_t)length, input) == (size_t)length)
+        {
+            Ifx_TelemetryDecode_packet(decoder, packet, length);
+        }
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    static Ifx_TelemetryDecode decoder;
+    boolean                    cobs  = TRUE;
+    FILE                      *input = stdin;
+    int                        i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-l") == 0)
+        {
+            cobs = FALSE;
+        }
+        else if ((input = fopen(argv[i], "rb")) == NULL)
+        {
+            fprintf(stderr, "Ifx_TelemetryDecode: can not open %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    printf("time_s,channel");
+
+    for (i = 0; i < IFX_CFG_TELEMETRY_MAX_VALUES; i++)
+    {
+        printf(",value%d", i);
+    }
+
+    printf("\n");
+
+    if (cobs)
+    {
+        Ifx_TelemetryDecode_cobs(&decoder, input);
+    }
+    else
+    {
+        Ifx_TelemetryDecode_lengthPrefixed(&decoder, input);
+    }
+
+    fprintf(stderr, "Ifx_TelemetryDecode: %u samples, %u invalid, %u skipped\n", decoder.packets, decoder.invalid, decoder.skipped);
+
+    return 0;
+}